@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Enable debug log for test coverage
+#define DEBUG_ENABLED 1
+
+#include "dali-scene-loader/internal/parallel.h"
+#include "dali-scene-loader/internal/vertex-kernels.h"
+#include <dali-test-suite-utils.h>
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::SceneLoader;
+
+namespace
+{
+// Some counts which are not multiple of the vector sizes to check the vertices left over.
+const uint32_t NUMBER_OF_VERTICES[] = {0u, 1u, 3u, 4u, 5u, 15u, 16u, 17u, 33u, 67u};
+
+// More vertices than a single job of ParallelFor() processes.
+const uint32_t PARALLEL_NUMBER_OF_VERTICES = 50000u;
+
+std::vector<Vector3> CreateVectors(std::mt19937& generator, uint32_t count)
+{
+  std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+
+  std::vector<Vector3> vectors(count);
+  for(auto& vector : vectors)
+  {
+    vector = Vector3(distribution(generator), distribution(generator), distribution(generator));
+  }
+
+  // Add a null vector, which can't be normalized.
+  if(count > 2u)
+  {
+    vectors[2] = Vector3::ZERO;
+  }
+  return vectors;
+}
+
+std::vector<Vector3> CreateNormals(std::mt19937& generator, uint32_t count)
+{
+  auto normals = CreateVectors(generator, count);
+  Scalar::NormalizeVectors(normals.data(), count);
+  return normals;
+}
+
+void CheckVectors(const std::vector<Vector3>& expected, const std::vector<Vector3>& result, const char* location)
+{
+  DALI_TEST_EQUALS(expected.size(), result.size(), location);
+  for(uint32_t i = 0u; i < expected.size(); ++i)
+  {
+    DALI_TEST_EQUALS(expected[i], result[i], Math::MACHINE_EPSILON_100, location);
+  }
+}
+
+} // namespace
+
+int UtcDaliVertexKernelsNormalizeVectors(void)
+{
+  std::mt19937 generator(1u);
+  for(uint32_t count : NUMBER_OF_VERTICES)
+  {
+    auto expected = CreateVectors(generator, count);
+    auto result   = expected;
+    Scalar::NormalizeVectors(expected.data(), count);
+    NormalizeVectors(result.data(), count);
+
+    CheckVectors(expected, result, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliVertexKernelsTangents(void)
+{
+  std::mt19937 generator(2u);
+  for(uint32_t count : NUMBER_OF_VERTICES)
+  {
+    const auto normals = CreateNormals(generator, count);
+
+    std::vector<Vector3> expected(count);
+    std::vector<Vector3> result(count);
+    Scalar::CalculateTangents(normals.data(), expected.data(), count);
+    CalculateTangents(normals.data(), result.data(), count);
+    CheckVectors(expected, result, TEST_LOCATION);
+
+    expected = CreateVectors(generator, count);
+    result   = expected;
+    Scalar::OrthonormalizeTangents(expected.data(), normals.data(), count);
+    OrthonormalizeTangents(result.data(), normals.data(), count);
+    CheckVectors(expected, result, TEST_LOCATION);
+  }
+
+  // The tangent is perpendicular to the normal.
+  Vector3 normal = Vector3(1.f, 2.f, 3.f);
+  normal.Normalize();
+  Vector3 tangent;
+  CalculateTangents(&normal, &tangent, 1u);
+  DALI_TEST_EQUALS(normal.Dot(tangent), 0.f, Math::MACHINE_EPSILON_100, TEST_LOCATION);
+  DALI_TEST_EQUALS(tangent.Length(), 1.f, Math::MACHINE_EPSILON_100, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliVertexKernelsBlendShapes(void)
+{
+  std::mt19937 generator(3u);
+  for(uint32_t count : NUMBER_OF_VERTICES)
+  {
+    const auto vectors = CreateVectors(generator, count);
+    DALI_TEST_EQUALS(GetMaxLengthSquared(vectors.data(), count), Scalar::GetMaxLengthSquared(vectors.data(), count), TEST_LOCATION);
+
+    auto expected = vectors;
+    auto result   = vectors;
+    Scalar::ScaleAndOffset(expected.data()->AsFloat(), count * 3u, 0.5f, 0.5f);
+    ScaleAndOffset(result.data()->AsFloat(), count * 3u, 0.5f, 0.5f);
+    CheckVectors(expected, result, TEST_LOCATION);
+
+    Scalar::ScaleOffsetAndClamp(expected.data()->AsFloat(), count * 3u, 0.1f, 0.5f);
+    ScaleOffsetAndClamp(result.data()->AsFloat(), count * 3u, 0.1f, 0.5f);
+    CheckVectors(expected, result, TEST_LOCATION);
+  }
+
+  const float values[] = {-10.f, 0.f, 10.f};
+  float       clamped[]{values[0], values[1], values[2]};
+  ScaleOffsetAndClamp(clamped, 3u, 0.1f, 0.5f);
+  DALI_TEST_EQUALS(clamped[0], 0.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(clamped[1], 0.5f, TEST_LOCATION);
+  DALI_TEST_EQUALS(clamped[2], 1.f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliVertexKernelsParallelFor(void)
+{
+  for(uint32_t count : {0u, 10u, 100003u})
+  {
+    std::vector<uint32_t> calls(count, 0u);
+    std::atomic<uint32_t> numberOfChunks{0u};
+    std::atomic<bool>     aligned{true};
+    ParallelFor(count, 1000u, [&](uint32_t begin, uint32_t end) {
+      // All the ranges but the last start and end at a multiple of 4.
+      if(begin % 4u != 0u || (end != count && end % 4u != 0u))
+      {
+        aligned = false;
+      }
+      for(uint32_t i = begin; i < end; ++i)
+      {
+        ++calls[i];
+      }
+      ++numberOfChunks;
+    });
+
+    DALI_TEST_CHECK(std::all_of(calls.begin(), calls.end(), [](uint32_t call) { return call == 1u; }));
+    DALI_TEST_CHECK(numberOfChunks > 0u);
+    DALI_TEST_CHECK(aligned);
+  }
+
+  // The exception of a job is thrown to the caller.
+  std::vector<std::function<void()>> jobs{[]() {}, []() { throw std::runtime_error("job failed"); }};
+  bool                               thrown = false;
+  try
+  {
+    RunInParallel(jobs);
+  }
+  catch(const std::runtime_error&)
+  {
+    thrown = true;
+  }
+  DALI_TEST_CHECK(thrown);
+
+  // A ParallelFor() in a job runs on the thread of the job.
+  std::atomic<bool> sameThread{true};
+  jobs.assign(4u, [&sameThread]() {
+    const auto threadId = std::this_thread::get_id();
+    ParallelFor(100003u, 1000u, [&sameThread, threadId](uint32_t, uint32_t) {
+      if(std::this_thread::get_id() != threadId)
+      {
+        sameThread = false;
+      }
+    });
+  });
+  RunInParallel(jobs);
+  DALI_TEST_CHECK(sameThread);
+
+  END_TEST;
+}
+
+int UtcDaliVertexKernelsParallelMesh(void)
+{
+  std::mt19937 generator(4u);
+
+  const uint32_t count   = PARALLEL_NUMBER_OF_VERTICES;
+  const auto     vectors = CreateVectors(generator, count);
+
+  // Generates the normals and tangents of a mesh without texture coordinates, and packs its blend shape.
+  std::vector<Vector3> scalarNormals = vectors;
+  std::vector<Vector3> scalarTangents(count);
+  Scalar::NormalizeVectors(scalarNormals.data(), count);
+  Scalar::CalculateTangents(scalarNormals.data(), scalarTangents.data(), count);
+  const float scalarMax = Scalar::GetMaxLengthSquared(vectors.data(), count);
+  Scalar::ScaleAndOffset(scalarTangents.data()->AsFloat(), count * 3u, 0.5f, 0.5f);
+
+  std::vector<Vector3> normals = vectors;
+  std::vector<Vector3> tangents(count);
+  ParallelFor(count, 16384u, [&](uint32_t begin, uint32_t end) {
+    NormalizeVectors(normals.data() + begin, end - begin);
+    CalculateTangents(normals.data() + begin, tangents.data() + begin, end - begin);
+  });
+  const float vectorizedMax = GetMaxLengthSquared(vectors.data(), count);
+  ScaleAndOffset(tangents.data()->AsFloat(), count * 3u, 0.5f, 0.5f);
+
+  DALI_TEST_EQUALS(scalarMax, vectorizedMax, TEST_LOCATION);
+  CheckVectors(scalarNormals, normals, TEST_LOCATION);
+  CheckVectors(scalarTangents, tangents, TEST_LOCATION);
+
+  END_TEST;
+}
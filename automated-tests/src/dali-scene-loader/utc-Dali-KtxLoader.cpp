@@ -22,7 +22,9 @@
 #include <dali-test-suite-utils.h>
 #include <string_view>
 
+#include <cstring>
 #include <fstream>
+#include <iterator>
 
 using namespace Dali;
 using namespace Dali::SceneLoader;
@@ -163,3 +165,82 @@ int UtcDaliKtxLoaderCubeDataCreateTexture3(void)
   END_TEST;
 
 }
+
+int UtcDaliKtxLoaderKtx2CubeMap(void)
+{
+  CubeData cubeData;
+  auto path = TEST_RESOURCE_DIR "/RGBA8888.ktx2";
+  DALI_TEST_CHECK(LoadCubeMapData(path, cubeData));
+
+  DALI_TEST_EQUAL(6u, cubeData.data.size());
+  for (auto& face: cubeData.data)
+  {
+    DALI_TEST_EQUAL(3u, face.size());
+
+    uint32_t size = 4;
+    for (auto& mipData: face)
+    {
+      DALI_TEST_EQUAL(size, mipData.GetWidth());
+      DALI_TEST_EQUAL(size, mipData.GetHeight());
+      DALI_TEST_EQUAL(Pixel::Format::RGBA8888, mipData.GetPixelFormat());
+      size /= 2;
+    }
+  }
+
+  TestApplication app;
+  auto texture = cubeData.CreateTexture();
+
+  DALI_TEST_CHECK(texture);
+  DALI_TEST_EQUAL(4u, texture.GetWidth());
+
+  END_TEST;
+}
+
+int UtcDaliKtxLoaderKtx2Texture2D(void)
+{
+  CubeData cubeData;
+  auto path = TEST_RESOURCE_DIR "/RGBA_ASTC_4x4.ktx2";
+  DALI_TEST_CHECK(LoadCubeMapData(path, cubeData));
+
+  DALI_TEST_EQUAL(1u, cubeData.data.size());
+  DALI_TEST_EQUAL(2u, cubeData.data[0].size());
+  DALI_TEST_EQUAL(8u, cubeData.data[0][0].GetWidth());
+  DALI_TEST_EQUAL(4u, cubeData.data[0][1].GetWidth());
+  DALI_TEST_EQUAL(Pixel::COMPRESSED_RGBA_ASTC_4x4_KHR, cubeData.data[0][1].GetPixelFormat());
+
+  END_TEST;
+}
+
+int UtcDaliKtxLoaderKtx2FailSupercompressed(void)
+{
+  CubeData data;
+  DALI_TEST_CHECK(!LoadCubeMapData(TEST_RESOURCE_DIR "/zstd.ktx2", data)); // no zstd decompressor
+  END_TEST;
+}
+
+int UtcDaliKtxLoaderKtx2FailTruncated(void)
+{
+  CubeData data;
+  DALI_TEST_CHECK(!LoadCubeMapData(TEST_RESOURCE_DIR "/truncated.ktx2", data));
+  END_TEST;
+}
+
+int UtcDaliKtxLoaderKtx2FailTooManyLevels(void)
+{
+  // The 4x4 cube map has 3 levels; claim a level for each bit of the dimensions and more.
+  std::ifstream input(TEST_RESOURCE_DIR "/RGBA8888.ktx2", std::ios::binary);
+  std::string   contents((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+  DALI_TEST_CHECK(contents.size() > 44u);
+
+  const std::string path = "/tmp/utc-Dali-KtxLoader-TooManyLevels.ktx2";
+  for(uint32_t levelCount : {4u, 32u, 40u})
+  {
+    memcpy(&contents[40], &levelCount, sizeof(levelCount)); // Ktx2FileHeader::levelCount
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << contents;
+
+    CubeData data;
+    DALI_TEST_CHECK(!LoadCubeMapData(path, data));
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "dali-scene-loader/public-api/mesh-cache.h"
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+using namespace Dali::SceneLoader;
+
+namespace
+{
+const std::string PATH = "/tmp/";
+const std::string URI  = "utc-Dali-MeshCache.bin";
+
+void WriteBufferFile(const std::vector<Vector3>& vertices)
+{
+  std::ofstream file(PATH + URI, std::ios::binary);
+  file.write(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(Vector3));
+}
+
+MeshDefinition CreateMeshDefinition(uint32_t numberOfVertices)
+{
+  MeshDefinition meshDefinition;
+  meshDefinition.mUri       = URI;
+  meshDefinition.mPositions = MeshDefinition::Accessor{MeshDefinition::Blob{0u, numberOfVertices * uint32_t(sizeof(Vector3))}, MeshDefinition::SparseBlob{}};
+  meshDefinition.RequestNormals();
+  meshDefinition.RequestTangents();
+  return meshDefinition;
+}
+
+} // namespace
+
+int UtcDaliMeshCacheLoadRaw(void)
+{
+  std::vector<Vector3> vertices = {Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)};
+  WriteBufferFile(vertices);
+
+  auto      meshDefinition = CreateMeshDefinition(vertices.size());
+  MeshCache cache(PATH);
+
+  const uint64_t key = MeshCache::GetKey(meshDefinition, PATH + URI);
+  DALI_TEST_CHECK(key != 0u);
+  remove(cache.GetPath(key).c_str());
+
+  // The first load stores the raw data, with the generated normals and tangents.
+  BufferCache buffers;
+  auto        raw = meshDefinition.LoadRaw(PATH, buffers, &cache);
+  DALI_TEST_CHECK(raw.mAttribs.size() == 3u);
+
+  MeshDefinition::RawData cachedRaw;
+  DALI_TEST_CHECK(cache.Read(key, cachedRaw));
+  DALI_TEST_CHECK(cachedRaw.mAttribs.size() == raw.mAttribs.size());
+  for(uint32_t i = 0u; i < raw.mAttribs.size(); ++i)
+  {
+    DALI_TEST_EQUALS(cachedRaw.mAttribs[i].mName, raw.mAttribs[i].mName, TEST_LOCATION);
+    DALI_TEST_CHECK(cachedRaw.mAttribs[i].mType == raw.mAttribs[i].mType);
+    DALI_TEST_EQUALS(cachedRaw.mAttribs[i].mNumElements, raw.mAttribs[i].mNumElements, TEST_LOCATION);
+    DALI_TEST_CHECK(cachedRaw.mAttribs[i].mData == raw.mAttribs[i].mData);
+  }
+
+  // The next loads read the raw data from the cache.
+  cachedRaw.mAttribs.resize(1u);
+  DALI_TEST_CHECK(cache.Write(key, cachedRaw, nullptr, 0u, 0u, Pixel::INVALID));
+
+  raw = meshDefinition.LoadRaw(PATH, buffers, &cache);
+  DALI_TEST_CHECK(raw.mAttribs.size() == 1u);
+
+  // Without a cache, the mesh is loaded from its buffer file.
+  raw = meshDefinition.LoadRaw(PATH, buffers);
+  DALI_TEST_CHECK(raw.mAttribs.size() == 3u);
+
+  remove(cache.GetPath(key).c_str());
+  END_TEST;
+}
+
+int UtcDaliMeshCacheKey(void)
+{
+  std::vector<Vector3> vertices = {Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)};
+  WriteBufferFile(vertices);
+
+  auto           meshDefinition = CreateMeshDefinition(vertices.size());
+  const uint64_t key            = MeshCache::GetKey(meshDefinition, PATH + URI);
+  DALI_TEST_EQUALS(MeshCache::GetKey(meshDefinition, PATH + URI), key, TEST_LOCATION);
+
+  // The key depends on the definition of the mesh...
+  meshDefinition.mFlags = MeshDefinition::FLIP_UVS_VERTICAL;
+  DALI_TEST_CHECK(MeshCache::GetKey(meshDefinition, PATH + URI) != key);
+  meshDefinition.mFlags = 0u;
+
+  meshDefinition.mPositions.mBlob.mMin = {0.5f};
+  DALI_TEST_CHECK(MeshCache::GetKey(meshDefinition, PATH + URI) != key);
+  meshDefinition.mPositions.mBlob.mMin.clear();
+  DALI_TEST_EQUALS(MeshCache::GetKey(meshDefinition, PATH + URI), key, TEST_LOCATION);
+
+  // ...and on its buffer file.
+  vertices.push_back(Vector3::ONE);
+  WriteBufferFile(vertices);
+  DALI_TEST_CHECK(MeshCache::GetKey(meshDefinition, PATH + URI) != key);
+
+  DALI_TEST_EQUALS(MeshCache::GetKey(meshDefinition, PATH + "non-existent.bin"), uint64_t(0u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliMeshCacheBlendShapes(void)
+{
+  TestApplication app;
+
+  MeshCache      cache(PATH.substr(0u, PATH.size() - 1u)); // without the trailing slash
+  const uint64_t key = 0x1234u;
+  DALI_TEST_EQUALS(cache.GetPath(key), PATH + "0000000000001234.mesh", TEST_LOCATION);
+
+  MeshDefinition::RawData raw;
+  raw.mIndices                = {0u, 1u, 2u};
+  raw.mBlendShapeBufferOffset = 3u;
+  raw.mBlendShapeUnnormalizeFactor.PushBack(2.0f);
+
+  const float pixels[] = {0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f};
+  DALI_TEST_CHECK(cache.Write(key, raw, reinterpret_cast<const uint8_t*>(pixels), 2u, 1u, Pixel::RGB32F));
+
+  MeshDefinition::RawData cachedRaw;
+  DALI_TEST_CHECK(cache.Read(key, cachedRaw));
+  DALI_TEST_CHECK(cachedRaw.mIndices == raw.mIndices);
+  DALI_TEST_EQUALS(cachedRaw.mBlendShapeBufferOffset, 3u, TEST_LOCATION);
+  DALI_TEST_CHECK(cachedRaw.mBlendShapeUnnormalizeFactor.Count() == 1u);
+  DALI_TEST_EQUALS(cachedRaw.mBlendShapeUnnormalizeFactor[0], 2.0f, TEST_LOCATION);
+  DALI_TEST_CHECK(cachedRaw.mBlendShapeData);
+  DALI_TEST_EQUALS(cachedRaw.mBlendShapeData.GetWidth(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(cachedRaw.mBlendShapeData.GetHeight(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(cachedRaw.mBlendShapeData.GetPixelFormat(), Pixel::RGB32F, TEST_LOCATION);
+
+  // The entry of another key isn't read.
+  DALI_TEST_CHECK(!cache.Read(key + 1u, cachedRaw));
+
+  // Neither is a truncated file.
+  DALI_TEST_EQUALS(truncate(cache.GetPath(key).c_str(), 52), 0, TEST_LOCATION);
+  cachedRaw = MeshDefinition::RawData();
+  DALI_TEST_CHECK(!cache.Read(key, cachedRaw));
+  DALI_TEST_CHECK(cachedRaw.mIndices.empty());
+
+  remove(cache.GetPath(key).c_str());
+  END_TEST;
+}
+
+int UtcDaliMeshCacheTrim(void)
+{
+  TestApplication app;
+
+  const std::string directory = PATH + "utc-Dali-MeshCache-Trim/";
+  mkdir(directory.c_str(), 0755);
+
+  MeshDefinition::RawData raw;
+  raw.mIndices = {0u, 1u, 2u};
+
+  // Find the size of one cache file.
+  uint64_t fileSize;
+  {
+    MeshCache cache(directory);
+    DALI_TEST_CHECK(cache.Write(1u, raw, nullptr, 0u, 0u, Pixel::INVALID));
+
+    struct stat status;
+    DALI_TEST_EQUALS(stat(cache.GetPath(1u).c_str(), &status), 0, TEST_LOCATION);
+    fileSize = status.st_size;
+  }
+
+  // The cache only has room for two files.
+  MeshCache cache(directory, fileSize * 2u);
+  DALI_TEST_CHECK(cache.Write(2u, raw, nullptr, 0u, 0u, Pixel::INVALID));
+
+  // Mark the file of key 2 as older than that of key 1, then use the file of key 1.
+  struct utimbuf times = {1000, 1000};
+  DALI_TEST_EQUALS(utime(cache.GetPath(1u).c_str(), &times), 0, TEST_LOCATION);
+  times = {2000, 2000};
+  DALI_TEST_EQUALS(utime(cache.GetPath(2u).c_str(), &times), 0, TEST_LOCATION);
+
+  MeshDefinition::RawData cachedRaw;
+  DALI_TEST_CHECK(cache.Read(1u, cachedRaw));
+
+  // Writing a third file removes the least recently used one.
+  DALI_TEST_CHECK(cache.Write(3u, raw, nullptr, 0u, 0u, Pixel::INVALID));
+  DALI_TEST_CHECK(access(cache.GetPath(1u).c_str(), F_OK) == 0);
+  DALI_TEST_CHECK(access(cache.GetPath(2u).c_str(), F_OK) != 0);
+  DALI_TEST_CHECK(access(cache.GetPath(3u).c_str(), F_OK) == 0);
+
+  // Leave the temporary files of a write that has been going on for too long, and of one in progress.
+  const std::string staleTempPath  = cache.GetPath(5u) + '.' + std::to_string(getpid()) + ".1";
+  const std::string activeTempPath = cache.GetPath(6u) + '.' + std::to_string(getpid()) + ".1";
+  std::ofstream(staleTempPath) << "stale";
+  std::ofstream(activeTempPath) << "active";
+  times = {1000, 1000};
+  DALI_TEST_EQUALS(utime(staleTempPath.c_str(), &times), 0, TEST_LOCATION);
+
+  // The file just written is kept, even if it doesn't fit.
+  MeshCache smallCache(directory, 1u);
+  DALI_TEST_CHECK(smallCache.Write(4u, raw, nullptr, 0u, 0u, Pixel::INVALID));
+  DALI_TEST_CHECK(access(cache.GetPath(1u).c_str(), F_OK) != 0);
+  DALI_TEST_CHECK(access(cache.GetPath(3u).c_str(), F_OK) != 0);
+  DALI_TEST_CHECK(access(cache.GetPath(4u).c_str(), F_OK) == 0);
+
+  // Only the stale temporary file is removed.
+  DALI_TEST_CHECK(access(staleTempPath.c_str(), F_OK) != 0);
+  DALI_TEST_CHECK(access(activeTempPath.c_str(), F_OK) == 0);
+  remove(activeTempPath.c_str());
+
+  remove(cache.GetPath(4u).c_str());
+  rmdir(directory.c_str());
+  END_TEST;
+}
@@ -15,6 +15,7 @@
  *
  */
 
+#include <fstream>
 #include <vector>
 
 #include "dali-scene-loader/public-api/mesh-definition.h"
@@ -99,3 +100,52 @@ int UtcDaliMeshDefinitionBlobApplyMinMaxBothEmpty(void)
   END_TEST;
 }
 
+
+int UtcDaliMeshDefinitionLoadRawInterleavedSharedBuffer(void)
+{
+  const std::string path = "/tmp/";
+  const std::string uri  = "utc-Dali-MeshDefinition-interleaved.bin";
+
+  // Three vertices of interleaved positions and normals.
+  std::vector<Vector3> vertices = {
+    Vector3(0.0f, 1.0f, 2.0f), Vector3::ZAXIS,
+    Vector3(3.0f, 4.0f, 5.0f), Vector3::ZAXIS,
+    Vector3(6.0f, 7.0f, 8.0f), Vector3::ZAXIS,
+  };
+  {
+    std::ofstream file(path + uri, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(Vector3));
+  }
+
+  const uint32_t stride = sizeof(Vector3) * 2u;
+  MeshDefinition meshDefinition;
+  meshDefinition.mUri       = uri;
+  meshDefinition.mPositions = MeshDefinition::Accessor{MeshDefinition::Blob{0u, stride * 3u, stride, sizeof(Vector3)}, MeshDefinition::SparseBlob{}};
+  meshDefinition.mNormals   = MeshDefinition::Accessor{MeshDefinition::Blob{sizeof(Vector3), stride * 3u, stride, sizeof(Vector3)}, MeshDefinition::SparseBlob{}};
+
+  BufferCache buffers;
+  auto        raw = meshDefinition.LoadRaw(path, buffers);
+  DALI_TEST_CHECK(raw.mAttribs.size() == 2u);
+
+  auto positions = reinterpret_cast<const Vector3*>(raw.mAttribs[0].mData.data());
+  DALI_TEST_EQUALS(raw.mAttribs[0].mNumElements, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(positions[0], vertices[0], TEST_LOCATION);
+  DALI_TEST_EQUALS(positions[1], vertices[2], TEST_LOCATION);
+  DALI_TEST_EQUALS(positions[2], vertices[4], TEST_LOCATION);
+
+  auto normals = reinterpret_cast<const Vector3*>(raw.mAttribs[1].mData.data());
+  DALI_TEST_EQUALS(raw.mAttribs[1].mNumElements, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(normals[2], Vector3::ZAXIS, TEST_LOCATION);
+
+  // The buffer file is loaded once, and shared by the meshes that reference it.
+  auto buffer = buffers.Get(path + uri);
+  DALI_TEST_CHECK(buffer);
+  DALI_TEST_CHECK(buffer == buffers.Get(path + uri));
+  DALI_TEST_EQUALS(buffer->GetSize(), vertices.size() * sizeof(Vector3), TEST_LOCATION);
+
+  // An accessor out of the bounds of the buffer fails.
+  meshDefinition.mNormals.mBlob.mOffset = stride;
+  DALI_TEST_ASSERTION(meshDefinition.LoadRaw(path, buffers), "Failed to read normals");
+
+  END_TEST;
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/controls/scrollable/item-view/item-extent-index.h>
+
+using namespace Dali;
+using namespace Toolkit;
+using namespace Toolkit::Internal;
+
+namespace
+{
+const float DEFAULT_EXTENT = 10.0f;
+
+bool IsNear(double value1, double value2)
+{
+  return std::abs(value1 - value2) < 0.001;
+}
+
+// The extents of the items, set on both an index and a plain array.
+struct Extents
+{
+  explicit Extents(float defaultExtent)
+  : mIndex(defaultExtent),
+    mDefaultExtent(defaultExtent)
+  {
+  }
+
+  void Set(unsigned int itemId, float extent)
+  {
+    if(mExtents.size() <= itemId)
+    {
+      mExtents.resize(itemId + 1u, -1.0f);
+    }
+    mExtents[itemId] = extent;
+    mIndex.SetExtent(itemId, extent);
+  }
+
+  float GetExtent(unsigned int itemId) const
+  {
+    return itemId < mExtents.size() && mExtents[itemId] >= 0.0f ? mExtents[itemId] : mDefaultExtent;
+  }
+
+  double GetOffset(unsigned int itemId) const
+  {
+    double offset = 0.0;
+    for(unsigned int i = 0u; i < itemId; ++i)
+    {
+      offset += GetExtent(i);
+    }
+    return offset;
+  }
+
+  ItemExtentIndex    mIndex;
+  std::vector<float> mExtents;
+  float              mDefaultExtent;
+};
+
+bool CheckOffsets(Extents& extents, unsigned int numberOfItems)
+{
+  bool result = true;
+  for(unsigned int itemId = 0u; itemId < numberOfItems; ++itemId)
+  {
+    const double offset = extents.GetOffset(itemId);
+    const float  extent = extents.GetExtent(itemId);
+
+    result &= IsNear(extents.mIndex.GetOffset(itemId), offset);
+    result &= IsNear(extents.mIndex.GetExtent(itemId), extent);
+    if(extent > 0.0f)
+    {
+      // The items are found from their start and their middle.
+      result &= extents.mIndex.FindItem(offset) == itemId;
+      result &= extents.mIndex.FindItem(offset + extent * 0.5) == itemId;
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+int UtcDaliItemExtentIndexDefaultExtent(void)
+{
+  ToolkitTestApplication application;
+
+  ItemExtentIndex index(DEFAULT_EXTENT);
+  DALI_TEST_EQUALS(index.GetDefaultExtent(), DEFAULT_EXTENT, TEST_LOCATION);
+  DALI_TEST_EQUALS(index.GetExtent(5u), DEFAULT_EXTENT, TEST_LOCATION);
+  DALI_TEST_EQUALS(index.GetOffset(5u), 50.0, TEST_LOCATION);
+  DALI_TEST_EQUALS(index.FindItem(55.0), 5u, TEST_LOCATION);
+  DALI_TEST_EQUALS(index.FindItem(-5.0), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliItemExtentIndexSetExtent(void)
+{
+  ToolkitTestApplication application;
+
+  Extents extents(DEFAULT_EXTENT);
+  for(unsigned int itemId : {3u, 0u, 7u, 1u, 20u})
+  {
+    extents.Set(itemId, 5.0f + itemId);
+  }
+  DALI_TEST_CHECK(CheckOffsets(extents, 30u));
+
+  // Items of no extent are skipped when finding an item.
+  extents.Set(4u, 0.0f);
+  extents.Set(5u, 0.0f);
+  DALI_TEST_CHECK(CheckOffsets(extents, 30u));
+  DALI_TEST_EQUALS(extents.mIndex.FindItem(extents.GetOffset(4u)), 6u, TEST_LOCATION);
+
+  // Beyond the items set, the items have the default extent.
+  DALI_TEST_EQUALS(extents.mIndex.GetOffset(31u), extents.GetOffset(31u), TEST_LOCATION);
+  DALI_TEST_EQUALS(extents.mIndex.FindItem(extents.GetOffset(40u) + 1.0), 40u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliItemExtentIndexSetDefaultExtent(void)
+{
+  ToolkitTestApplication application;
+
+  Extents extents(DEFAULT_EXTENT);
+  for(unsigned int itemId = 0u; itemId < 50u; itemId += 3u)
+  {
+    extents.Set(itemId, 1.0f + itemId % 7u);
+  }
+
+  // The items whose extent isn't set take the new default extent.
+  extents.mIndex.SetDefaultExtent(20.0f);
+  extents.mDefaultExtent = 20.0f;
+  DALI_TEST_CHECK(CheckOffsets(extents, 60u));
+
+  extents.mIndex.Clear();
+  extents.mExtents.clear();
+  DALI_TEST_CHECK(CheckOffsets(extents, 60u));
+
+  END_TEST;
+}
+
+int UtcDaliItemExtentIndexMixedUpdates(void)
+{
+  ToolkitTestApplication application;
+
+  // Set, grow, shrink and zero the extents of items in a scattered order, within and beyond
+  // the items already set, checking all the offsets against their sums after each round.
+  Extents extents(DEFAULT_EXTENT);
+  for(unsigned int round = 0u; round < 8u; ++round)
+  {
+    for(unsigned int i = 0u; i < 40u; ++i)
+    {
+      const unsigned int itemId = (i * 37u + round * 11u) % (50u + round * 20u);
+      extents.Set(itemId, static_cast<float>((i + round) % 5u) * 7.5f);
+    }
+    DALI_TEST_CHECK(CheckOffsets(extents, 250u));
+
+    if(round == 4u)
+    {
+      extents.mIndex.SetDefaultExtent(3.0f);
+      extents.mDefaultExtent = 3.0f;
+      DALI_TEST_CHECK(CheckOffsets(extents, 250u));
+    }
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+#include <dali-toolkit/internal/builder/json-parser-impl.h>
+#include <dali-toolkit/internal/builder/tree-node-manipulator.h>
+#include <iomanip>
+#include <sstream>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+void utc_json_parser_internal_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_json_parser_internal_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const int NUMBER_OF_KEYS = 40; ///< More than the children from which a node is indexed
+
+/*
+ * {"wide":{"key00":0, ... "key39":39}, "other":1}
+ */
+std::string CreateWideObject()
+{
+  std::ostringstream stream;
+  stream << "{\"wide\":{";
+  for(int i = 0; i < NUMBER_OF_KEYS; ++i)
+  {
+    stream << (i > 0 ? "," : "") << "\"key" << std::setw(2) << std::setfill('0') << i << "\":" << i;
+  }
+  stream << "},\"other\":1}";
+  return stream.str();
+}
+
+} // namespace
+
+int UtcDaliJsonParserPackWideObject(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliJsonParserPackWideObject - Pack copies a tree with indexed children into a single block");
+
+  JsonParser parser = JsonParser::New();
+  DALI_TEST_CHECK(parser.Parse(CreateWideObject()));
+
+  parser.Pack();
+  parser.Pack();
+
+  const TreeNode* root = parser.GetRoot();
+  DALI_TEST_CHECK(root);
+
+  const TreeNode* wide = root->GetChild("wide");
+  DALI_TEST_CHECK(wide);
+  DALI_TEST_EQUALS(wide->Size(), static_cast<size_t>(NUMBER_OF_KEYS), TEST_LOCATION);
+
+  const TreeNode* child = wide->GetChild("key25");
+  DALI_TEST_CHECK(child);
+  DALI_TEST_EQUALS(child->GetInteger(), 25, TEST_LOCATION);
+
+  // The root, "wide", "other" and the keys; the names with their terminators.
+  const std::size_t numberOfNodes = 3u + NUMBER_OF_KEYS;
+  const std::size_t numberOfChars = sizeof("wide") + sizeof("other") + NUMBER_OF_KEYS * sizeof("key00");
+  const std::size_t indexesSize   = Internal::TreeNodeManipulator::GetChildIndexesSize(*root);
+  DALI_TEST_CHECK(indexesSize > 0u);
+
+  // Only the nodes, their strings and the index of "wide", without a block for what overflows.
+  const std::size_t packedSize = numberOfNodes * (sizeof(TreeNode) + alignof(TreeNode)) + numberOfChars + indexesSize;
+  DALI_TEST_EQUALS(GetImplementation(parser).GetMemorySize(), packedSize, TEST_LOCATION);
+
+  // Merging after the pack allocates at most a block of the default size.
+  DALI_TEST_CHECK(parser.Parse("{\"more\":2}"));
+  DALI_TEST_CHECK(parser.GetRoot()->GetChild("more"));
+  DALI_TEST_CHECK(GetImplementation(parser).GetMemorySize() <= packedSize + Internal::TreeNodeArena::DEFAULT_BLOCK_SIZE + sizeof("{\"more\":2}"));
+
+  END_TEST;
+}
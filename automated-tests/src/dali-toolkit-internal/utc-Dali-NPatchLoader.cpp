@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit-test-suite-utils.h>
+
+#include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
+#include <dali-toolkit/internal/visuals/npatch-loader.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit::Internal;
+
+namespace
+{
+const char* TEST_NPATCH_FILE_NAME       = TEST_RESOURCE_DIR "/heartsframe.9.png";
+const char* TEST_OTHER_NPATCH_FILE_NAME = TEST_RESOURCE_DIR "/button-up.9.png";
+
+// Synchronously load an N patch.
+std::size_t Load(NPatchLoader& loader, TextureManager& textureManager, const char* url, const Rect<int>& border = Rect<int>())
+{
+  bool preMultiplyOnLoad = true;
+  return loader.Load(textureManager, nullptr, VisualUrl(url), border, preMultiplyOnLoad, true);
+}
+
+bool IsCached(NPatchLoader& loader, std::size_t id)
+{
+  const NPatchData* data = nullptr;
+  return loader.GetNPatchData(id, data);
+}
+
+} // namespace
+
+int UtcDaliNPatchLoaderLoad(void)
+{
+  ToolkitTestApplication application;
+
+  TextureManager textureManager;
+  NPatchLoader   loader;
+
+  // The same N patch is shared, while it's referenced.
+  std::size_t id1 = Load(loader, textureManager, TEST_NPATCH_FILE_NAME);
+  std::size_t id2 = Load(loader, textureManager, TEST_NPATCH_FILE_NAME);
+  DALI_TEST_CHECK(id1 == id2);
+
+  const NPatchData* data = nullptr;
+  DALI_TEST_CHECK(loader.GetNPatchData(id1, data));
+  DALI_TEST_CHECK(data->GetLoadingState() == NPatchData::LoadingState::LOAD_COMPLETE);
+
+  // Another border has its own data, sharing the texture.
+  std::size_t id3 = Load(loader, textureManager, TEST_NPATCH_FILE_NAME, Rect<int>(1, 1, 1, 1));
+  DALI_TEST_CHECK(id3 != id1);
+
+  const NPatchData* borderData = nullptr;
+  DALI_TEST_CHECK(loader.GetNPatchData(id3, borderData));
+  DALI_TEST_CHECK(borderData->GetTextures() == data->GetTextures());
+
+  // Another url has its own data.
+  std::size_t id4 = Load(loader, textureManager, TEST_OTHER_NPATCH_FILE_NAME);
+  DALI_TEST_CHECK(id4 != id1 && id4 != id3);
+
+  // Without budget, the data are removed with their last reference.
+  DALI_TEST_EQUALS(loader.GetUnusedCacheBudget(), static_cast<std::size_t>(0u), TEST_LOCATION);
+  loader.Remove(id1, nullptr);
+  DALI_TEST_CHECK(IsCached(loader, id1));
+  loader.Remove(id2, nullptr);
+  DALI_TEST_CHECK(!IsCached(loader, id1));
+  DALI_TEST_CHECK(IsCached(loader, id3));
+
+  loader.Remove(id3, nullptr);
+  loader.Remove(id4, nullptr);
+  DALI_TEST_CHECK(!IsCached(loader, id3));
+  DALI_TEST_CHECK(!IsCached(loader, id4));
+
+  END_TEST;
+}
+
+int UtcDaliNPatchLoaderUnusedCache(void)
+{
+  ToolkitTestApplication application;
+
+  TextureManager textureManager;
+  NPatchLoader   loader;
+  loader.SetUnusedCacheBudget(16u * 1024u * 1024u);
+  DALI_TEST_EQUALS(loader.GetUnusedCacheBudget(), static_cast<std::size_t>(16u * 1024u * 1024u), TEST_LOCATION);
+
+  std::size_t id1 = Load(loader, textureManager, TEST_NPATCH_FILE_NAME);
+  std::size_t id2 = Load(loader, textureManager, TEST_OTHER_NPATCH_FILE_NAME);
+
+  // The data without reference are kept, and found again.
+  loader.Remove(id1, nullptr);
+  loader.Remove(id2, nullptr);
+  DALI_TEST_CHECK(IsCached(loader, id1));
+  DALI_TEST_CHECK(IsCached(loader, id2));
+
+  DALI_TEST_CHECK(Load(loader, textureManager, TEST_NPATCH_FILE_NAME) == id1);
+
+  // The unused data are removed when they're over the budget, and the referenced ones are kept.
+  loader.SetUnusedCacheBudget(0u);
+  DALI_TEST_CHECK(IsCached(loader, id1));
+  DALI_TEST_CHECK(!IsCached(loader, id2));
+
+  // The least recently used data are removed first.
+  loader.SetUnusedCacheBudget(16u * 1024u * 1024u);
+  id2 = Load(loader, textureManager, TEST_OTHER_NPATCH_FILE_NAME);
+  loader.Remove(id2, nullptr);
+  loader.Remove(id1, nullptr);
+
+  const NPatchData* data = nullptr;
+  DALI_TEST_CHECK(loader.GetNPatchData(id1, data));
+  loader.SetUnusedCacheBudget(data->GetCroppedWidth() * data->GetCroppedHeight() * 4u);
+  DALI_TEST_CHECK(IsCached(loader, id1));
+  DALI_TEST_CHECK(!IsCached(loader, id2));
+
+  END_TEST;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/controls/model3d-view/obj-loader.h>
+
+using namespace Dali;
+using namespace Toolkit;
+using namespace Toolkit::Internal;
+
+namespace
+{
+const char* TEST_OBJ_FILE_NAME = TEST_RESOURCE_DIR "/Cube.obj";
+const char* TEST_MTL_FILE_NAME = TEST_RESOURCE_DIR "/ToyRobot-Metal.mtl";
+
+// A grid of quads, each with its own point, normal and texture coordinate indices.
+const uint32_t GRID_SIZE = 64u;
+
+std::string LoadFile(const char* path)
+{
+  std::ifstream file(path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+bool LoadObject(ObjLoader& loader, std::string buffer)
+{
+  return loader.LoadObject(&buffer[0], buffer.size());
+}
+
+std::string CreateGrid(uint32_t size)
+{
+  std::string buffer = "# grid\n";
+  char        line[128];
+  for(uint32_t y = 0u; y <= size; ++y)
+  {
+    for(uint32_t x = 0u; x <= size; ++x)
+    {
+      snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn 0.0 0.0 1.0\n", float(x) / size, float(y) / size, 0.25f * ((x + y) % 4u), float(x) / size, float(y) / size);
+      buffer += line;
+    }
+  }
+
+  for(uint32_t y = 0u; y < size; ++y)
+  {
+    for(uint32_t x = 0u; x < size; ++x)
+    {
+      const uint32_t index = y * (size + 1u) + x + 1u;
+      snprintf(line, sizeof(line), "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u\n", index, index, index, index + 1u, index + 1u, index + 1u, index + size + 2u, index + size + 2u, index + size + 2u, index + size + 1u, index + size + 1u, index + size + 1u);
+      buffer += line;
+    }
+  }
+  return buffer;
+}
+
+} // namespace
+
+int UtcDaliObjLoaderLoadObject(void)
+{
+  ToolkitTestApplication application;
+
+  ObjLoader loader;
+  DALI_TEST_CHECK(LoadObject(loader, LoadFile(TEST_OBJ_FILE_NAME)));
+  DALI_TEST_CHECK(loader.IsSceneLoaded());
+  DALI_TEST_CHECK(loader.IsTexturePresent());
+
+  // The scene is centered and scaled to a unit size.
+  DALI_TEST_EQUALS(loader.GetSize(), Vector3::ONE, TEST_LOCATION);
+  DALI_TEST_EQUALS(loader.GetCenter(), Vector3::ZERO, TEST_LOCATION);
+
+  // The positions and normals, then the tangents and binormals; the texture coordinates need a diffuse map.
+  Geometry geometry = loader.CreateGeometry(ObjLoader::TEXTURE_COORDINATES | ObjLoader::TANGENTS | ObjLoader::BINORMALS, false);
+  DALI_TEST_CHECK(geometry);
+  DALI_TEST_CHECK(geometry.GetNumberOfVertexBuffers() == 2u);
+
+  END_TEST;
+}
+
+int UtcDaliObjLoaderLoadObjectFormats(void)
+{
+  ToolkitTestApplication application;
+
+  // Points only, with a quad, whitespace of all kinds and numbers in every notation.
+  {
+    ObjLoader loader;
+    DALI_TEST_CHECK(LoadObject(loader, "# points\nv 0 0 0\nv\t2.0e0 0 0\r\nv 0 +4. 0\nv -.5E1 0 -1\n\nf 1 2 3 4\n"));
+    DALI_TEST_CHECK(!loader.IsTexturePresent());
+    DALI_TEST_EQUALS(loader.GetSize(), Vector3(7.0f, 4.0f, 1.0f) / 7.0f, TEST_LOCATION);
+  }
+
+  // Points and normals.
+  {
+    ObjLoader loader;
+    DALI_TEST_CHECK(LoadObject(loader, "# normals\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvn 0 0 1\nf 1//1 2//1 3//1"));
+    DALI_TEST_CHECK(!loader.IsTexturePresent());
+    DALI_TEST_CHECK(loader.CreateGeometry(0, false));
+  }
+
+  // Points and texture coordinates.
+  {
+    ObjLoader loader;
+    DALI_TEST_CHECK(LoadObject(loader, "# textures\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nvt 1 0\nvt 0 1\nf 1/1 2/2 3/3\n"));
+    DALI_TEST_CHECK(loader.IsTexturePresent());
+    DALI_TEST_CHECK(loader.CreateGeometry(ObjLoader::TEXTURE_COORDINATES, false));
+  }
+
+  // Without faces, there is no scene.
+  {
+    ObjLoader loader;
+    DALI_TEST_CHECK(!LoadObject(loader, "# no faces\nv 0 0 0\nv 1 0 0\nv 0 1 0\n"));
+    DALI_TEST_CHECK(!loader.IsSceneLoaded());
+    DALI_TEST_CHECK(!LoadObject(loader, ""));
+  }
+
+  END_TEST;
+}
+
+int UtcDaliObjLoaderLoadMaterial(void)
+{
+  ToolkitTestApplication application;
+
+  ObjLoader   loader;
+  std::string buffer = LoadFile(TEST_MTL_FILE_NAME);
+  std::string diffuseTextureUrl, normalTextureUrl, glossTextureUrl;
+  loader.LoadMaterial(&buffer[0], buffer.size(), diffuseTextureUrl, normalTextureUrl, glossTextureUrl);
+
+  DALI_TEST_CHECK(loader.IsMaterialLoaded());
+  DALI_TEST_CHECK(loader.IsDiffuseMapPresent());
+  DALI_TEST_CHECK(loader.IsNormalMapPresent());
+  DALI_TEST_CHECK(loader.IsSpecularMapPresent());
+  DALI_TEST_EQUALS(diffuseTextureUrl, "tbcol.png", TEST_LOCATION);
+  DALI_TEST_EQUALS(normalTextureUrl, "tb-norm.png", TEST_LOCATION);
+  DALI_TEST_EQUALS(glossTextureUrl, "TB-gloss.png", TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliObjLoaderLoadGrid(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliObjLoaderLoadGrid");
+
+  ObjLoader loader;
+  DALI_TEST_CHECK(LoadObject(loader, CreateGrid(GRID_SIZE)));
+  DALI_TEST_CHECK(loader.IsTexturePresent());
+
+  // The grid spans [0, 1] in x and y, and [0, 0.75] in z, so it is only centered.
+  DALI_TEST_EQUALS(loader.GetSize(), Vector3(1.0f, 1.0f, 0.75f), 0.001f, TEST_LOCATION);
+
+  const uint32_t numberOfPoints = (GRID_SIZE + 1u) * (GRID_SIZE + 1u);
+
+  const auto& points = loader.GetPoints();
+  DALI_TEST_EQUALS(points.Count(), numberOfPoints, TEST_LOCATION);
+  for(uint32_t y = 0u; y <= GRID_SIZE; ++y)
+  {
+    for(uint32_t x = 0u; x <= GRID_SIZE; ++x)
+    {
+      const Vector3 expected(float(x) / GRID_SIZE - 0.5f, float(y) / GRID_SIZE - 0.5f, 0.25f * ((x + y) % 4u) - 0.375f);
+      DALI_TEST_EQUALS(points[y * (GRID_SIZE + 1u) + x], expected, 0.001f, TEST_LOCATION);
+    }
+  }
+
+  const auto& normals = loader.GetNormals();
+  DALI_TEST_EQUALS(normals.Count(), numberOfPoints, TEST_LOCATION);
+  for(const auto& normal : normals)
+  {
+    DALI_TEST_EQUALS(normal, Vector3::ZAXIS, TEST_LOCATION);
+  }
+
+  // Each quad is split into two triangles sharing its diagonal.
+  const auto& triangles = loader.GetTriangles();
+  DALI_TEST_EQUALS(triangles.Count(), GRID_SIZE * GRID_SIZE * 2u, TEST_LOCATION);
+  const int size = static_cast<int>(GRID_SIZE);
+  for(int quad = 0; quad < size * size; ++quad)
+  {
+    const int index          = quad / size * (size + 1) + quad % size;
+    const int expected[2][3] = {{index, index + 1, index + size + 2}, {index + size + 2, index + size + 1, index}};
+    for(int i = 0; i < 2; ++i)
+    {
+      const ObjLoader::TriIndex& triangle = triangles[quad * 2 + i];
+      for(int j = 0; j < 3; ++j)
+      {
+        DALI_TEST_EQUALS(triangle.pointIndex[j], expected[i][j], TEST_LOCATION);
+        DALI_TEST_EQUALS(triangle.normalIndex[j], expected[i][j], TEST_LOCATION);
+        DALI_TEST_EQUALS(triangle.textureIndex[j], expected[i][j], TEST_LOCATION);
+      }
+    }
+  }
+
+  END_TEST;
+}
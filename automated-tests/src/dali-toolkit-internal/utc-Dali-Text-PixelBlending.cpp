@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/text/rendering/pixel-blending.h>
+
+using namespace Dali;
+using namespace Toolkit;
+using namespace Text;
+
+namespace
+{
+// Some sizes which are not multiple of the vector sizes to check the pixels left over.
+const uint32_t NUMBER_OF_PIXELS[] = {0u, 1u, 3u, 4u, 5u, 15u, 16u, 17u, 33u, 67u};
+
+// A run of glyphs similar to the ones rendered by a TextLabel.
+const uint32_t GLYPH_WIDTH      = 24u;
+const uint32_t GLYPH_HEIGHT     = 32u;
+const uint32_t NUMBER_OF_GLYPHS = 400u;
+
+std::vector<uint32_t> CreateColors(std::mt19937& generator, uint32_t numberOfPixels)
+{
+  std::vector<uint32_t> colors(numberOfPixels);
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    uint32_t color = generator();
+
+    // Add transparent and opaque pixels as they are blended differently.
+    switch(index % 4u)
+    {
+      case 0u:
+      {
+        color &= 0x00FFFFFFu;
+        break;
+      }
+      case 1u:
+      {
+        color |= 0xFF000000u;
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+    colors[index] = color;
+  }
+  return colors;
+}
+
+std::vector<uint8_t> CreateGlyphAlphas(std::mt19937& generator, uint32_t numberOfBytes)
+{
+  std::vector<uint8_t> alphas(numberOfBytes);
+  for(uint32_t index = 0u; index < numberOfBytes; ++index)
+  {
+    // Glyphs have many transparent and opaque pixels.
+    const uint32_t value = generator() % 384u;
+    alphas[index]        = (value < 64u) ? 0u : ((value > 320u) ? 255u : static_cast<uint8_t>(value));
+  }
+  return alphas;
+}
+
+} // namespace
+
+int UtcDaliTextPixelBlendingMultiplyAndNormalizeColor(void)
+{
+  tet_infoline(" UtcDaliTextPixelBlendingMultiplyAndNormalizeColor");
+
+  DALI_TEST_EQUALS(static_cast<uint32_t>(MultiplyAndNormalizeColor(255u, 255u)), 255u, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(MultiplyAndNormalizeColor(0u, 255u)), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(MultiplyAndNormalizeColor(128u, 255u)), 128u, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(MultiplyAndNormalizeColor(255u, 128u)), 128u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTextPixelBlendingFillPixels(void)
+{
+  tet_infoline(" UtcDaliTextPixelBlendingFillPixels");
+
+  for(uint32_t numberOfPixels : NUMBER_OF_PIXELS)
+  {
+    std::vector<uint32_t> pixels(numberOfPixels + 1u, 0u);
+    FillPixels(pixels.data(), numberOfPixels, 0x80402010u);
+
+    for(uint32_t index = 0u; index < numberOfPixels; ++index)
+    {
+      DALI_TEST_EQUALS(pixels[index], 0x80402010u, TEST_LOCATION);
+    }
+
+    // The pixel after the run is not modified.
+    DALI_TEST_EQUALS(pixels[numberOfPixels], 0u, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTextPixelBlendingBlendGlyphColor(void)
+{
+  tet_infoline(" UtcDaliTextPixelBlendingBlendGlyphColor");
+
+  std::mt19937 generator(1u);
+
+  for(uint32_t glyphPixelSize : {1u, 4u})
+  {
+    for(uint32_t numberOfPixels : NUMBER_OF_PIXELS)
+    {
+      const std::vector<uint32_t> pixels      = CreateColors(generator, numberOfPixels);
+      const std::vector<uint8_t>  glyphAlphas = CreateGlyphAlphas(generator, numberOfPixels * glyphPixelSize);
+      const uint32_t              color       = generator();
+
+      std::vector<uint32_t> expected = pixels;
+      std::vector<uint32_t> blended  = pixels;
+      Scalar::BlendGlyphColor(expected.data(), glyphAlphas.data(), glyphPixelSize, numberOfPixels, color);
+      BlendGlyphColor(blended.data(), glyphAlphas.data(), glyphPixelSize, numberOfPixels, color);
+
+      DALI_TEST_CHECK(expected == blended);
+    }
+  }
+
+  // A transparent glyph's pixel doesn't modify the bitmap, an opaque one sets the color.
+  uint32_t      pixels[]      = {0x11223344u, 0x11223344u};
+  const uint8_t glyphAlphas[] = {0u, 255u};
+  BlendGlyphColor(pixels, glyphAlphas, 1u, 2u, 0xFF0000FFu);
+  DALI_TEST_EQUALS(pixels[0], 0x11223344u, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixels[1], 0xFF0000FFu, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTextPixelBlendingBlendGlyphAlpha(void)
+{
+  tet_infoline(" UtcDaliTextPixelBlendingBlendGlyphAlpha");
+
+  std::mt19937 generator(2u);
+
+  for(uint32_t glyphPixelSize : {1u, 4u})
+  {
+    for(uint32_t numberOfPixels : NUMBER_OF_PIXELS)
+    {
+      const std::vector<uint8_t> pixels      = CreateGlyphAlphas(generator, numberOfPixels);
+      const std::vector<uint8_t> glyphAlphas = CreateGlyphAlphas(generator, numberOfPixels * glyphPixelSize);
+
+      std::vector<uint8_t> expected = pixels;
+      std::vector<uint8_t> blended  = pixels;
+      Scalar::BlendGlyphAlpha(expected.data(), glyphAlphas.data(), glyphPixelSize, numberOfPixels);
+      BlendGlyphAlpha(blended.data(), glyphAlphas.data(), glyphPixelSize, numberOfPixels);
+
+      DALI_TEST_CHECK(expected == blended);
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTextPixelBlendingBlendPixelsOver(void)
+{
+  tet_infoline(" UtcDaliTextPixelBlendingBlendPixelsOver");
+
+  std::mt19937 generator(3u);
+
+  for(uint32_t numberOfPixels : NUMBER_OF_PIXELS)
+  {
+    const std::vector<uint32_t> top    = CreateColors(generator, numberOfPixels);
+    const std::vector<uint32_t> bottom = CreateColors(generator, numberOfPixels);
+
+    std::vector<uint32_t> expected(numberOfPixels);
+    std::vector<uint32_t> blended(numberOfPixels);
+    Scalar::BlendPixelsOver(top.data(), bottom.data(), expected.data(), numberOfPixels);
+    BlendPixelsOver(top.data(), bottom.data(), blended.data(), numberOfPixels);
+
+    DALI_TEST_CHECK(expected == blended);
+
+    // The result can be stored into one of the input buffers.
+    std::vector<uint32_t> bottomResult = bottom;
+    BlendPixelsOver(top.data(), bottomResult.data(), bottomResult.data(), numberOfPixels);
+
+    DALI_TEST_CHECK(expected == bottomResult);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTextPixelBlendingTypesetGlyphs(void)
+{
+  tet_infoline(" UtcDaliTextPixelBlendingTypesetGlyphs");
+
+  std::mt19937 generator(4u);
+
+  // Typesets a run of glyphs into a bitmap, line per line, and combines it with a style bitmap.
+  const uint32_t bitmapWidth = GLYPH_WIDTH * NUMBER_OF_GLYPHS;
+
+  const std::vector<uint8_t>  glyphAlphas = CreateGlyphAlphas(generator, GLYPH_WIDTH * GLYPH_HEIGHT);
+  const std::vector<uint32_t> styleBitmap = CreateColors(generator, bitmapWidth * GLYPH_HEIGHT);
+  const uint32_t              color       = 0xFF336699u;
+
+  std::vector<uint32_t> expectedBitmap(bitmapWidth * GLYPH_HEIGHT);
+  std::vector<uint32_t> blendedBitmap(bitmapWidth * GLYPH_HEIGHT);
+
+  Scalar::FillPixels(expectedBitmap.data(), bitmapWidth * GLYPH_HEIGHT, 0u);
+  for(uint32_t glyphIndex = 0u; glyphIndex < NUMBER_OF_GLYPHS; ++glyphIndex)
+  {
+    for(uint32_t lineIndex = 0u; lineIndex < GLYPH_HEIGHT; ++lineIndex)
+    {
+      Scalar::BlendGlyphColor(expectedBitmap.data() + lineIndex * bitmapWidth + glyphIndex * GLYPH_WIDTH, glyphAlphas.data() + lineIndex * GLYPH_WIDTH, 1u, GLYPH_WIDTH, color);
+    }
+  }
+  Scalar::BlendPixelsOver(expectedBitmap.data(), styleBitmap.data(), expectedBitmap.data(), bitmapWidth * GLYPH_HEIGHT);
+
+  FillPixels(blendedBitmap.data(), bitmapWidth * GLYPH_HEIGHT, 0u);
+  for(uint32_t glyphIndex = 0u; glyphIndex < NUMBER_OF_GLYPHS; ++glyphIndex)
+  {
+    for(uint32_t lineIndex = 0u; lineIndex < GLYPH_HEIGHT; ++lineIndex)
+    {
+      BlendGlyphColor(blendedBitmap.data() + lineIndex * bitmapWidth + glyphIndex * GLYPH_WIDTH, glyphAlphas.data() + lineIndex * GLYPH_WIDTH, 1u, GLYPH_WIDTH, color);
+    }
+  }
+  BlendPixelsOver(blendedBitmap.data(), styleBitmap.data(), blendedBitmap.data(), bitmapWidth * GLYPH_HEIGHT);
+
+  DALI_TEST_CHECK(expectedBitmap == blendedBitmap);
+
+  END_TEST;
+}
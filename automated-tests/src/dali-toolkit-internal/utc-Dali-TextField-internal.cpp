@@ -980,6 +980,49 @@ int UtcDaliTextFieldFontPointSizeLargerThanAtlasPlaceholderCase(void)
   END_TEST;
 }
 
+int UtcDaliTextFieldGlyphCachedOnce(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextFieldGlyphCachedOnce ");
+
+  const uint32_t initialGlyphCount = AtlasGlyphManager::Get().GetMetrics().mGlyphCount;
+
+  TextField textField = TextField::New();
+  textField.SetProperty(Actor::Property::SIZE, Vector2(300.f, 50.f));
+  textField.SetProperty(TextField::Property::TEXT, "Hello");
+  application.GetScene().Add(textField);
+
+  application.SendNotification();
+  application.Render();
+
+  const uint32_t glyphCount = AtlasGlyphManager::Get().GetMetrics().mGlyphCount;
+  DALI_TEST_CHECK(glyphCount > initialGlyphCount);
+
+  // The same glyphs with the same style are shared.
+  TextField otherTextField = TextField::New();
+  otherTextField.SetProperty(Actor::Property::SIZE, Vector2(300.f, 50.f));
+  otherTextField.SetProperty(TextField::Property::TEXT, "Hello");
+  application.GetScene().Add(otherTextField);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(AtlasGlyphManager::Get().GetMetrics().mGlyphCount, glyphCount, TEST_LOCATION);
+
+  // The glyphs are released with the last text using them.
+  otherTextField.Unparent();
+  otherTextField.Reset();
+  textField.Unparent();
+  textField.Reset();
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(AtlasGlyphManager::Get().GetMetrics().mGlyphCount, initialGlyphCount, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliTextFieldBackgroundTag(void)
 {
   ToolkitTestApplication application;
@@ -1337,4 +1337,50 @@ int UtcDaliTextLabelMarkupSpanCharacterSpacing(void)
   }
 
   END_TEST;
-}
\ No newline at end of file
+}
+int UtcDaliTextLabelTextFitLineBreaksOnce(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextLabelTextFitLineBreaksOnce ");
+
+  TextLabel textLabel = TextLabel::New();
+  textLabel.SetProperty(Actor::Property::SIZE, Vector2(460.0f, 100.0f));
+  textLabel.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  textLabel.SetProperty(TextLabel::Property::TEXT, "Hello world");
+
+  Property::Map textFitMapSet;
+  textFitMapSet["enable"]       = true;
+  textFitMapSet["minSize"]      = 10.f;
+  textFitMapSet["maxSize"]      = 100.f;
+  textFitMapSet["stepSize"]     = 1.f;
+  textFitMapSet["fontSizeType"] = "pointSize";
+  textLabel.SetProperty(Toolkit::DevelTextLabel::Property::TEXT_FIT, textFitMapSet);
+
+  application.GetScene().Add(textLabel);
+
+  application.SendNotification();
+  application.Render();
+
+  Toolkit::Internal::TextLabel& textLabelImpl  = GetImpl(textLabel);
+  Controller::Impl&             controllerImpl = Controller::Impl::GetImplementation(*textLabelImpl.GetTextController().Get());
+
+  // The binary search checks several point sizes, but the line breaks of the text are calculated by the first one only.
+  DALI_TEST_EQUALS(controllerImpl.mTextFitLineBreakUpdates, 1u, TEST_LOCATION);
+
+  textLabel.SetProperty(TextLabel::Property::TEXT, "Hello world Hello world Hello world Hello world");
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(controllerImpl.mTextFitLineBreakUpdates, 1u, TEST_LOCATION);
+
+  // The text is the same for another size, so its line breaks aren't calculated again.
+  textLabel.SetProperty(Actor::Property::SIZE, Vector2(300.0f, 200.0f));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(controllerImpl.mTextFitLineBreakUpdates, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
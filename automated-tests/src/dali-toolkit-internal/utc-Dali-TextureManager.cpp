@@ -23,6 +23,7 @@
 #include <toolkit-event-thread-callback.h>
 #include <toolkit-timer.h>
 
+#include <dali-toolkit/internal/image-loader/image-load-thread.h>
 #include <dali-toolkit/internal/texture-manager/texture-async-loading-helper.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
 #include <dali-toolkit/internal/texture-manager/texture-upload-observer.h>
@@ -57,6 +58,10 @@ namespace
 const char* TEST_IMAGE_FILE_NAME = TEST_RESOURCE_DIR "/gallery-small-1.jpg";
 const char* TEST_MASK_FILE_NAME  = TEST_RESOURCE_DIR "/mask.png";
 
+void TestLoadThreadTrigger()
+{
+}
+
 class TestObserver : public Dali::Toolkit::TextureUploadObserver
 {
 public:
@@ -1239,4 +1244,247 @@ int UtcTextureManagerRemoveDuringApplyMasking(void)
   DALI_TEST_EQUALS(observer2.mCompleteType, TestObserver::CompleteType::UPLOAD_COMPLETE, TEST_LOCATION);
 
   END_TEST;
-}
\ No newline at end of file
+}
+
+int UtcTextureManagerUnusedTextureCache(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerUnusedTextureCache");
+
+  TextureManager textureManager; // Create new texture manager
+
+  // Enough budget for the test image.
+  textureManager.SetUnusedTextureCacheBudget(16u * 1024u * 1024u);
+  DALI_TEST_EQUALS(textureManager.GetUnusedTextureCacheBudget(), static_cast<std::size_t>(16u * 1024u * 1024u), TEST_LOCATION);
+
+  TestObserver observer1;
+  std::string  filename(TEST_IMAGE_FILE_NAME);
+  auto         preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+
+  TextureManager::TextureId textureId1 = textureManager.RequestLoad(
+    filename,
+    ImageDimensions(),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::UseAtlas::NO_ATLAS,
+    &observer1,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(observer1.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().hitCount, 0u, TEST_LOCATION);
+
+  // Request same image while it is still in use. It should be counted as a hit too.
+  TestObserver              inUseObserver;
+  TextureManager::TextureId inUseTextureId = textureManager.RequestLoad(
+    filename,
+    ImageDimensions(),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::UseAtlas::NO_ATLAS,
+    &inUseObserver,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+
+  DALI_TEST_EQUALS(inUseTextureId, textureId1, TEST_LOCATION);
+  DALI_TEST_EQUALS(inUseObserver.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().hitCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 1u, TEST_LOCATION);
+
+  textureManager.Remove(inUseTextureId, &inUseObserver);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().unusedTextureCount, 0u, TEST_LOCATION);
+
+  // Remove the last reference. The texture should be kept.
+  textureManager.Remove(textureId1, &observer1);
+
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().unusedTextureCount, 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(textureManager.GetCacheStatistics().unusedTextureMemorySize > 0u);
+  DALI_TEST_CHECK(textureManager.GetTextureSet(textureId1));
+
+  // Request same image again. It should be notified without decoding.
+  TestObserver              observer2;
+  TextureManager::TextureId textureId2 = textureManager.RequestLoad(
+    filename,
+    ImageDimensions(),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::UseAtlas::NO_ATLAS,
+    &observer2,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+
+  DALI_TEST_EQUALS(textureId2, textureId1, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer2.mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer2.mObserverCalled, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observer2.mCompleteType, TestObserver::CompleteType::UPLOAD_COMPLETE, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().hitCount, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().missCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().unusedTextureCount, 0u, TEST_LOCATION);
+
+  // Remove again, and shrink the budget. The texture should be evicted.
+  textureManager.Remove(textureId2, &observer2);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().unusedTextureCount, 1u, TEST_LOCATION);
+
+  textureManager.SetUnusedTextureCacheBudget(0u);
+
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().unusedTextureCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().unusedTextureMemorySize, static_cast<std::size_t>(0u), TEST_LOCATION);
+  DALI_TEST_EQUALS(textureManager.GetCacheStatistics().evictionCount, 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcTextureManagerLoadManyImagesConcurrently(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerLoadManyImagesConcurrently - Loads are completed even if the workers finish out of order");
+
+  TextureManager textureManager; // Create new texture manager
+
+  std::string filename(TEST_IMAGE_FILE_NAME);
+  auto        preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+
+  // Use different size, so every request makes a new loading task.
+  const uint32_t                             numberOfRequests = 8u;
+  std::vector<std::unique_ptr<TestObserver>> observers;
+  for(uint32_t i = 0u; i < numberOfRequests; ++i)
+  {
+    observers.emplace_back(new TestObserver());
+    textureManager.RequestLoad(
+      filename,
+      ImageDimensions(10u + i, 10u + i),
+      FittingMode::SCALE_TO_FILL,
+      SamplingMode::BOX_THEN_LINEAR,
+      TextureManager::UseAtlas::NO_ATLAS,
+      observers.back().get(),
+      true,
+      TextureManager::ReloadPolicy::CACHED,
+      preMultiply);
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(numberOfRequests), true, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  for(auto&& observer : observers)
+  {
+    DALI_TEST_EQUALS(observer->mLoaded, true, TEST_LOCATION);
+    DALI_TEST_EQUALS(observer->mObserverCalled, true, TEST_LOCATION);
+    DALI_TEST_EQUALS(observer->mCompleteType, TestObserver::CompleteType::UPLOAD_COMPLETE, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcTextureManagerRemoveBeforeLoadAndLoadPriority(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerRemoveBeforeLoadAndLoadPriority - Removed loads are dropped and never notified");
+
+  TextureManager textureManager; // Create new texture manager
+
+  std::string filename(TEST_IMAGE_FILE_NAME);
+  auto        preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+
+  // Use different size, so every request makes a new loading task.
+  const uint32_t                             numberOfRequests = 4u;
+  std::vector<std::unique_ptr<TestObserver>> observers;
+  std::vector<TextureManager::TextureId>     textureIds;
+  for(uint32_t i = 0u; i < numberOfRequests; ++i)
+  {
+    observers.emplace_back(new TestObserver());
+    textureIds.push_back(textureManager.RequestLoad(
+      filename,
+      ImageDimensions(20u + i, 20u + i),
+      FittingMode::SCALE_TO_FILL,
+      SamplingMode::BOX_THEN_LINEAR,
+      TextureManager::UseAtlas::NO_ATLAS,
+      observers.back().get(),
+      true,
+      TextureManager::ReloadPolicy::CACHED,
+      preMultiply));
+  }
+
+  // The last one is the visible one. The others left the screen before being loaded.
+  textureManager.SetLoadPriority(textureIds.back(), 100);
+  for(uint32_t i = 0u; i + 1u < numberOfRequests; ++i)
+  {
+    textureManager.Remove(textureIds[i], observers[i].get());
+  }
+
+  // Removed loads which were already taken by a worker still trigger the event thread.
+  for(uint32_t i = 0u; i < numberOfRequests && !observers.back()->mObserverCalled; ++i)
+  {
+    DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+    application.SendNotification();
+    application.Render();
+  }
+
+  DALI_TEST_EQUALS(observers.back()->mLoaded, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observers.back()->mObserverCalled, true, TEST_LOCATION);
+  DALI_TEST_EQUALS(observers.back()->mCompleteType, TestObserver::CompleteType::UPLOAD_COMPLETE, TEST_LOCATION);
+
+  for(uint32_t i = 0u; i + 1u < numberOfRequests; ++i)
+  {
+    DALI_TEST_EQUALS(observers[i]->mObserverCalled, false, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcTextureManagerLoadPriorityCompletionOrder(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcTextureManagerLoadPriorityCompletionOrder - Loads queued with mixed priorities complete by priority, then in order");
+
+  EventThreadCallback trigger(MakeCallback(&TestLoadThreadTrigger));
+  ImageLoadThread     loadThread(&trigger, 1u);
+
+  // Queue all the loads before the worker starts, so it chooses among all of them.
+  const int32_t  priorities[]    = {0, 100, -10, 50, 0, 100};
+  const uint32_t numberOfTasks   = sizeof(priorities) / sizeof(priorities[0]);
+  const uint32_t expectedOrder[] = {2u, 1u, 5u, 3u, 0u, 4u};
+  for(uint32_t id = 0u; id < numberOfTasks; ++id)
+  {
+    LoadingTask* task = new LoadingTask(id, VisualUrl(TEST_IMAGE_FILE_NAME), ImageDimensions(), FittingMode::DEFAULT, SamplingMode::DEFAULT, true, DevelAsyncImageLoader::PreMultiplyOnLoad::OFF);
+    task->priority    = priorities[id];
+    loadThread.AddTask(task);
+  }
+
+  // A queued load can be moved ahead of all the others.
+  DALI_TEST_EQUALS(loadThread.SetTaskPriority(2u, 200), true, TEST_LOCATION);
+
+  loadThread.Start();
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(numberOfTasks), true, TEST_LOCATION);
+
+  for(uint32_t i = 0u; i < numberOfTasks; ++i)
+  {
+    LoadingTask* task = loadThread.NextCompletedTask();
+    DALI_TEST_CHECK(task);
+    if(task)
+    {
+      DALI_TEST_EQUALS(task->id, expectedOrder[i], TEST_LOCATION);
+      delete task;
+    }
+  }
+  DALI_TEST_CHECK(!loadThread.NextCompletedTask());
+
+  END_TEST;
+}
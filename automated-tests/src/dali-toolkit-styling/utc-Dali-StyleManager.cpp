@@ -24,6 +24,7 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/integration-api/events/touch-event-integ.h>
 #include <dali-toolkit/devel-api/builder/builder.h>
+#include <dali-toolkit/devel-api/builder/json-parser.h>
 #include <test-button.h>
 #include <test-animation-data.h>
 #include <toolkit-style-monitor.h>
@@ -312,6 +313,50 @@ int UtcDaliStyleManagerApplyTheme(void)
 }
 
 
+int UtcDaliStyleManagerApplyBinaryTheme(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline( "Testing StyleManager ApplyTheme with a theme precompiled into a binary tree" );
+
+  const char* json =
+    "{\n"
+    "  \"constants\":\n"
+    "  {\n"
+    "    \"FOREGROUND\":[0.0,0.0,1.0,1.0]\n"
+    "  },\n"
+    "  \"styles\":\n"
+    "  {\n"
+    "    \"testbutton\":\n"
+    "    {\n"
+    "      \"backgroundColor\":[1.0,1.0,0.0,1.0],\n"
+    "      \"foregroundColor\":\"{FOREGROUND}\"\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  JsonParser parser = JsonParser::New();
+  DALI_TEST_CHECK( parser.Parse( json ) );
+
+  std::stringstream binary;
+  parser.WriteBinary( binary );
+
+  Test::TestButton testButton = Test::TestButton::New();
+  application.GetScene().Add( testButton );
+
+  std::string themeFile("BinaryTheme");
+  Test::StyleMonitor::SetThemeFileOutput(themeFile, binary.str());
+  StyleManager::Get().ApplyTheme(themeFile);
+
+  Property::Value bgColor( testButton.GetProperty(Test::TestButton::Property::BACKGROUND_COLOR) );
+  Property::Value fgColor( testButton.GetProperty(Test::TestButton::Property::FOREGROUND_COLOR) );
+
+  DALI_TEST_EQUALS( bgColor, Property::Value(Color::YELLOW), 0.001, TEST_LOCATION );
+  DALI_TEST_EQUALS( fgColor, Property::Value(Color::BLUE), 0.001, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliStyleManagerApplyDefaultTheme(void)
 {
   tet_infoline( "Testing StyleManager ApplyTheme" );
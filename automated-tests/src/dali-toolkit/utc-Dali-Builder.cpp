@@ -643,6 +643,59 @@ int UtcDaliBuilderTemplatesAndStylesP(void)
   END_TEST;
 }
 
+int UtcDaliBuilderRecordedStylesP(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("Styles are recorded once, and recorded again when the constants or the styles change");
+
+  std::string json(
+    "{"
+    "\"constants\":"
+    "{"
+    "  \"OPACITY\": 0.5"
+    "},"
+    "\"styles\":"
+    "{"
+    "  \"fadedStyle\":"
+    "  {"
+    "    \"opacity\": \"{OPACITY}\""
+    "  }"
+    "}"
+    "}");
+
+  Builder builder = Builder::New();
+  builder.LoadFromString(json);
+
+  Actor actor1 = Actor::New();
+  DALI_TEST_CHECK(builder.ApplyStyle("fadedStyle", actor1));
+  DALI_TEST_EQUALS(actor1.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+
+  // The style name is not case sensitive.
+  Actor actor2 = Actor::New();
+  DALI_TEST_CHECK(builder.ApplyStyle("FADEDSTYLE", actor2));
+  DALI_TEST_EQUALS(actor2.GetProperty<float>(Actor::Property::OPACITY), 0.5f, TEST_LOCATION);
+
+  DALI_TEST_CHECK(!builder.ApplyStyle("unknownStyle", actor2));
+  DALI_TEST_CHECK(!builder.ApplyStyle("unknownStyle", actor2));
+
+  // The style uses the new constant.
+  builder.AddConstant("OPACITY", 0.25f);
+
+  Actor actor3 = Actor::New();
+  DALI_TEST_CHECK(builder.ApplyStyle("fadedStyle", actor3));
+  DALI_TEST_EQUALS(actor3.GetProperty<float>(Actor::Property::OPACITY), 0.25f, TEST_LOCATION);
+
+  // Each style applied from json replaces the previous one.
+  DALI_TEST_CHECK(builder.ApplyFromJson(actor1, "{\"opacity\":0.75}"));
+  DALI_TEST_EQUALS(actor1.GetProperty<float>(Actor::Property::OPACITY), 0.75f, TEST_LOCATION);
+
+  DALI_TEST_CHECK(builder.ApplyFromJson(actor1, "{\"opacity\":0.1}"));
+  DALI_TEST_EQUALS(actor1.GetProperty<float>(Actor::Property::OPACITY), 0.1f, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliBuilderRenderTasksP(void)
 {
   ToolkitTestApplication application;
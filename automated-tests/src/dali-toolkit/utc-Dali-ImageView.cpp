@@ -2712,8 +2712,8 @@ int UtcDaliImageViewLoadRemoteSVG(void)
 
     application.SendNotification();
 
-    // Wait for loading & rasterization
-    DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(2), true, TEST_LOCATION);
+    // Wait for rasterization. The document is already loaded by the first image view.
+    DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
 
     application.SendNotification();
     application.Render();
@@ -3142,6 +3142,88 @@ int UtcDaliImageViewSvgAtlasing(void)
   END_TEST;
 }
 
+int UtcDaliImageViewSvgShareRasterizedImage(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("ImageView Testing the same SVG image with the same size is loaded and rasterized once");
+
+  ImageView imageView1 = ImageView::New(TEST_SVG_FILE_NAME);
+  imageView1.SetProperty(Actor::Property::SIZE, Vector2(200.f, 200.f));
+  application.GetScene().Add(imageView1);
+
+  ImageView imageView2 = ImageView::New(TEST_SVG_FILE_NAME);
+  imageView2.SetProperty(Actor::Property::SIZE, Vector2(200.f, 200.f));
+  application.GetScene().Add(imageView2);
+
+  application.SendNotification();
+
+  // Wait for loading & rasterization, shared by both image views
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(2), true, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(Test::VectorImageRenderer::GetLoadCount(), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(imageView1.GetRendererCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(imageView2.GetRendererCount(), 1u, TEST_LOCATION);
+
+  // The texture is shared
+  Texture texture1 = imageView1.GetRendererAt(0).GetTextures().GetTexture(0);
+  Texture texture2 = imageView2.GetRendererAt(0).GetTextures().GetTexture(0);
+  DALI_TEST_CHECK(texture1);
+  DALI_TEST_CHECK(texture1 == texture2);
+
+  // The rasterized image is reused without waiting for the worker thread
+  ImageView imageView3 = ImageView::New(TEST_SVG_FILE_NAME);
+  imageView3.SetProperty(Actor::Property::SIZE, Vector2(200.f, 200.f));
+  application.GetScene().Add(imageView3);
+
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(imageView3.GetRendererCount(), 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(imageView3.GetRendererAt(0).GetTextures().GetTexture(0) == texture1);
+  DALI_TEST_EQUALS(imageView3.GetVisualResourceStatus(ImageView::Property::IMAGE), Visual::ResourceStatus::READY, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliImageViewSvgRasterizeSeveralSizes(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("ImageView Testing the same SVG image rasterized with several sizes by the worker threads");
+
+  const float sizes[] = {100.f, 200.f, 300.f};
+
+  std::vector<ImageView> imageViews;
+  for(float size : sizes)
+  {
+    ImageView imageView = ImageView::New(TEST_SVG_FILE_NAME);
+    imageView.SetProperty(Actor::Property::SIZE, Vector2(size, size));
+    application.GetScene().Add(imageView);
+    imageViews.push_back(imageView);
+  }
+
+  application.SendNotification();
+
+  // Wait for loading & rasterization of each size
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(4), true, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_EQUALS(Test::VectorImageRenderer::GetLoadCount(), 1, TEST_LOCATION);
+  for(auto&& imageView : imageViews)
+  {
+    DALI_TEST_EQUALS(imageView.GetRendererCount(), 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(imageView.GetVisualResourceStatus(ImageView::Property::IMAGE), Visual::ResourceStatus::READY, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
 int UtcDaliImageViewTVGLoading(void)
 {
   ToolkitTestApplication application;
@@ -23,6 +23,9 @@
 // test harness headers before dali headers.
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/scrollable/item-view/item-factory-extension.h>
+#include <dali-toolkit/devel-api/controls/scrollable/item-view/item-view-devel.h>
+#include <dali-toolkit/devel-api/controls/scrollable/item-view/variable-size-list-layout.h>
 #include <dali/integration-api/events/touch-event-integ.h>
 #include <dali/integration-api/events/wheel-event-integ.h>
 
@@ -143,6 +146,53 @@ public: // From ItemFactory
   }
 };
 
+// Implementation of ItemFactory which lets ItemView recycle the actors of the items
+class TestRecyclingItemFactory : public ItemFactory, public ItemFactory::Extension
+{
+public: // From ItemFactory
+  unsigned int GetNumberOfItems() override
+  {
+    return TOTAL_ITEM_NUMBER;
+  }
+
+  Actor NewItem(unsigned int itemId) override
+  {
+    ++mNewItemCount;
+
+    // Remember the view type the actor was created for
+    Actor actor = ImageView::New(TEST_IMAGE_FILE_NAME);
+    actor.SetProperty(Actor::Property::NAME, std::to_string(GetItemViewType(itemId)));
+    return actor;
+  }
+
+  void ItemReleased(unsigned int itemId, Actor actor) override
+  {
+    ++mReleasedItemCount;
+  }
+
+  ItemFactory::Extension* GetExtension() override
+  {
+    return this;
+  }
+
+public: // From ItemFactory::Extension
+  unsigned int GetItemViewType(unsigned int itemId) override
+  {
+    return itemId % 2u;
+  }
+
+  void BindItem(unsigned int itemId, Actor actor) override
+  {
+    ++mBindItemCount;
+    mViewTypeMismatch |= actor.GetProperty<std::string>(Actor::Property::NAME) != std::to_string(GetItemViewType(itemId));
+  }
+
+  unsigned int mNewItemCount{0u};
+  unsigned int mReleasedItemCount{0u};
+  unsigned int mBindItemCount{0u};
+  bool         mViewTypeMismatch{false};
+};
+
 } // namespace
 
 int UtcDaliItemViewNew(void)
@@ -1359,3 +1409,283 @@ int UtcDaliItemViewWheelEvent(void)
 
   END_TEST;
 }
+
+int UtcDaliItemViewRecycleItemsP(void)
+{
+  ToolkitTestApplication   application;
+  Dali::Integration::Scene stage = application.GetScene();
+
+  // Create the ItemView actor
+  TestRecyclingItemFactory factory;
+  ItemView                 view = ItemView::New(factory);
+
+  // Create a grid layout and add it to ItemView
+  ItemLayoutPtr gridLayout = DefaultItemLayout::New(DefaultItemLayout::GRID);
+  view.AddLayout(*gridLayout);
+  stage.Add(view);
+
+  // Activate the grid layout so that the items will be created and added to ItemView
+  Vector3 stageSize(stage.GetSize());
+  view.ActivateLayout(0, stageSize, 0.0f);
+
+  DALI_TEST_CHECK(factory.mNewItemCount > 0u);
+  DALI_TEST_EQUALS(factory.mBindItemCount, 0u, TEST_LOCATION);
+
+  // Refreshing releases all the items, then adds them again, with the extra items reserved for scrolling
+  view.Refresh();
+  DALI_TEST_CHECK(factory.mBindItemCount > 0u);
+
+  // Every actor released is bound again to an item of the same view type, so none is created
+  const unsigned int newItemCount      = factory.mNewItemCount;
+  const unsigned int releasedItemCount = factory.mReleasedItemCount;
+  const unsigned int bindItemCount     = factory.mBindItemCount;
+  view.Refresh();
+
+  DALI_TEST_EQUALS(factory.mNewItemCount, newItemCount, TEST_LOCATION);
+  DALI_TEST_EQUALS(factory.mBindItemCount - bindItemCount, factory.mReleasedItemCount - releasedItemCount, TEST_LOCATION);
+  DALI_TEST_CHECK(!factory.mViewTypeMismatch);
+  DALI_TEST_CHECK(view.GetItem(0));
+  DALI_TEST_CHECK(view.GetItem(0).GetParent() == view);
+
+  // Scroll to other items, which reuse the actors of the items scrolled out
+  view.SetProperty(ItemView::Property::LAYOUT_POSITION, -100.0f);
+  Wait(application);
+  view.Refresh();
+
+  DALI_TEST_CHECK(factory.mBindItemCount > bindItemCount);
+  DALI_TEST_CHECK(!factory.mViewTypeMismatch);
+
+  END_TEST;
+}
+
+int UtcDaliItemViewRecycleReplacedItemsP(void)
+{
+  ToolkitTestApplication   application;
+  Dali::Integration::Scene stage = application.GetScene();
+
+  // Create the ItemView actor
+  TestRecyclingItemFactory factory;
+  ItemView                 view = ItemView::New(factory);
+
+  // Create a grid layout and add it to ItemView
+  ItemLayoutPtr gridLayout = DefaultItemLayout::New(DefaultItemLayout::GRID);
+  view.AddLayout(*gridLayout);
+  stage.Add(view);
+
+  Vector3 stageSize(stage.GetSize());
+  view.ActivateLayout(0, stageSize, 0.0f);
+
+  // An actor which wasn't created by the factory is not recycled
+  Actor replacement = Actor::New();
+  view.ReplaceItem(Item(0, replacement), 0.0f);
+  DALI_TEST_CHECK(view.GetItem(0) == replacement);
+
+  const unsigned int bindItemCount = factory.mBindItemCount;
+  view.Refresh();
+
+  DALI_TEST_CHECK(view.GetItem(0) != replacement);
+  DALI_TEST_CHECK(factory.mBindItemCount > bindItemCount);
+  DALI_TEST_CHECK(!factory.mViewTypeMismatch);
+
+  END_TEST;
+}
+
+int UtcDaliItemViewRecycleItemsLimitP(void)
+{
+  ToolkitTestApplication   application;
+  Dali::Integration::Scene stage = application.GetScene();
+
+  // Create the ItemView actor
+  TestRecyclingItemFactory factory;
+  ItemView                 view = ItemView::New(factory);
+
+  // Create a grid layout and add it to ItemView
+  ItemLayoutPtr gridLayout = DefaultItemLayout::New(DefaultItemLayout::GRID);
+  view.AddLayout(*gridLayout);
+  stage.Add(view);
+
+  Vector3 stageSize(stage.GetSize());
+  Vector3 smallSize(stageSize.width, stageSize.height / 8.0f, stageSize.depth);
+  view.ActivateLayout(0, stageSize, 0.0f);
+  view.Refresh();
+
+  // Shrink the layout, the actors released beyond the items of the small area and its reserve are dropped
+  view.ActivateLayout(0, smallSize, 0.0f);
+  view.Refresh();
+
+  // So growing the layout back needs new actors
+  const unsigned int newItemCount = factory.mNewItemCount;
+  view.ActivateLayout(0, stageSize, 0.0f);
+  view.Refresh();
+
+  DALI_TEST_CHECK(factory.mNewItemCount > newItemCount);
+  DALI_TEST_CHECK(!factory.mViewTypeMismatch);
+
+  // Which are all reused once the layout keeps its size
+  const unsigned int newItemCountAfterGrowing = factory.mNewItemCount;
+  view.Refresh();
+
+  DALI_TEST_EQUALS(factory.mNewItemCount, newItemCountAfterGrowing, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliItemViewVariableSizeListLayoutRefreshIntervalP(void)
+{
+  ToolkitTestApplication   application;
+  Dali::Integration::Scene stage = application.GetScene();
+
+  TestItemFactory factory;
+  ItemView        view = ItemView::New(factory);
+
+  VariableSizeListLayoutPtr listLayout = VariableSizeListLayout::New();
+  ItemLayoutPtr             gridLayout = DefaultItemLayout::New(DefaultItemLayout::GRID);
+  view.AddLayout(*listLayout);
+  view.AddLayout(*gridLayout);
+  stage.Add(view);
+
+  // The default refresh interval is in items, so it is in default extents with the layout in pixels
+  const float defaultInterval = view.GetRefreshInterval();
+  Vector3     stageSize(stage.GetSize());
+  view.ActivateLayout(0, stageSize, 0.0f);
+  DALI_TEST_EQUALS(view.GetRefreshInterval(), defaultInterval * listLayout->GetDefaultItemExtent(), TEST_LOCATION);
+
+  view.ActivateLayout(1, stageSize, 0.0f);
+  DALI_TEST_EQUALS(view.GetRefreshInterval(), defaultInterval, TEST_LOCATION);
+
+  // An interval set by the application is kept whatever the layout
+  view.SetRefreshInterval(500.0f);
+  view.ActivateLayout(0, stageSize, 0.0f);
+  DALI_TEST_EQUALS(view.GetRefreshInterval(), 500.0f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliItemViewVariableSizeListLayoutP(void)
+{
+  ToolkitTestApplication   application;
+  Dali::Integration::Scene stage = application.GetScene();
+
+  // Create the ItemView actor
+  TestItemFactory factory;
+  ItemView        view = ItemView::New(factory);
+
+  // Create a list of the default extent, but for the first two items
+  VariableSizeListLayoutPtr listLayout = VariableSizeListLayout::New();
+  listLayout->SetItemExtent(0u, 300.0f);
+  listLayout->SetItemExtent(1u, 50.0f);
+  DALI_TEST_EQUALS(listLayout->GetItemExtent(0u), 300.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(listLayout->GetItemExtent(2u), listLayout->GetDefaultItemExtent(), TEST_LOCATION);
+
+  view.AddLayout(*listLayout);
+  stage.Add(view);
+
+  Vector3 stageSize(stage.GetSize());
+  view.ActivateLayout(0, stageSize, 0.0f);
+  Wait(application);
+
+  // Each item takes its extent, and starts where the previous one ends
+  Actor firstItem  = view.GetItem(0u);
+  Actor secondItem = view.GetItem(1u);
+  DALI_TEST_EQUALS(firstItem.GetProperty<Vector3>(Actor::Property::SIZE), Vector3(stageSize.width, 300.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(secondItem.GetProperty<Vector3>(Actor::Property::SIZE), Vector3(stageSize.width, 50.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(firstItem.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 150.0f - stageSize.height * 0.5f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(secondItem.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 325.0f - stageSize.height * 0.5f, 0.0f), TEST_LOCATION);
+
+  // Scrolling to an item brings it to the top; the layout positions are in pixels
+  view.ScrollToItem(1u, 0.0f);
+  Wait(application);
+  DALI_TEST_EQUALS(view.GetCurrentLayoutPosition(0u), -300.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(secondItem.GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 25.0f - stageSize.height * 0.5f, 0.0f), TEST_LOCATION);
+
+  // The last item can't go above the bottom of the view
+  const float totalExtent = 350.0f + (TOTAL_ITEM_NUMBER - 2u) * listLayout->GetDefaultItemExtent();
+  view.ScrollToItem(TOTAL_ITEM_NUMBER - 1u, 0.0f);
+  Wait(application);
+  DALI_TEST_EQUALS(view.GetCurrentLayoutPosition(0u), stageSize.height - totalExtent, TEST_LOCATION);
+
+  // Changing the extent of an item moves the items shown after it, and resizes it
+  view.ScrollToItem(0u, 0.0f);
+  Wait(application);
+  listLayout->SetItemExtent(0u, 100.0f);
+  Wait(application);
+  DALI_TEST_EQUALS(view.GetItem(0u).GetProperty<Vector3>(Actor::Property::SIZE), Vector3(stageSize.width, 100.0f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(view.GetItem(1u).GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 125.0f - stageSize.height * 0.5f, 0.0f), TEST_LOCATION);
+  DALI_TEST_EQUALS(view.GetItem(2u).GetCurrentProperty<Vector3>(Actor::Property::POSITION), Vector3(0.0f, 200.0f - stageSize.height * 0.5f, 0.0f), TEST_LOCATION);
+
+  // The anchor is the closest edge of an item
+  ItemLayout& layout = *listLayout;
+  DALI_TEST_EQUALS(layout.GetClosestAnchorPosition(-120.0f), -100.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(layout.GetClosestAnchorPosition(-130.0f), -150.0f, TEST_LOCATION);
+
+  listLayout->ClearItemExtents();
+  DALI_TEST_EQUALS(listLayout->GetItemExtent(1u), listLayout->GetDefaultItemExtent(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliItemViewBatchedLayoutP(void)
+{
+  ToolkitTestApplication   application;
+  Dali::Integration::Scene stage = application.GetScene();
+
+  // Create the ItemView actor
+  TestItemFactory factory;
+  ItemView        view = ItemView::New(factory);
+  DALI_TEST_CHECK(!DevelItemView::IsBatchedLayoutEnabled(view));
+
+  // Create the grid and depth layouts and add them to ItemView
+  ItemLayoutPtr gridLayout  = DefaultItemLayout::New(DefaultItemLayout::GRID);
+  ItemLayoutPtr depthLayout = DefaultItemLayout::New(DefaultItemLayout::DEPTH);
+  view.AddLayout(*gridLayout);
+  view.AddLayout(*depthLayout);
+  stage.Add(view);
+
+  Vector3 stageSize(stage.GetSize());
+  for(unsigned int layoutIndex = 0u; layoutIndex < view.GetLayoutCount(); ++layoutIndex)
+  {
+    // Position the items with the constraints of the layout
+    DevelItemView::SetBatchedLayoutEnabled(view, false);
+    view.ActivateLayout(layoutIndex, stageSize, 0.0f);
+    view.SetProperty(ItemView::Property::LAYOUT_POSITION, -2.0f);
+    Wait(application);
+
+    std::vector<Vector3> positions;
+    std::vector<Vector4> colors;
+    std::vector<bool>    visibilities;
+    for(unsigned int itemId = 0u; itemId < 8u; ++itemId)
+    {
+      Actor item = view.GetItem(itemId);
+      positions.push_back(item.GetCurrentProperty<Vector3>(Actor::Property::POSITION));
+      colors.push_back(item.GetCurrentProperty<Vector4>(Actor::Property::COLOR));
+      visibilities.push_back(item.GetCurrentProperty<bool>(Actor::Property::VISIBLE));
+    }
+
+    // The batched layout positions the items in the same places
+    DevelItemView::SetBatchedLayoutEnabled(view, true);
+    DALI_TEST_CHECK(DevelItemView::IsBatchedLayoutEnabled(view));
+    Wait(application);
+
+    for(unsigned int itemId = 0u; itemId < 8u; ++itemId)
+    {
+      Actor item = view.GetItem(itemId);
+      DALI_TEST_EQUALS(item.GetCurrentProperty<Vector3>(Actor::Property::POSITION), positions[itemId], Math::MACHINE_EPSILON_100, TEST_LOCATION);
+
+      // An item hidden by the constraints is transparent instead
+      const Vector4 color = item.GetCurrentProperty<Vector4>(Actor::Property::COLOR);
+      DALI_TEST_EQUALS(color.GetVectorXYZ(), colors[itemId].GetVectorXYZ(), Math::MACHINE_EPSILON_100, TEST_LOCATION);
+      DALI_TEST_EQUALS(color.a, visibilities[itemId] ? colors[itemId].a : 0.0f, Math::MACHINE_EPSILON_100, TEST_LOCATION);
+    }
+
+    // Scrolling moves the batched items
+    view.SetProperty(ItemView::Property::LAYOUT_POSITION, -3.0f);
+    Wait(application);
+    DALI_TEST_CHECK(view.GetItem(4).GetCurrentProperty<Vector3>(Actor::Property::POSITION) != positions[4]);
+  }
+
+  DevelItemView::SetBatchedLayoutEnabled(view, false);
+  DALI_TEST_CHECK(!DevelItemView::IsBatchedLayoutEnabled(view));
+  Wait(application);
+
+  END_TEST;
+}
@@ -822,3 +822,213 @@ int UtcDaliJsonParserTreeNodeFind(void)
 
   END_TEST;
 }
+
+int UtcDaliJsonParserMergeAndPack(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("JSON Pack() after merging parses, and copy of the packed tree");
+
+  std::string s1(ReplaceQuotes(
+    "\
+{                                         \
+  'string':'value',                       \
+  'array':[1,2,3],                        \
+  'object':{'key':'value', 'other':1}     \
+}                                         \
+"));
+
+  std::string s2(ReplaceQuotes(
+    "\
+{                                         \
+  'array':'replaced',                     \
+  'object':{'key':'value2', 'new':[4,5]}  \
+}                                         \
+"));
+
+  JsonParser parser = JsonParser::New();
+
+  DALI_TEST_CHECK(parser.Parse(s1));
+  DALI_TEST_CHECK(parser.Parse(s2));
+
+  std::stringstream ss1;
+  parser.Write(ss1, 2);
+
+  parser.Pack();
+
+  std::stringstream ss2;
+  parser.Write(ss2, 2);
+
+  DALI_TEST_EQUALS(ss1.str(), ss2.str(), TEST_LOCATION);
+
+  const TreeNode* root = parser.GetRoot();
+  DALI_TEST_CHECK(root);
+  DALI_TEST_EQUALS(std::string(root->GetChild("array")->GetString()), std::string("replaced"), TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(root->GetChild("object")->GetChild("key")->GetString()), std::string("value2"), TEST_LOCATION);
+  DALI_TEST_CHECK(root->GetChild("object")->GetChild("new")->Size() == 2);
+
+  // The copy owns its strings.
+  JsonParser copy = JsonParser::New(*root);
+  parser.Reset();
+
+  std::stringstream ss3;
+  copy.Write(ss3, 2);
+
+  DALI_TEST_EQUALS(ss1.str(), ss3.str(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliJsonParserMergeManyChildren(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("JSON merging parse of objects with many children, which are indexed by name");
+
+  const int numberOfChildren = 100;
+
+  std::stringstream s1;
+  std::stringstream s2;
+  s1 << "{";
+  s2 << "{";
+  for(int i = 0; i < numberOfChildren; ++i)
+  {
+    s1 << (i ? "," : "") << "\"key" << i << "\":" << i;
+    if(i % 2)
+    {
+      s2 << (i > 1 ? "," : "") << "\"key" << i << "\":" << -i;
+    }
+  }
+  // A duplicated key is found as its first occurrence.
+  s1 << ",\"key0\":-1}";
+  s2 << ",\"new\":1}";
+
+  JsonParser parser = JsonParser::New();
+  DALI_TEST_CHECK(parser.Parse(s1.str()));
+  DALI_TEST_CHECK(parser.Parse(s2.str()));
+
+  const TreeNode* root = parser.GetRoot();
+  DALI_TEST_CHECK(root->Size() == static_cast<size_t>(numberOfChildren + 2));
+  DALI_TEST_CHECK(root->GetChild("new"));
+  DALI_TEST_CHECK(!root->GetChild("key100"));
+
+  for(int i = 0; i < numberOfChildren; ++i)
+  {
+    std::stringstream key;
+    key << "key" << i;
+    const TreeNode* child = root->GetChild(key.str());
+    DALI_TEST_CHECK(child);
+    DALI_TEST_EQUALS(child->GetInteger(), (i % 2) ? -i : i, TEST_LOCATION);
+  }
+
+  // The copy is indexed as well.
+  JsonParser copy = JsonParser::New(*root);
+  DALI_TEST_EQUALS(copy.GetRoot()->GetChild("key51")->GetInteger(), -51, TEST_LOCATION);
+  DALI_TEST_CHECK(copy.GetRoot()->Find("key42"));
+
+  END_TEST;
+}
+
+int UtcDaliJsonParserWriteBinary(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("JSON tree written in binary, and read back instead of the json source");
+
+  std::string s1(ReplaceQuotes(
+    "\
+{                                         \
+  'string':'value',                       \
+  'substitution':'{CONSTANT}',            \
+  'integer':-2,                           \
+  'float':2.5,                            \
+  'boolean':true,                         \
+  'nil':null,                             \
+  'array':[1,2,3],                        \
+  'object':{'key':'value', 'string':'value'} \
+}                                         \
+"));
+
+  std::string s2(ReplaceQuotes(
+    "\
+{                                         \
+  'integer':3,                            \
+  'array':[4],                            \
+  'object':{'key':'other', 'new':false}   \
+}                                         \
+"));
+
+  JsonParser jsonParser = JsonParser::New();
+  DALI_TEST_CHECK(jsonParser.Parse(s1));
+
+  std::stringstream binary1;
+  jsonParser.WriteBinary(binary1);
+
+  DALI_TEST_CHECK(jsonParser.Parse(s2));
+
+  JsonParser parser2 = JsonParser::New();
+  DALI_TEST_CHECK(parser2.Parse(s2));
+
+  std::stringstream binary2;
+  parser2.WriteBinary(binary2);
+
+  // A binary tree read alone is the same as its json source.
+  JsonParser parser1 = JsonParser::New();
+  DALI_TEST_CHECK(parser1.Parse(binary1.str()));
+  DALI_TEST_CHECK(!parser1.ParseError());
+  DALI_TEST_CHECK(parser1.GetRoot()->GetChild("substitution")->HasSubstitution());
+  DALI_TEST_EQUALS(parser1.GetRoot()->GetChild("integer")->GetInteger(), -2, TEST_LOCATION);
+  DALI_TEST_EQUALS(parser1.GetRoot()->GetChild("float")->GetFloat(), 2.5f, TEST_LOCATION);
+
+  // Binary trees are merged like json sources.
+  DALI_TEST_CHECK(parser1.Parse(binary2.str()));
+
+  std::stringstream expected;
+  jsonParser.Write(expected, 2);
+
+  std::stringstream merged;
+  parser1.Write(merged, 2);
+
+  DALI_TEST_EQUALS(merged.str(), expected.str(), TEST_LOCATION);
+
+  // A json source can be merged on top of a binary tree.
+  JsonParser parser3 = JsonParser::New();
+  DALI_TEST_CHECK(parser3.Parse(binary1.str()));
+  DALI_TEST_CHECK(parser3.Parse(s2));
+
+  std::stringstream merged3;
+  parser3.Write(merged3, 2);
+
+  DALI_TEST_EQUALS(merged3.str(), expected.str(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliJsonParserWriteBinaryN(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("JSON corrupted binary tree");
+
+  JsonParser parser = JsonParser::New();
+  DALI_TEST_CHECK(parser.Parse(ReplaceQuotes("{'key':'value', 'array':[1,2]}")));
+
+  std::stringstream binary;
+  parser.WriteBinary(binary);
+
+  std::string truncated = binary.str();
+  truncated.resize(truncated.size() - 1u);
+
+  JsonParser parser2 = JsonParser::New();
+  DALI_TEST_CHECK(!parser2.Parse(truncated));
+  DALI_TEST_CHECK(parser2.ParseError());
+  DALI_TEST_CHECK(!parser2.GetRoot());
+
+  std::string unterminated = binary.str();
+  unterminated.back() = 'x';
+
+  DALI_TEST_CHECK(!parser2.Parse(unterminated));
+  DALI_TEST_CHECK(parser2.ParseError());
+
+  END_TEST;
+}
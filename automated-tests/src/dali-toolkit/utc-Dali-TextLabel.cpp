@@ -30,6 +30,7 @@
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/devel-api/text-abstraction/bitmap-font.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
+#include <toolkit-event-thread-callback.h>
 #include "test-text-geometry-utils.h"
 
 using namespace Dali;
@@ -1993,6 +1994,49 @@ int UtcDaliToolkitTextlabelTextFit(void)
   END_TEST;
 }
 
+int UtcDaliToolkitTextlabelTextFitTextChanged(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitTextlabelTextFitTextChanged");
+  TextLabel label = TextLabel::New();
+  Vector2   size(460.0f, 100.0f);
+  label.SetProperty(Actor::Property::SIZE, size);
+  label.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  label.SetProperty(TextLabel::Property::TEXT, "Hello world");
+
+  Property::Map textFitMapSet;
+  textFitMapSet["enable"]       = true;
+  textFitMapSet["minSize"]      = 10.f;
+  textFitMapSet["maxSize"]      = 100.f;
+  textFitMapSet["stepSize"]     = 1.f;
+  textFitMapSet["fontSizeType"] = "pointSize";
+  label.SetProperty(Toolkit::DevelTextLabel::Property::TEXT_FIT, textFitMapSet);
+
+  application.GetScene().Add(label);
+
+  application.SendNotification();
+  application.Render();
+
+  const Vector3 naturalSize = label.GetNaturalSize();
+  DALI_TEST_CHECK(naturalSize.width <= size.width);
+  DALI_TEST_CHECK(naturalSize.height <= size.height);
+
+  // The line breaks and the scripts of the new text are calculated once for all the probes.
+  gTextFitChangedCallBackCalled = false;
+  DevelTextLabel::TextFitChangedSignal(label).Connect(&TestTextFitChangedCallback);
+  label.SetProperty(TextLabel::Property::TEXT, "Hello world Hello world Hello world Hello world");
+
+  application.SendNotification();
+  application.Render();
+
+  const Vector3 newNaturalSize = label.GetNaturalSize();
+  DALI_TEST_CHECK(newNaturalSize.width <= size.width);
+  DALI_TEST_CHECK(newNaturalSize.height <= size.height);
+  DALI_TEST_CHECK(gTextFitChangedCallBackCalled);
+
+  END_TEST;
+}
+
 int UtcDaliToolkitTextlabelMaxTextureSet(void)
 {
   ToolkitTestApplication application;
@@ -2090,6 +2134,121 @@ int UtcDaliToolkitTextlabelMaxTextureSet(void)
   END_TEST;
 }
 
+int UtcDaliToolkitTextlabelMaxTextureSetTileCount(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitTextlabelMaxTextureSetTileCount");
+
+  const int maxTextureSize = Dali::GetMaxTextureSize();
+
+  TextLabel label = TextLabel::New();
+  label.SetProperty(TextLabel::Property::TEXT, "Hello world");
+  label.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  label.SetProperty(TextLabel::Property::VERTICAL_ALIGNMENT, "BOTTOM");
+  label.SetProperty(Actor::Property::SIZE, Vector2(200.f, static_cast<float>(maxTextureSize * 2 + 1)));
+
+  application.GetScene().Add(label);
+
+  application.SendNotification();
+  application.Render();
+
+  // Each tile of maxTextureSize rows gets its own renderer, the last one covers the remaining row.
+  DALI_TEST_EQUALS(label.GetRendererCount(), 3u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliToolkitTextlabelMaxTextureSetVisibleArea(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitTextlabelMaxTextureSetVisibleArea");
+
+  const int maxTextureSize = Dali::GetMaxTextureSize();
+
+  TextLabel label = TextLabel::New();
+  label.SetProperty(TextLabel::Property::TEXT, "Hello world");
+  label.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  label.SetProperty(TextLabel::Property::VERTICAL_ALIGNMENT, "BOTTOM");
+  label.SetProperty(Actor::Property::SIZE, Vector2(200.f, static_cast<float>(maxTextureSize * 2 + 1)));
+  label.SetProperty(DevelTextLabel::Property::VISIBLE_AREA, Vector4(0.f, 0.f, 200.f, 100.f));
+  DALI_TEST_EQUALS(label.GetProperty<Vector4>(DevelTextLabel::Property::VISIBLE_AREA), Vector4(0.f, 0.f, 200.f, 100.f), TEST_LOCATION);
+
+  application.GetScene().Add(label);
+
+  application.SendNotification();
+  application.Render();
+
+  // Only the first tile is within the visible area.
+  DALI_TEST_EQUALS(label.GetRendererCount(), 1u, TEST_LOCATION);
+
+  // The tiles are updated on the next relayout, not by the property setter.
+  label.SetProperty(DevelTextLabel::Property::VISIBLE_AREA, Vector4(0.f, static_cast<float>(maxTextureSize * 2), 200.f, 1.f));
+  DALI_TEST_EQUALS(label.GetRendererCount(), 1u, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  // The last tile is rendered once it becomes visible, the first one is released as it is far from the visible area.
+  DALI_TEST_EQUALS(label.GetRendererCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(label.GetRendererAt(0u).GetProperty<Vector2>(VisualRenderer::Property::TRANSFORM_OFFSET).y, static_cast<float>(maxTextureSize * 2), TEST_LOCATION);
+
+  // The visible area crosses the first two tiles, the last one is kept within the margin of the visible area.
+  label.SetProperty(DevelTextLabel::Property::VISIBLE_AREA, Vector4(0.f, static_cast<float>(maxTextureSize - 50), 200.f, static_cast<float>(maxTextureSize)));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(label.GetRendererCount(), 3u, TEST_LOCATION);
+
+  // The visible area moves back to the first tile, the last tile is released but the second one is within the margin.
+  label.SetProperty(DevelTextLabel::Property::VISIBLE_AREA, Vector4(0.f, static_cast<float>(maxTextureSize - 150), 200.f, 100.f));
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(label.GetRendererCount(), 2u, TEST_LOCATION);
+
+  // The whole label is visible.
+  label.SetProperty(DevelTextLabel::Property::VISIBLE_AREA, Vector4::ZERO);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(label.GetRendererCount(), 3u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliToolkitTextlabelAsyncRendering(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitTextlabelAsyncRendering");
+
+  TextLabel label = TextLabel::New();
+  label.SetProperty(TextLabel::Property::TEXT, "Hello world");
+  label.SetProperty(Actor::Property::SIZE, Vector2(200.f, 100.f));
+  label.SetProperty(DevelTextLabel::Property::ENABLE_ASYNC_RENDERING, true);
+  DALI_TEST_EQUALS(label.GetProperty<bool>(DevelTextLabel::Property::ENABLE_ASYNC_RENDERING), true, TEST_LOCATION);
+
+  application.GetScene().Add(label);
+
+  application.SendNotification();
+  application.Render();
+
+  // The text is rasterized in the worker thread, no renderer is added until it finishes.
+  DALI_TEST_EQUALS(label.GetRendererCount(), 0u, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS(label.GetRendererCount(), 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(label.GetRendererAt(0u).GetTextures().GetTextureCount() > 0u);
+
+  END_TEST;
+}
+
 int UtcDaliToolkitTextlabelStrikethroughExceedsWidthAndHeight(void)
 {
   ToolkitTestApplication application;
@@ -493,7 +493,8 @@ int UtcDaliVisualSetOnOffScene2(void)
 
   application.SendNotification();
   application.Render(0);
-  DALI_TEST_EQUALS(Test::WaitForEventThreadTrigger(1), true, TEST_LOCATION);
+
+  // The rasterized image is cached, so it is applied without waiting for the rasterization
   DALI_TEST_CHECK(actor.GetRendererCount() == 1u);
   renderer = actor.GetRendererAt(0);
   textures = renderer.GetTextures();
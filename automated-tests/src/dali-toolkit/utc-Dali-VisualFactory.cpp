@@ -2793,3 +2793,126 @@ int UtcDaliVisualFactoryGetAnimatedImageVisual2(void)
 
   END_TEST;
 }
+
+int UtcDaliVisualFactoryCreateVisualFromDescriptor(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryCreateVisualFromDescriptor: Request visuals with a VisualDescriptor");
+
+  VisualFactory factory = VisualFactory::Get();
+  DALI_TEST_CHECK(factory);
+
+  // The type of visual is chosen by the url, as with the map.
+  struct
+  {
+    const char* url;
+    int         visualType;
+  } urls[] = {
+    {TEST_IMAGE_FILE_NAME, Visual::IMAGE},
+    {TEST_NPATCH_FILE_NAME, Visual::N_PATCH},
+    {TEST_SVG_FILE_NAME, Visual::SVG},
+    {TEST_GIF_FILE_NAME, Visual::ANIMATED_IMAGE},
+  };
+
+  for(const auto& url : urls)
+  {
+    Property::Map propertyMap;
+    propertyMap.Insert(Visual::Property::TYPE, Visual::IMAGE);
+    propertyMap.Insert(ImageVisual::Property::URL, url.url);
+
+    VisualDescriptor descriptor = VisualDescriptor::New(propertyMap);
+    DALI_TEST_CHECK(descriptor);
+
+    for(int i = 0; i < 2; ++i)
+    {
+      Visual::Base visual = factory.CreateVisual(descriptor);
+      DALI_TEST_CHECK(visual);
+
+      Property::Map resultMap;
+      visual.CreatePropertyMap(resultMap);
+      Property::Value* typeValue = resultMap.Find(Visual::Property::TYPE, Property::INTEGER);
+      DALI_TEST_CHECK(typeValue);
+      DALI_TEST_EQUALS(typeValue->Get<int>(), url.visualType, TEST_LOCATION);
+
+      Property::Value* urlValue = resultMap.Find(ImageVisual::Property::URL, Property::STRING);
+      DALI_TEST_CHECK(urlValue);
+      DALI_TEST_EQUALS(urlValue->Get<std::string>(), url.url, TEST_LOCATION);
+    }
+  }
+
+  // The descriptor keeps its own copy of the map.
+  Property::Map propertyMap;
+  propertyMap.Insert(Visual::Property::TYPE, Visual::COLOR);
+  propertyMap.Insert(ColorVisual::Property::MIX_COLOR, Color::RED);
+
+  VisualDescriptor descriptor = VisualDescriptor::New(propertyMap);
+  propertyMap.Clear();
+  DALI_TEST_EQUALS(descriptor.GetProperties().Count(), 2u, TEST_LOCATION);
+
+  Visual::Base visual = factory.CreateVisual(descriptor);
+  DALI_TEST_CHECK(visual);
+
+  Property::Map resultMap;
+  visual.CreatePropertyMap(resultMap);
+  Property::Value* colorValue = resultMap.Find(ColorVisual::Property::MIX_COLOR, Property::VECTOR4);
+  DALI_TEST_CHECK(colorValue);
+  DALI_TEST_EQUALS(colorValue->Get<Vector4>(), Color::RED, TEST_LOCATION);
+
+  // The string keys which every visual reads are converted to index keys.
+  propertyMap.Clear();
+  propertyMap.Insert("visualType", "IMAGE");
+  propertyMap.Insert("url", TEST_IMAGE_FILE_NAME);
+  propertyMap.Insert("mixColor", Color::BLUE);
+  propertyMap.Insert("desiredWidth", 20);
+
+  descriptor = VisualDescriptor::New(propertyMap);
+
+  const Property::Map& descriptorMap = descriptor.GetProperties();
+  DALI_TEST_EQUALS(descriptorMap.Count(), 4u, TEST_LOCATION);
+  DALI_TEST_CHECK(descriptorMap.Find(Visual::Property::TYPE));
+  DALI_TEST_CHECK(descriptorMap.Find(ImageVisual::Property::URL));
+  DALI_TEST_CHECK(descriptorMap.Find(Visual::Property::MIX_COLOR));
+  DALI_TEST_CHECK(!descriptorMap.Find("mixColor"));
+  DALI_TEST_CHECK(descriptorMap.Find("desiredWidth"));
+
+  visual = factory.CreateVisual(descriptor);
+  DALI_TEST_CHECK(visual);
+
+  resultMap.Clear();
+  visual.CreatePropertyMap(resultMap);
+  colorValue = resultMap.Find(Visual::Property::MIX_COLOR, Property::VECTOR4);
+  DALI_TEST_CHECK(colorValue);
+  DALI_TEST_EQUALS(colorValue->Get<Vector4>(), Color::BLUE, TEST_LOCATION);
+  Property::Value* widthValue = resultMap.Find(ImageVisual::Property::DESIRED_WIDTH, Property::INTEGER);
+  DALI_TEST_CHECK(widthValue);
+  DALI_TEST_EQUALS(widthValue->Get<int>(), 20, TEST_LOCATION);
+
+  // A handle to another object isn't a descriptor.
+  DALI_TEST_CHECK(VisualDescriptor::DownCast(BaseHandle(descriptor)));
+  DALI_TEST_CHECK(!VisualDescriptor::DownCast(BaseHandle(factory)));
+
+  END_TEST;
+}
+
+int UtcDaliVisualFactoryCreateVisualFromDescriptorN(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline("UtcDaliVisualFactoryCreateVisualFromDescriptorN: Request visuals with a VisualDescriptor without url");
+
+  VisualFactory factory = VisualFactory::Get();
+  DALI_TEST_CHECK(factory);
+
+  Property::Map propertyMap;
+  propertyMap.Insert(Visual::Property::TYPE, Visual::N_PATCH);
+  propertyMap.Insert(ImageVisual::Property::URL, "");
+
+  VisualDescriptor descriptor = VisualDescriptor::New(propertyMap);
+  DALI_TEST_CHECK(!factory.CreateVisual(descriptor));
+
+  propertyMap.Clear();
+  propertyMap.Insert(Visual::Property::TYPE, Visual::IMAGE);
+  descriptor = VisualDescriptor::New(propertyMap);
+  DALI_TEST_CHECK(!factory.CreateVisual(descriptor));
+
+  END_TEST;
+}
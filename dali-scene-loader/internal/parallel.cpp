@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "dali-scene-loader/internal/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace Dali
+{
+namespace SceneLoader
+{
+namespace
+{
+/**
+ * @brief Whether the current thread is running jobs of RunInParallel(). Those already
+ *  use all the cores, so the jobs that they start in turn are run on the same thread.
+ */
+thread_local bool tIsRunningJobs = false;
+
+uint32_t GetNumberOfCores()
+{
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+} // namespace
+
+void RunInParallel(const std::vector<std::function<void()>>& jobs)
+{
+  std::atomic<size_t> next{0u};
+  std::mutex          mutex;
+  std::exception_ptr  exception;
+
+  auto work = [&]() {
+    const bool wasRunningJobs = tIsRunningJobs;
+    tIsRunningJobs            = true;
+    for(size_t i = next++; i < jobs.size(); i = next++)
+    {
+      try
+      {
+        jobs[i]();
+      }
+      catch(...)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!exception)
+        {
+          exception = std::current_exception();
+        }
+        next = jobs.size();
+      }
+    }
+    tIsRunningJobs = wasRunningJobs;
+  };
+
+  const size_t             numThreads = tIsRunningJobs ? 1u : std::min<size_t>(GetNumberOfCores(), jobs.size());
+  std::vector<std::thread> threads;
+  for(size_t i = 1u; i < numThreads; ++i)
+  {
+    try
+    {
+      threads.emplace_back(work);
+    }
+    catch(const std::system_error&)
+    {
+      break; // the threads that could be started do the work.
+    }
+  }
+
+  work();
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  if(exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+
+void ParallelFor(uint32_t count, uint32_t minChunkSize, const std::function<void(uint32_t begin, uint32_t end)>& function)
+{
+  const uint32_t numChunks = tIsRunningJobs ? 1u : std::min(GetNumberOfCores(), count / std::max(minChunkSize, 1u));
+  if(numChunks <= 1u)
+  {
+    function(0u, count);
+    return;
+  }
+
+  uint32_t chunkSize = (count + numChunks - 1u) / numChunks;
+  chunkSize          = (chunkSize + 3u) & ~3u;
+
+  std::vector<std::function<void()>> jobs;
+  for(uint32_t begin = 0u; begin < count; begin += chunkSize)
+  {
+    const uint32_t end = std::min(count, begin + chunkSize);
+    jobs.push_back([&function, begin, end]() {
+      function(begin, end);
+    });
+  }
+  RunInParallel(jobs);
+}
+
+} // namespace SceneLoader
+} // namespace Dali
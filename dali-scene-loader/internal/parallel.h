@@ -0,0 +1,49 @@
+#ifndef DALI_SCENE_LOADER_PARALLEL_H_
+#define DALI_SCENE_LOADER_PARALLEL_H_
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Dali
+{
+namespace SceneLoader
+{
+/**
+ * @brief Runs the @a jobs on the calling thread and on worker threads, up to one
+ *  thread per core. Once all threads have finished, the first exception thrown
+ *  by a job, if any, is rethrown; the jobs not yet started are then skipped.
+ * @note When called from a job, the @a jobs are all run on the calling thread, so that
+ *  nested calls don't start threads of their own.
+ */
+void RunInParallel(const std::vector<std::function<void()>>& jobs);
+
+/**
+ * @brief Calls @a function on consecutive ranges [begin, end) covering [0, @a count),
+ *  in parallel as RunInParallel() does. The ranges have at least @a minChunkSize
+ *  elements, and all but the last one a multiple of 4 elements, so that they can be
+ *  processed with SIMD instructions. Small counts, and those of a ParallelFor() called
+ *  from a job of RunInParallel(), are processed on the calling thread.
+ */
+void ParallelFor(uint32_t count, uint32_t minChunkSize, const std::function<void(uint32_t begin, uint32_t end)>& function);
+
+} // namespace SceneLoader
+} // namespace Dali
+
+#endif // DALI_SCENE_LOADER_PARALLEL_H_
@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "dali-scene-loader/internal/vertex-kernels.h"
+
+#include <algorithm>
+#include "dali/public-api/common/constants.h"
+#include "dali/public-api/math/math-utils.h"
+
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define DALI_SCENE_LOADER_VERTEX_KERNELS_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define DALI_SCENE_LOADER_VERTEX_KERNELS_SSE2
+#endif
+
+namespace Dali
+{
+namespace SceneLoader
+{
+namespace
+{
+#if defined(DALI_SCENE_LOADER_VERTEX_KERNELS_SSE2)
+
+using Float4 = __m128;
+using Mask4  = __m128;
+
+inline Float4 Set(float value)
+{
+  return _mm_set1_ps(value);
+}
+
+inline Float4 Load(const float* values)
+{
+  return _mm_loadu_ps(values);
+}
+
+inline void Store(float* values, Float4 v)
+{
+  _mm_storeu_ps(values, v);
+}
+
+inline Float4 Add(Float4 a, Float4 b)
+{
+  return _mm_add_ps(a, b);
+}
+
+inline Float4 Sub(Float4 a, Float4 b)
+{
+  return _mm_sub_ps(a, b);
+}
+
+inline Float4 Mul(Float4 a, Float4 b)
+{
+  return _mm_mul_ps(a, b);
+}
+
+inline Float4 Div(Float4 a, Float4 b)
+{
+  return _mm_div_ps(a, b);
+}
+
+inline Float4 Sqrt(Float4 a)
+{
+  return _mm_sqrt_ps(a);
+}
+
+inline Float4 Min(Float4 a, Float4 b)
+{
+  return _mm_min_ps(a, b);
+}
+
+inline Float4 Max(Float4 a, Float4 b)
+{
+  return _mm_max_ps(a, b);
+}
+
+inline Mask4 Greater(Float4 a, Float4 b)
+{
+  return _mm_cmpgt_ps(a, b);
+}
+
+inline Float4 Select(Mask4 mask, Float4 a, Float4 b)
+{
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+inline float HorizontalMax(Float4 a)
+{
+  a = _mm_max_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 0, 3, 2)));
+  a = _mm_max_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(a);
+}
+
+/**
+ * @brief The components of four Vector3s.
+ */
+struct Float3x4
+{
+  Float4 x;
+  Float4 y;
+  Float4 z;
+};
+
+/**
+ * @brief Loads four consecutive Vector3s, and transposes them.
+ */
+inline Float3x4 Load3x4(const float* vectors)
+{
+  // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+  const Float4 a = _mm_loadu_ps(vectors);
+  const Float4 b = _mm_loadu_ps(vectors + 4);
+  const Float4 c = _mm_loadu_ps(vectors + 8);
+
+  const Float4 b2b2c1c1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+  const Float4 a1a1b0b0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+  const Float4 b3b3c2c2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+  const Float4 a2a2b1b1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+
+  return Float3x4{_mm_shuffle_ps(a, b2b2c1c1, _MM_SHUFFLE(2, 0, 3, 0)),
+                  _mm_shuffle_ps(a1a1b0b0, b3b3c2c2, _MM_SHUFFLE(2, 0, 2, 0)),
+                  _mm_shuffle_ps(a2a2b1b1, c, _MM_SHUFFLE(3, 0, 2, 0))};
+}
+
+/**
+ * @brief Transposes back, and stores four consecutive Vector3s.
+ */
+inline void Store3x4(float* vectors, const Float3x4& v)
+{
+  const Float4 x0x0y0y0 = _mm_shuffle_ps(v.x, v.y, _MM_SHUFFLE(0, 0, 0, 0));
+  const Float4 z0z0x1x1 = _mm_shuffle_ps(v.z, v.x, _MM_SHUFFLE(1, 1, 0, 0));
+  const Float4 y1y1z1z1 = _mm_shuffle_ps(v.y, v.z, _MM_SHUFFLE(1, 1, 1, 1));
+  const Float4 x2x2y2y2 = _mm_shuffle_ps(v.x, v.y, _MM_SHUFFLE(2, 2, 2, 2));
+  const Float4 z2z2x3x3 = _mm_shuffle_ps(v.z, v.x, _MM_SHUFFLE(3, 3, 2, 2));
+  const Float4 y3y3z3z3 = _mm_shuffle_ps(v.y, v.z, _MM_SHUFFLE(3, 3, 3, 3));
+
+  _mm_storeu_ps(vectors, _mm_shuffle_ps(x0x0y0y0, z0z0x1x1, _MM_SHUFFLE(2, 0, 2, 0)));
+  _mm_storeu_ps(vectors + 4, _mm_shuffle_ps(y1y1z1z1, x2x2y2y2, _MM_SHUFFLE(2, 0, 2, 0)));
+  _mm_storeu_ps(vectors + 8, _mm_shuffle_ps(z2z2x3x3, y3y3z3z3, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+#elif defined(DALI_SCENE_LOADER_VERTEX_KERNELS_NEON)
+
+using Float4 = float32x4_t;
+using Mask4  = uint32x4_t;
+
+inline Float4 Set(float value)
+{
+  return vdupq_n_f32(value);
+}
+
+inline Float4 Load(const float* values)
+{
+  return vld1q_f32(values);
+}
+
+inline void Store(float* values, Float4 v)
+{
+  vst1q_f32(values, v);
+}
+
+inline Float4 Add(Float4 a, Float4 b)
+{
+  return vaddq_f32(a, b);
+}
+
+inline Float4 Sub(Float4 a, Float4 b)
+{
+  return vsubq_f32(a, b);
+}
+
+inline Float4 Mul(Float4 a, Float4 b)
+{
+  return vmulq_f32(a, b);
+}
+
+inline Float4 Div(Float4 a, Float4 b)
+{
+  return vdivq_f32(a, b);
+}
+
+inline Float4 Sqrt(Float4 a)
+{
+  return vsqrtq_f32(a);
+}
+
+inline Float4 Min(Float4 a, Float4 b)
+{
+  return vminq_f32(a, b);
+}
+
+inline Float4 Max(Float4 a, Float4 b)
+{
+  return vmaxq_f32(a, b);
+}
+
+inline Mask4 Greater(Float4 a, Float4 b)
+{
+  return vcgtq_f32(a, b);
+}
+
+inline Float4 Select(Mask4 mask, Float4 a, Float4 b)
+{
+  return vbslq_f32(mask, a, b);
+}
+
+inline float HorizontalMax(Float4 a)
+{
+  return vmaxvq_f32(a);
+}
+
+/**
+ * @brief The components of four Vector3s.
+ */
+struct Float3x4
+{
+  Float4 x;
+  Float4 y;
+  Float4 z;
+};
+
+/**
+ * @brief Loads four consecutive Vector3s, and transposes them.
+ */
+inline Float3x4 Load3x4(const float* vectors)
+{
+  const float32x4x3_t v = vld3q_f32(vectors);
+  return Float3x4{v.val[0], v.val[1], v.val[2]};
+}
+
+/**
+ * @brief Transposes back, and stores four consecutive Vector3s.
+ */
+inline void Store3x4(float* vectors, const Float3x4& v)
+{
+  float32x4x3_t result;
+  result.val[0] = v.x;
+  result.val[1] = v.y;
+  result.val[2] = v.z;
+  vst3q_f32(vectors, result);
+}
+
+#endif
+
+#if defined(DALI_SCENE_LOADER_VERTEX_KERNELS_SSE2) || defined(DALI_SCENE_LOADER_VERTEX_KERNELS_NEON)
+
+inline Float4 Dot(const Float3x4& a, const Float3x4& b)
+{
+  return Add(Add(Mul(a.x, b.x), Mul(a.y, b.y)), Mul(a.z, b.z));
+}
+
+/**
+ * @brief Normalizes four vectors as Vector3::Normalize(): those too short to be normalized are kept.
+ */
+inline void Normalize(Float3x4& v)
+{
+  const Float4 length        = Sqrt(Dot(v, v));
+  const Float4 inverseLength = Div(Set(1.0f), length);
+  const Mask4  normalizable  = Greater(length, Set(Math::MACHINE_EPSILON_0));
+
+  v.x = Select(normalizable, Mul(v.x, inverseLength), v.x);
+  v.y = Select(normalizable, Mul(v.y, inverseLength), v.y);
+  v.z = Select(normalizable, Mul(v.z, inverseLength), v.z);
+}
+
+/**
+ * @brief Removes the component of the tangents along the normals, and normalizes them.
+ */
+inline void Orthonormalize(Float3x4& tangents, const Float3x4& normals)
+{
+  const Float4 dot = Dot(normals, tangents);
+  tangents.x       = Sub(tangents.x, Mul(normals.x, dot));
+  tangents.y       = Sub(tangents.y, Mul(normals.y, dot));
+  tangents.z       = Sub(tangents.z, Mul(normals.z, dot));
+  Normalize(tangents);
+}
+
+#endif
+
+} // namespace
+
+namespace Scalar
+{
+void NormalizeVectors(Vector3* vectors, uint32_t count)
+{
+  for(auto end = vectors + count; vectors != end; ++vectors)
+  {
+    vectors->Normalize();
+  }
+}
+
+void OrthonormalizeTangents(Vector3* tangents, const Vector3* normals, uint32_t count)
+{
+  for(auto end = tangents + count; tangents != end; ++tangents, ++normals)
+  {
+    *tangents -= *normals * normals->Dot(*tangents);
+    tangents->Normalize();
+  }
+}
+
+void CalculateTangents(const Vector3* normals, Vector3* tangents, uint32_t count)
+{
+  for(auto end = normals + count; normals != end; ++tangents, ++normals)
+  {
+    Vector3 t[]{normals->Cross(Vector3::XAXIS), normals->Cross(Vector3::YAXIS)};
+
+    *tangents = t[t[1].LengthSquared() > t[0].LengthSquared()];
+    *tangents -= *normals * normals->Dot(*tangents);
+    tangents->Normalize();
+  }
+}
+
+float GetMaxLengthSquared(const Vector3* vectors, uint32_t count)
+{
+  float maxLengthSquared = 0.f;
+  for(auto end = vectors + count; vectors != end; ++vectors)
+  {
+    maxLengthSquared = std::max(maxLengthSquared, vectors->LengthSquared());
+  }
+  return maxLengthSquared;
+}
+
+void ScaleAndOffset(float* values, uint32_t count, float scale, float offset)
+{
+  for(auto end = values + count; values != end; ++values)
+  {
+    *values = *values * scale + offset;
+  }
+}
+
+void ScaleOffsetAndClamp(float* values, uint32_t count, float scale, float offset)
+{
+  for(auto end = values + count; values != end; ++values)
+  {
+    *values = Clamp(*values * scale + offset, 0.f, 1.f);
+  }
+}
+
+} // namespace Scalar
+
+#if defined(DALI_SCENE_LOADER_VERTEX_KERNELS_SSE2) || defined(DALI_SCENE_LOADER_VERTEX_KERNELS_NEON)
+
+bool IsVertexKernelsVectorized()
+{
+  return true;
+}
+
+void NormalizeVectors(Vector3* vectors, uint32_t count)
+{
+  float* values = reinterpret_cast<float*>(vectors);
+  for(uint32_t i = count / 4u; i > 0u; --i, values += 12u)
+  {
+    Float3x4 v = Load3x4(values);
+    Normalize(v);
+    Store3x4(values, v);
+  }
+  Scalar::NormalizeVectors(vectors + (count & ~3u), count & 3u);
+}
+
+void OrthonormalizeTangents(Vector3* tangents, const Vector3* normals, uint32_t count)
+{
+  float*       t = reinterpret_cast<float*>(tangents);
+  const float* n = reinterpret_cast<const float*>(normals);
+  for(uint32_t i = count / 4u; i > 0u; --i, t += 12u, n += 12u)
+  {
+    Float3x4 v = Load3x4(t);
+    Orthonormalize(v, Load3x4(n));
+    Store3x4(t, v);
+  }
+  Scalar::OrthonormalizeTangents(tangents + (count & ~3u), normals + (count & ~3u), count & 3u);
+}
+
+void CalculateTangents(const Vector3* normals, Vector3* tangents, uint32_t count)
+{
+  const Float4 zero = Set(0.f);
+  float*       t    = reinterpret_cast<float*>(tangents);
+  const float* n    = reinterpret_cast<const float*>(normals);
+  for(uint32_t i = count / 4u; i > 0u; --i, t += 12u, n += 12u)
+  {
+    const Float3x4 normal = Load3x4(n);
+
+    // normal x XAXIS = (0, z, -y), normal x YAXIS = (-z, 0, x); the latter is longer if x * x > y * y.
+    const Float4 zz   = Mul(normal.z, normal.z);
+    const Mask4  useY = Greater(Add(zz, Mul(normal.x, normal.x)), Add(zz, Mul(normal.y, normal.y)));
+
+    Float3x4 v = {Select(useY, Sub(zero, normal.z), zero),
+                  Select(useY, zero, normal.z),
+                  Select(useY, normal.x, Sub(zero, normal.y))};
+    Orthonormalize(v, normal);
+    Store3x4(t, v);
+  }
+  Scalar::CalculateTangents(normals + (count & ~3u), tangents + (count & ~3u), count & 3u);
+}
+
+float GetMaxLengthSquared(const Vector3* vectors, uint32_t count)
+{
+  Float4       maxLengthSquared = Set(0.f);
+  const float* values           = reinterpret_cast<const float*>(vectors);
+  for(uint32_t i = count / 4u; i > 0u; --i, values += 12u)
+  {
+    const Float3x4 v = Load3x4(values);
+    maxLengthSquared = Max(maxLengthSquared, Dot(v, v));
+  }
+  return std::max(HorizontalMax(maxLengthSquared), Scalar::GetMaxLengthSquared(vectors + (count & ~3u), count & 3u));
+}
+
+void ScaleAndOffset(float* values, uint32_t count, float scale, float offset)
+{
+  const Float4 scale4  = Set(scale);
+  const Float4 offset4 = Set(offset);
+  for(uint32_t i = count / 4u; i > 0u; --i, values += 4u)
+  {
+    Store(values, Add(Mul(Load(values), scale4), offset4));
+  }
+  Scalar::ScaleAndOffset(values, count & 3u, scale, offset);
+}
+
+void ScaleOffsetAndClamp(float* values, uint32_t count, float scale, float offset)
+{
+  const Float4 scale4  = Set(scale);
+  const Float4 offset4 = Set(offset);
+  const Float4 zero    = Set(0.f);
+  const Float4 one     = Set(1.f);
+  for(uint32_t i = count / 4u; i > 0u; --i, values += 4u)
+  {
+    Store(values, Max(Min(Add(Mul(Load(values), scale4), offset4), one), zero));
+  }
+  Scalar::ScaleOffsetAndClamp(values, count & 3u, scale, offset);
+}
+
+#else
+
+bool IsVertexKernelsVectorized()
+{
+  return false;
+}
+
+void NormalizeVectors(Vector3* vectors, uint32_t count)
+{
+  Scalar::NormalizeVectors(vectors, count);
+}
+
+void OrthonormalizeTangents(Vector3* tangents, const Vector3* normals, uint32_t count)
+{
+  Scalar::OrthonormalizeTangents(tangents, normals, count);
+}
+
+void CalculateTangents(const Vector3* normals, Vector3* tangents, uint32_t count)
+{
+  Scalar::CalculateTangents(normals, tangents, count);
+}
+
+float GetMaxLengthSquared(const Vector3* vectors, uint32_t count)
+{
+  return Scalar::GetMaxLengthSquared(vectors, count);
+}
+
+void ScaleAndOffset(float* values, uint32_t count, float scale, float offset)
+{
+  Scalar::ScaleAndOffset(values, count, scale, offset);
+}
+
+void ScaleOffsetAndClamp(float* values, uint32_t count, float scale, float offset)
+{
+  Scalar::ScaleOffsetAndClamp(values, count, scale, offset);
+}
+
+#endif
+
+} // namespace SceneLoader
+} // namespace Dali
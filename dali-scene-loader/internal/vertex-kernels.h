@@ -0,0 +1,87 @@
+#ifndef DALI_SCENE_LOADER_VERTEX_KERNELS_H_
+#define DALI_SCENE_LOADER_VERTEX_KERNELS_H_
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include "dali/public-api/math/vector3.h"
+
+namespace Dali
+{
+namespace SceneLoader
+{
+/**
+ * The per-vertex processing of the meshes: the normalization of generated normals and
+ * tangents, and the packing of blend shapes into a texture.
+ *
+ * Each kernel has an SSE2 and a NEON (AArch64) version, chosen at compile time, which
+ * processes four vertices at once, and a scalar version in the Scalar namespace which
+ * also handles the vertices left over by the vector loops.
+ */
+
+/**
+ * @brief Whether the kernels use SIMD instructions (SSE2 or NEON).
+ */
+bool IsVertexKernelsVectorized();
+
+/**
+ * @brief Normalizes @a count vectors, as Vector3::Normalize() does.
+ */
+void NormalizeVectors(Vector3* vectors, uint32_t count);
+
+/**
+ * @brief Makes @a count tangents perpendicular to their normal, and normalizes them.
+ */
+void OrthonormalizeTangents(Vector3* tangents, const Vector3* normals, uint32_t count);
+
+/**
+ * @brief Calculates a tangent for each of the @a count normals, when the mesh has no
+ *  texture coordinates: the cross product of the normal with the X or the Y axis,
+ *  whichever is longer, orthonormalized.
+ */
+void CalculateTangents(const Vector3* normals, Vector3* tangents, uint32_t count);
+
+/**
+ * @return The maximum squared length of @a count vectors, 0 if there are none.
+ */
+float GetMaxLengthSquared(const Vector3* vectors, uint32_t count);
+
+/**
+ * @brief Sets each of @a count values to value * @a scale + @a offset.
+ */
+void ScaleAndOffset(float* values, uint32_t count, float scale, float offset);
+
+/**
+ * @brief Sets each of @a count values to value * @a scale + @a offset, clamped to [0, 1].
+ */
+void ScaleOffsetAndClamp(float* values, uint32_t count, float scale, float offset);
+
+namespace Scalar
+{
+void  NormalizeVectors(Vector3* vectors, uint32_t count);
+void  OrthonormalizeTangents(Vector3* tangents, const Vector3* normals, uint32_t count);
+void  CalculateTangents(const Vector3* normals, Vector3* tangents, uint32_t count);
+float GetMaxLengthSquared(const Vector3* vectors, uint32_t count);
+void  ScaleAndOffset(float* values, uint32_t count, float scale, float offset);
+void  ScaleOffsetAndClamp(float* values, uint32_t count, float scale, float offset);
+
+} // namespace Scalar
+
+} // namespace SceneLoader
+} // namespace Dali
+
+#endif // DALI_SCENE_LOADER_VERTEX_KERNELS_H_
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "dali-scene-loader/public-api/buffer-cache.h"
+
+// EXTERNAL INCLUDES
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+
+namespace Dali
+{
+namespace SceneLoader
+{
+namespace
+{
+struct FileDescriptor
+{
+  explicit FileDescriptor(const std::string& path)
+  : mFd(open(path.c_str(), O_RDONLY | O_CLOEXEC))
+  {
+  }
+
+  ~FileDescriptor()
+  {
+    if(mFd >= 0)
+    {
+      close(mFd);
+    }
+  }
+
+  int mFd;
+};
+
+bool ReadFully(int fd, uint8_t* target, size_t size)
+{
+  while(size > 0)
+  {
+    const ssize_t count = read(fd, target, size);
+    if(count < 0 && errno == EINTR)
+    {
+      continue;
+    }
+
+    if(count <= 0)
+    {
+      return false;
+    }
+
+    target += count;
+    size -= count;
+  }
+  return true;
+}
+
+} // namespace
+
+BufferData::Ptr BufferData::Load(const std::string& path)
+{
+  FileDescriptor file(path);
+  struct stat    status;
+  if(file.mFd < 0 || fstat(file.mFd, &status) != 0 || !S_ISREG(status.st_mode))
+  {
+    return nullptr;
+  }
+
+  std::shared_ptr<BufferData> buffer(new BufferData());
+  buffer->mSize = static_cast<size_t>(status.st_size);
+  if(buffer->mSize == 0)
+  {
+    return buffer;
+  }
+
+  void* mapping = mmap(nullptr, buffer->mSize, PROT_READ, MAP_PRIVATE, file.mFd, 0);
+  if(mapping != MAP_FAILED)
+  {
+    // The accessors of the meshes are read shortly, so start reading ahead.
+    madvise(mapping, buffer->mSize, MADV_WILLNEED);
+    buffer->mMapping = mapping;
+    buffer->mData    = static_cast<const uint8_t*>(mapping);
+  }
+  else
+  {
+    buffer->mContents.resize(buffer->mSize);
+    if(!ReadFully(file.mFd, buffer->mContents.data(), buffer->mSize))
+    {
+      return nullptr;
+    }
+    buffer->mData = buffer->mContents.data();
+  }
+  return buffer;
+}
+
+BufferData::~BufferData()
+{
+  if(mMapping)
+  {
+    munmap(mMapping, mSize);
+  }
+}
+
+BufferData::Ptr BufferCache::Get(const std::string& path)
+{
+  std::promise<BufferData::Ptr>       promise;
+  std::shared_future<BufferData::Ptr> future;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto iBuffer = mBuffers.find(path);
+    if(iBuffer != mBuffers.end())
+    {
+      future = iBuffer->second;
+    }
+    else
+    {
+      // Add a placeholder for the other requests of the file to wait on, while we load it.
+      mBuffers.emplace(path, promise.get_future().share());
+    }
+  }
+
+  if(future.valid())
+  {
+    return future.get();
+  }
+
+  auto buffer = BufferData::Load(path);
+  promise.set_value(buffer);
+  if(!buffer)
+  {
+    // Don't keep the failure; the next request tries again.
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto iBuffer = mBuffers.find(path);
+    if(iBuffer != mBuffers.end() &&
+       iBuffer->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready &&
+       !iBuffer->second.get())
+    {
+      mBuffers.erase(iBuffer);
+    }
+  }
+  return buffer;
+}
+
+void BufferCache::Clear()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mBuffers.clear();
+}
+
+} // namespace SceneLoader
+} // namespace Dali
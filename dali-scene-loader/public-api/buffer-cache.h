@@ -0,0 +1,125 @@
+#ifndef DALI_SCENE_LOADER_BUFFER_CACHE_H
+#define DALI_SCENE_LOADER_BUFFER_CACHE_H
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "dali-scene-loader/public-api/api.h"
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "dali/public-api/common/vector-wrapper.h"
+
+namespace Dali
+{
+namespace SceneLoader
+{
+/**
+ * @brief The read-only contents of a binary buffer file. The file is memory-mapped
+ *  where possible, so that only the pages that are accessed get read; otherwise it
+ *  is read into memory.
+ */
+class DALI_SCENE_LOADER_API BufferData
+{
+public:
+  using Ptr = std::shared_ptr<const BufferData>;
+
+  /**
+   * @brief Maps or reads the file at @a path.
+   * @return The contents of the file, or nullptr if it couldn't be opened or read.
+   */
+  static Ptr Load(const std::string& path);
+
+  ~BufferData();
+
+  BufferData(const BufferData&) = delete;
+  BufferData& operator=(const BufferData&) = delete;
+
+  /**
+   * @return The first byte of the contents.
+   */
+  const uint8_t* GetData() const
+  {
+    return mData;
+  }
+
+  /**
+   * @return The size of the contents, in bytes.
+   */
+  size_t GetSize() const
+  {
+    return mSize;
+  }
+
+  /**
+   * @brief Whether the @a length bytes from @a offset are all within the contents.
+   */
+  bool IsInRange(uint64_t offset, uint64_t length) const
+  {
+    return offset <= mSize && length <= mSize - offset;
+  }
+
+private:
+  BufferData() = default;
+
+  const uint8_t*       mData    = nullptr;
+  size_t               mSize    = 0;
+  void*                mMapping = nullptr; // the address of the mapping, or nullptr if the file was read into mContents.
+  std::vector<uint8_t> mContents;
+};
+
+/**
+ * @brief Loads each buffer file once, and shares it between all the meshes that
+ *  reference it, e.g. all the meshes of a glTF scene. The buffers are released
+ *  with the cache, unless still referenced.
+ * @note Get() may be called from any thread. The files are loaded without holding the
+ *  lock, so that requests for different files don't wait for each other; requests for
+ *  a file that is being loaded wait for that load.
+ */
+class DALI_SCENE_LOADER_API BufferCache
+{
+public:
+  BufferCache() = default;
+
+  BufferCache(const BufferCache&) = delete;
+  BufferCache& operator=(const BufferCache&) = delete;
+
+  /**
+   * @brief Gets the contents of the file at @a path, loading it on the first request.
+   * @return The contents of the file, or nullptr if it couldn't be loaded.
+   */
+  BufferData::Ptr Get(const std::string& path);
+
+  /**
+   * @brief Releases all the buffers that aren't referenced elsewhere.
+   */
+  void Clear();
+
+private:
+  std::mutex                                                           mMutex;
+  std::unordered_map<std::string, std::shared_future<BufferData::Ptr>> mBuffers; ///< Ready once the file is loaded.
+};
+
+} // namespace SceneLoader
+} // namespace Dali
+
+#endif //DALI_SCENE_LOADER_BUFFER_CACHE_H
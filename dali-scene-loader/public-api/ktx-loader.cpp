@@ -18,8 +18,13 @@
 // FILE HEADER
 #include "dali-scene-loader/public-api/ktx-loader.h"
 
+// INTERNAL INCLUDES
+#include "dali-scene-loader/public-api/buffer-cache.h"
+
 // EXTERNAL INCLUDES
+#include <cstring>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include "dali/public-api/rendering/texture.h"
 
@@ -38,6 +43,9 @@ static_assert(sizeof(KTX_ID_HEAD) + sizeof(KTX_ID_TAIL) == 10);
 static_assert(sizeof(KTX_VERSION_1_1) == 2);
 static_assert(sizeof(KTX_VERSION_2_0) == sizeof(KTX_VERSION_1_1));
 
+const uint32_t KTX2_SUPERCOMPRESSION_NONE = 0u;
+const uint32_t KTX2_NUMBER_OF_CUBE_FACES  = 6u;
+
 void FreeBuffer(uint8_t* buffer)
 {
   delete[] buffer;
@@ -70,6 +78,44 @@ struct KtxFileHeader
             std::equal(KTX_VERSION_2_0, std::end(KTX_VERSION_2_0), identifier + sizeof(KTX_ID_HEAD))) &&
            std::equal(KTX_ID_TAIL, std::end(KTX_ID_TAIL), identifier + (sizeof(KTX_ID_HEAD) + sizeof(KTX_VERSION_1_1)));
   }
+
+  bool IsVersion2() const
+  {
+    return std::equal(KTX_VERSION_2_0, std::end(KTX_VERSION_2_0), identifier + sizeof(KTX_ID_HEAD));
+  }
+};
+
+/**
+ * The header of KTX 2.0 files, followed by the index of their levels.
+ */
+struct Ktx2FileHeader
+{
+  uint8_t  identifier[12];
+  uint32_t vkFormat; // VK_FORMAT_UNDEFINED for the payloads which need transcoding, i.e. Basis Universal.
+  uint32_t typeSize;
+  uint32_t pixelWidth;
+  uint32_t pixelHeight;
+  uint32_t pixelDepth;
+  uint32_t layerCount;
+  uint32_t faceCount;
+  uint32_t levelCount; // 0 if the mipmaps are to be generated.
+  uint32_t supercompressionScheme;
+
+  uint32_t dfdByteOffset;
+  uint32_t dfdByteLength;
+  uint32_t kvdByteOffset;
+  uint32_t kvdByteLength;
+  uint64_t sgdByteOffset;
+  uint64_t sgdByteLength;
+};
+
+static_assert(sizeof(Ktx2FileHeader) == 80);
+
+struct Ktx2LevelIndex
+{
+  uint64_t byteOffset; // from the start of the file.
+  uint64_t byteLength; // of all the layers and faces of the level.
+  uint64_t uncompressedByteLength;
 };
 
 /**
@@ -183,6 +229,168 @@ bool ConvertPixelFormat(const uint32_t ktxPixelFormat, Pixel::Format& format)
   return true;
 }
 
+/**
+ * Convert the VkFormat of KTX 2.0 files to Pixel::Format
+ */
+bool ConvertVkFormat(const uint32_t vkFormat, Pixel::Format& format)
+{
+  // The UNORM and SRGB versions of each block size, from VK_FORMAT_ASTC_4x4_UNORM_BLOCK.
+  constexpr uint32_t      VK_FORMAT_ASTC_FIRST = 157u;
+  constexpr Pixel::Format ASTC_FORMATS[][2]{
+    {Pixel::COMPRESSED_RGBA_ASTC_4x4_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_5x4_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_5x5_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_6x5_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_6x6_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_8x5_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_8x6_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_8x8_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_10x5_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_10x6_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_10x8_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_10x10_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_12x10_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR},
+    {Pixel::COMPRESSED_RGBA_ASTC_12x12_KHR, Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR},
+  };
+
+  if(vkFormat >= VK_FORMAT_ASTC_FIRST && vkFormat < VK_FORMAT_ASTC_FIRST + std::size(ASTC_FORMATS) * 2u)
+  {
+    const uint32_t index = vkFormat - VK_FORMAT_ASTC_FIRST;
+    format               = ASTC_FORMATS[index / 2u][index % 2u];
+    return true;
+  }
+
+  switch(vkFormat)
+  {
+    case 23: // VK_FORMAT_R8G8B8_UNORM
+    case 29: // VK_FORMAT_R8G8B8_SRGB
+    {
+      format = Pixel::RGB888;
+      break;
+    }
+    case 37: // VK_FORMAT_R8G8B8A8_UNORM
+    case 43: // VK_FORMAT_R8G8B8A8_SRGB
+    {
+      format = Pixel::RGBA8888;
+      break;
+    }
+    case 90: // VK_FORMAT_R16G16B16_SFLOAT
+    {
+      format = Pixel::RGB16F;
+      break;
+    }
+    case 106: // VK_FORMAT_R32G32B32_SFLOAT
+    {
+      format = Pixel::RGB32F;
+      break;
+    }
+    case 122: // VK_FORMAT_B10G11R11_UFLOAT_PACK32
+    {
+      format = Pixel::R11G11B10F;
+      break;
+    }
+    case 147: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+    {
+      format = Pixel::COMPRESSED_RGB8_ETC2;
+      break;
+    }
+    case 148: // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+    {
+      format = Pixel::COMPRESSED_SRGB8_ETC2;
+      break;
+    }
+    case 151: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+    {
+      format = Pixel::COMPRESSED_RGBA8_ETC2_EAC;
+      break;
+    }
+    case 152: // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+    {
+      format = Pixel::COMPRESSED_SRGB8_ALPHA8_ETC2_EAC;
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Loads the faces and mipmaps of the first layer of a KTX 2.0 file. The files are mapped,
+ * and each image copied out of the mapping.
+ */
+bool LoadKtx2Data(const std::string& path, CubeData& cubedata)
+{
+  auto buffer = BufferData::Load(path);
+  if(!buffer || !buffer->IsInRange(0u, sizeof(Ktx2FileHeader)))
+  {
+    return false;
+  }
+
+  Ktx2FileHeader header;
+  memcpy(&header, buffer->GetData(), sizeof(Ktx2FileHeader));
+
+  // There's no zstd / zlib decompressor nor Basis Universal transcoder to hand; such files fail
+  // here, either on their supercompression scheme, or on their VK_FORMAT_UNDEFINED.
+  Pixel::Format format;
+  if(header.supercompressionScheme != KTX2_SUPERCOMPRESSION_NONE || !ConvertVkFormat(header.vkFormat, format))
+  {
+    return false;
+  }
+
+  // Only 2D textures and cube maps.
+  if(header.pixelWidth == 0u || header.pixelDepth > 1u || (header.faceCount != 1u && header.faceCount != KTX2_NUMBER_OF_CUBE_FACES))
+  {
+    return false;
+  }
+
+  // A full mipmap chain ends at 1x1, so there are no more levels than floor(log2(max(width, height))) + 1.
+  uint32_t maxNumberOfLevels = 0u;
+  for(uint32_t size = std::max(header.pixelWidth, header.pixelHeight); size > 0u; size >>= 1u)
+  {
+    ++maxNumberOfLevels;
+  }
+  if(header.levelCount > maxNumberOfLevels)
+  {
+    return false;
+  }
+
+  const uint32_t numberOfLevels = std::max(header.levelCount, 1u);
+  const uint32_t numberOfLayers = std::max(header.layerCount, 1u);
+  const uint64_t numberOfImages = uint64_t(numberOfLayers) * header.faceCount;
+  if(!buffer->IsInRange(sizeof(Ktx2FileHeader), uint64_t(numberOfLevels) * sizeof(Ktx2LevelIndex)))
+  {
+    return false;
+  }
+
+  cubedata.data.assign(header.faceCount, std::vector<PixelData>(numberOfLevels));
+  for(uint32_t mipmapLevel = 0u; mipmapLevel < numberOfLevels; ++mipmapLevel)
+  {
+    Ktx2LevelIndex level;
+    memcpy(&level, buffer->GetData() + sizeof(Ktx2FileHeader) + mipmapLevel * sizeof(Ktx2LevelIndex), sizeof(Ktx2LevelIndex));
+    if(level.byteLength % numberOfImages != 0u || !buffer->IsInRange(level.byteOffset, level.byteLength))
+    {
+      return false;
+    }
+
+    // The faces of the first layer come first.
+    const uint32_t byteSize = static_cast<uint32_t>(level.byteLength / numberOfImages);
+    const uint32_t width    = std::max(header.pixelWidth >> mipmapLevel, 1u);
+    const uint32_t height   = std::max(std::max(header.pixelHeight, 1u) >> mipmapLevel, 1u);
+    for(uint32_t face = 0u; face < header.faceCount; ++face)
+    {
+      auto img = new uint8_t[byteSize];
+      memcpy(img, buffer->GetData() + level.byteOffset + uint64_t(face) * byteSize, byteSize);
+      cubedata.data[face][mipmapLevel] = PixelData::New(img, byteSize, width, height, format, PixelData::DELETE_ARRAY);
+    }
+  }
+
+  return true;
+}
+
 Texture CubeData::CreateTexture() const
 {
   Texture texture = Texture::New(TextureType::TEXTURE_CUBE, data[0][0].GetPixelFormat(), data[0][0].GetWidth(), data[0][0].GetHeight());
@@ -217,6 +425,12 @@ bool LoadCubeMapData(const std::string& path, CubeData& cubedata)
     return false;
   }
 
+  if(header.IsVersion2())
+  {
+    fp.close();
+    return LoadKtx2Data(path, cubedata);
+  }
+
   // Skip the key-values:
   if(fp.seekg(header.bytesOfKeyValueData, fp.cur).good() == false)
   {
@@ -41,6 +41,8 @@ struct DALI_SCENE_LOADER_API CubeData
 
 /**
  * @brief Loads cube map data texture from a ktx file.
+ *  Both KTX 1.1 and KTX 2.0 files are supported; of the latter, the 2D textures and cube maps
+ *  without supercompression, whose faces (a single one for 2D textures) and mipmaps are loaded.
  *
  * @param[in] path The file path.
  * @param[out] cubedata The data structure with all pixel data objects.
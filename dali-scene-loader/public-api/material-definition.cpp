@@ -17,6 +17,7 @@
 
 // INTERNAL INCLUDES
 #include "dali-scene-loader/public-api/material-definition.h"
+#include "dali-scene-loader/public-api/ktx-loader.h"
 
 // EXTERNAL INCLUDES
 #include "dali-toolkit/public-api/image-loader/sync-image-loader.h"
@@ -62,6 +63,33 @@ constexpr WrapMode::Type WRAP_MODES_TO_DALI[]{
   WrapMode::MIRRORED_REPEAT};
 
 const SamplerFlags::Type SINGLE_VALUE_SAMPLER = SamplerFlags::Encode(FilterMode::NEAREST, FilterMode::NEAREST, WrapMode::CLAMP_TO_EDGE, WrapMode::CLAMP_TO_EDGE);
+
+const std::string KTX2_EXTENSION = ".ktx2";
+
+/**
+ * @brief Loads the image at @a path. KTX 2.0 files, which the image loaders don't support,
+ *  are loaded with their mipmaps.
+ */
+MaterialDefinition::RawData::TextureData LoadTexture(const std::string& path, SamplerFlags::Type samplerFlags)
+{
+  MaterialDefinition::RawData::TextureData textureData{PixelData(), samplerFlags};
+  if(path.size() > KTX2_EXTENSION.size() &&
+     CaseInsensitiveStringCompare(path.substr(path.size() - KTX2_EXTENSION.size()), KTX2_EXTENSION))
+  {
+    CubeData data;
+    if(LoadCubeMapData(path, data) && data.data.size() == 1u)
+    {
+      auto& levels         = data.data[0];
+      textureData.mPixels  = levels[0];
+      textureData.mMipmaps = std::vector<PixelData>(levels.begin() + 1, levels.end());
+    }
+  }
+  else
+  {
+    textureData.mPixels = SyncImageLoader::Load(path);
+  }
+  return textureData;
+}
 } // namespace
 
 SamplerFlags::Type SamplerFlags::Encode(FilterMode::Type minFilter, FilterMode::Type magFilter, WrapMode::Type wrapS, WrapMode::Type wrapT)
@@ -128,12 +156,12 @@ MaterialDefinition::LoadRaw(const std::string& imagesPath) const
   // Check for compulsory textures: Albedo, Metallic, Roughness, Normal
   if(checkStage(ALBEDO | METALLIC))
   {
-    raw.mTextures.push_back({SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags});
+    raw.mTextures.push_back(LoadTexture(imagesPath + iTexture->mTexture.mImageUri, iTexture->mTexture.mSamplerFlags));
     ++iTexture;
 
     if(checkStage(NORMAL | ROUGHNESS))
     {
-      raw.mTextures.push_back({SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags});
+      raw.mTextures.push_back(LoadTexture(imagesPath + iTexture->mTexture.mImageUri, iTexture->mTexture.mSamplerFlags));
       ++iTexture;
     }
     else // single value normal-roughness
@@ -147,7 +175,7 @@ MaterialDefinition::LoadRaw(const std::string& imagesPath) const
   {
     if(checkStage(ALBEDO))
     {
-      raw.mTextures.push_back({SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags});
+      raw.mTextures.push_back(LoadTexture(imagesPath + iTexture->mTexture.mImageUri, iTexture->mTexture.mSamplerFlags));
       ++iTexture;
     }
     else if(mNeedAlbedoTexture) // single value albedo, albedo-alpha or albedo-metallic
@@ -181,7 +209,7 @@ MaterialDefinition::LoadRaw(const std::string& imagesPath) const
     const bool createMetallicRoughnessAndNormal = hasTransparency || std::distance(mTextureStages.begin(), iTexture) > 0;
     if(checkStage(METALLIC | ROUGHNESS))
     {
-      raw.mTextures.push_back({SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags});
+      raw.mTextures.push_back(LoadTexture(imagesPath + iTexture->mTexture.mImageUri, iTexture->mTexture.mSamplerFlags));
       ++iTexture;
     }
     else if(createMetallicRoughnessAndNormal && mNeedMetallicRoughnessTexture)
@@ -195,7 +223,7 @@ MaterialDefinition::LoadRaw(const std::string& imagesPath) const
 
     if(checkStage(NORMAL))
     {
-      raw.mTextures.push_back({SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags});
+      raw.mTextures.push_back(LoadTexture(imagesPath + iTexture->mTexture.mImageUri, iTexture->mTexture.mSamplerFlags));
       ++iTexture;
     }
     else if(mNeedNormalTexture)
@@ -218,19 +246,19 @@ MaterialDefinition::LoadRaw(const std::string& imagesPath) const
   // Extra textures.
   if(checkStage(SUBSURFACE))
   {
-    raw.mTextures.push_back({SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags});
+    raw.mTextures.push_back(LoadTexture(imagesPath + iTexture->mTexture.mImageUri, iTexture->mTexture.mSamplerFlags));
     ++iTexture;
   }
 
   if(checkStage(OCCLUSION))
   {
-    raw.mTextures.push_back({SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags});
+    raw.mTextures.push_back(LoadTexture(imagesPath + iTexture->mTexture.mImageUri, iTexture->mTexture.mSamplerFlags));
     ++iTexture;
   }
 
   if(checkStage(EMISSIVE))
   {
-    raw.mTextures.push_back({SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags});
+    raw.mTextures.push_back(LoadTexture(imagesPath + iTexture->mTexture.mImageUri, iTexture->mTexture.mSamplerFlags));
     ++iTexture;
   }
 
@@ -247,7 +275,13 @@ TextureSet MaterialDefinition::Load(const EnvironmentDefinition::Vector& environ
     auto& pixels  = tData.mPixels;
     auto  texture = Texture::New(TextureType::TEXTURE_2D, pixels.GetPixelFormat(), pixels.GetWidth(), pixels.GetHeight());
     texture.Upload(tData.mPixels, 0, 0, 0, 0, pixels.GetWidth(), pixels.GetHeight());
-    if(tData.mSamplerFlags & SamplerFlags::MIPMAP_MASK)
+    for(uint32_t i = 0u; i < tData.mMipmaps.size(); ++i)
+    {
+      auto& mipmap = tData.mMipmaps[i];
+      texture.Upload(mipmap, 0, i + 1u, 0, 0, mipmap.GetWidth(), mipmap.GetHeight());
+    }
+
+    if(tData.mMipmaps.empty() && (tData.mSamplerFlags & SamplerFlags::MIPMAP_MASK))
     {
       texture.GenerateMipmaps();
     }
@@ -161,8 +161,9 @@ struct DALI_SCENE_LOADER_API MaterialDefinition
   {
     struct TextureData
     {
-      PixelData          mPixels;
-      SamplerFlags::Type mSamplerFlags;
+      PixelData              mPixels;
+      SamplerFlags::Type     mSamplerFlags;
+      std::vector<PixelData> mMipmaps; ///< The levels after mPixels, if the file had them; otherwise they're generated if the sampler needs them.
     };
 
     std::vector<TextureData> mTextures;
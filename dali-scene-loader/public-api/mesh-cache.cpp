@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "dali-scene-loader/public-api/mesh-cache.h"
+#include "dali-scene-loader/internal/hash.h"
+
+// EXTERNAL INCLUDES
+#include <dirent.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace Dali
+{
+namespace SceneLoader
+{
+namespace
+{
+const uint32_t    MAGIC     = 0x434d4c44; // "DLMC"
+const uint32_t    VERSION   = 1u;         // Increment whenever the format, or the preprocessing in MeshDefinition::LoadRaw(), changes.
+const std::string EXTENSION = ".mesh";
+
+const time_t STALE_TEMP_FILE_AGE = 60 * 60; // In seconds; the longest a write may take, if its process is still running.
+
+struct Header
+{
+  uint32_t mMagic;
+  uint32_t mVersion;
+  uint64_t mKey;
+  uint32_t mNumIndices;
+  uint32_t mNumAttribs;
+  uint32_t mBlendShapeBufferOffset;
+  uint32_t mNumBlendShapeUnnormalizeFactors;
+  uint32_t mBlendShapeWidth;
+  uint32_t mBlendShapeHeight;
+  uint32_t mBlendShapeFormat;
+  uint32_t mBlendShapeDataSize;
+};
+
+struct AttribHeader
+{
+  uint32_t mNameLength;
+  uint32_t mType;
+  uint32_t mNumElements;
+  uint32_t mDataSize;
+};
+
+uint32_t GetPadding(uint64_t size)
+{
+  return static_cast<uint32_t>((4u - size % 4u) % 4u);
+}
+
+bool HasSuffix(const std::string& name, const std::string& suffix)
+{
+  return name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/**
+ * @brief Whether @a name, of a file last modified at @a lastModified, is the temporary file
+ *  of a write whose process has died, or that has been going on for too long.
+ */
+bool IsStaleTempFile(const std::string& name, time_t lastModified)
+{
+  // Temporary files are named <key>.mesh.<pid>.<thread id>; see MeshCache::Write().
+  const auto iPid = name.find(EXTENSION + '.');
+  if(iPid == std::string::npos)
+  {
+    return false;
+  }
+
+  const pid_t pid = static_cast<pid_t>(strtol(name.c_str() + iPid + EXTENSION.size() + 1u, nullptr, 10));
+  return (pid > 0 && kill(pid, 0) != 0 && errno == ESRCH) ||
+         time(nullptr) - lastModified > STALE_TEMP_FILE_AGE;
+}
+
+///@brief Reads the sections of a cache file, checking that they're within its bounds.
+class Reader
+{
+public:
+  explicit Reader(const BufferData& data)
+  : mData(data)
+  {
+  }
+
+  const uint8_t* ReadBytes(uint64_t size)
+  {
+    if(!mData.IsInRange(mOffset, size))
+    {
+      return nullptr;
+    }
+
+    auto data = mData.GetData() + mOffset;
+    mOffset += size;
+    mOffset += GetPadding(mOffset);
+    return data;
+  }
+
+  template<typename T>
+  bool Read(T& value)
+  {
+    auto data = ReadBytes(sizeof(T));
+    if(data)
+    {
+      memcpy(&value, data, sizeof(T));
+    }
+    return data != nullptr;
+  }
+
+  bool IsAtEnd() const
+  {
+    return mOffset >= mData.GetSize();
+  }
+
+private:
+  const BufferData& mData;
+  uint64_t          mOffset = 0u;
+};
+
+///@brief Writes the sections of a cache file, padding each to 4 bytes.
+class Writer
+{
+public:
+  explicit Writer(const std::string& path)
+  : mStream(path, std::ios::binary | std::ios::trunc)
+  {
+  }
+
+  void WriteBytes(const void* data, uint64_t size)
+  {
+    static const char PADDING[4]{};
+    mStream.write(static_cast<const char*>(data), size);
+    mStream.write(PADDING, GetPadding(size));
+    mSize += size + GetPadding(size);
+  }
+
+  template<typename T>
+  void Write(const T& value)
+  {
+    WriteBytes(&value, sizeof(T));
+  }
+
+  bool Close()
+  {
+    mStream.close();
+    return !mStream.fail();
+  }
+
+  uint64_t GetSize() const
+  {
+    return mSize;
+  }
+
+private:
+  std::ofstream mStream;
+  uint64_t      mSize = 0u;
+};
+
+void AddBlob(Hash& hash, const MeshDefinition::Blob& blob)
+{
+  hash.Add(blob.mOffset).Add(blob.mLength).Add(uint32_t(blob.mStride)).Add(uint32_t(blob.mElementSizeHint));
+  for(auto values : {&blob.mMin, &blob.mMax})
+  {
+    hash.Add(static_cast<uint32_t>(values->size()));
+    for(auto value : *values)
+    {
+      hash.Add(value);
+    }
+  }
+}
+
+void AddAccessor(Hash& hash, const MeshDefinition::Accessor& accessor)
+{
+  AddBlob(hash, accessor.mBlob);
+  hash.Add(accessor.mSparse != nullptr);
+  if(accessor.mSparse)
+  {
+    AddBlob(hash, accessor.mSparse->mIndices);
+    AddBlob(hash, accessor.mSparse->mValues);
+    hash.Add(accessor.mSparse->mCount);
+  }
+}
+
+} // namespace
+
+MeshCache::MeshCache(const std::string& directory, uint64_t maxSize)
+: mDirectory(directory),
+  mMaxSize(maxSize)
+{
+  if(!mDirectory.empty() && mDirectory.back() != '/')
+  {
+    mDirectory += '/';
+  }
+}
+
+uint64_t MeshCache::GetKey(const MeshDefinition& mesh, const std::string& meshPath)
+{
+  struct stat status;
+  if(stat(meshPath.c_str(), &status) != 0)
+  {
+    return 0u;
+  }
+
+  Hash hash;
+  hash.Add(VERSION).Add(meshPath);
+  hash.Add(static_cast<uint64_t>(status.st_size));
+  hash.Add(static_cast<uint64_t>(status.st_mtim.tv_sec)).Add(static_cast<uint64_t>(status.st_mtim.tv_nsec));
+
+  hash.Add(mesh.mFlags).Add(static_cast<uint32_t>(mesh.mPrimitiveType)).Add(static_cast<uint32_t>(mesh.mTangentType));
+  for(auto accessor : {&mesh.mIndices, &mesh.mPositions, &mesh.mNormals, &mesh.mTexCoords, &mesh.mColors, &mesh.mTangents, &mesh.mJoints0, &mesh.mWeights0})
+  {
+    AddAccessor(hash, *accessor);
+  }
+
+  AddBlob(hash, mesh.mBlendShapeHeader);
+  hash.Add(static_cast<uint32_t>(mesh.mBlendShapeVersion)).Add(static_cast<uint32_t>(mesh.mBlendShapes.size()));
+  for(auto& blendShape : mesh.mBlendShapes)
+  {
+    AddAccessor(hash, blendShape.deltas);
+    AddAccessor(hash, blendShape.normals);
+    AddAccessor(hash, blendShape.tangents);
+  }
+
+  const uint64_t key = hash;
+  return key != 0u ? key : 1u; // 0 is reserved for failure.
+}
+
+std::string MeshCache::GetPath(uint64_t key) const
+{
+  char name[17];
+  snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+  return mDirectory + name + EXTENSION;
+}
+
+bool MeshCache::Read(uint64_t key, MeshDefinition::RawData& raw) const
+{
+  const std::string path   = GetPath(key);
+  auto              buffer = BufferData::Load(path);
+  if(!buffer)
+  {
+    return false;
+  }
+
+  Reader reader(*buffer);
+  Header header;
+  if(!reader.Read(header) || header.mMagic != MAGIC || header.mVersion != VERSION || header.mKey != key)
+  {
+    return false;
+  }
+
+  auto fail = [&raw]() {
+    raw = MeshDefinition::RawData();
+    return false;
+  };
+
+  auto indices = reader.ReadBytes(uint64_t(header.mNumIndices) * sizeof(uint16_t));
+  if(!indices)
+  {
+    return fail();
+  }
+  raw.mIndices.assign(reinterpret_cast<const uint16_t*>(indices), reinterpret_cast<const uint16_t*>(indices) + header.mNumIndices);
+
+  raw.mAttribs.reserve(header.mNumAttribs);
+  for(uint32_t i = 0u; i < header.mNumAttribs; ++i)
+  {
+    AttribHeader attribHeader;
+    const uint8_t* name;
+    const uint8_t* data;
+    if(!reader.Read(attribHeader) ||
+       !(name = reader.ReadBytes(attribHeader.mNameLength)) ||
+       !(data = reader.ReadBytes(attribHeader.mDataSize)))
+    {
+      return fail();
+    }
+
+    raw.mAttribs.push_back({std::string(reinterpret_cast<const char*>(name), attribHeader.mNameLength),
+                            static_cast<Property::Type>(attribHeader.mType),
+                            attribHeader.mNumElements,
+                            std::vector<uint8_t>(data, data + attribHeader.mDataSize)});
+  }
+
+  raw.mBlendShapeBufferOffset = header.mBlendShapeBufferOffset;
+  if(header.mNumBlendShapeUnnormalizeFactors > 0u)
+  {
+    auto factors = reader.ReadBytes(uint64_t(header.mNumBlendShapeUnnormalizeFactors) * sizeof(float));
+    if(!factors)
+    {
+      return fail();
+    }
+    raw.mBlendShapeUnnormalizeFactor.Resize(header.mNumBlendShapeUnnormalizeFactors);
+    memcpy(raw.mBlendShapeUnnormalizeFactor.Begin(), factors, header.mNumBlendShapeUnnormalizeFactors * sizeof(float));
+  }
+
+  if(header.mBlendShapeDataSize > 0u)
+  {
+    const auto format = static_cast<Pixel::Format>(header.mBlendShapeFormat);
+    auto       pixels = reader.ReadBytes(header.mBlendShapeDataSize);
+    if(!pixels || uint64_t(header.mBlendShapeWidth) * header.mBlendShapeHeight * Pixel::GetBytesPerPixel(format) != header.mBlendShapeDataSize)
+    {
+      return fail();
+    }
+
+    auto data = new uint8_t[header.mBlendShapeDataSize];
+    memcpy(data, pixels, header.mBlendShapeDataSize);
+    raw.mBlendShapeData = PixelData::New(data, header.mBlendShapeDataSize, header.mBlendShapeWidth, header.mBlendShapeHeight, format, PixelData::DELETE_ARRAY);
+  }
+
+  if(!reader.IsAtEnd())
+  {
+    return fail();
+  }
+
+  // The modification time of a cache file is when it was last used; Trim() removes the oldest files first.
+  utime(path.c_str(), nullptr);
+  return true;
+}
+
+bool MeshCache::Write(uint64_t key, const MeshDefinition::RawData& raw, const uint8_t* blendShapePixels, uint32_t width, uint32_t height, Pixel::Format format) const
+{
+  Header header{};
+  header.mMagic                           = MAGIC;
+  header.mVersion                         = VERSION;
+  header.mKey                             = key;
+  header.mNumIndices                      = static_cast<uint32_t>(raw.mIndices.size());
+  header.mNumAttribs                      = static_cast<uint32_t>(raw.mAttribs.size());
+  header.mBlendShapeBufferOffset          = raw.mBlendShapeBufferOffset;
+  header.mNumBlendShapeUnnormalizeFactors = static_cast<uint32_t>(raw.mBlendShapeUnnormalizeFactor.Count());
+  if(blendShapePixels)
+  {
+    header.mBlendShapeWidth    = width;
+    header.mBlendShapeHeight   = height;
+    header.mBlendShapeFormat   = static_cast<uint32_t>(format);
+    header.mBlendShapeDataSize = width * height * Pixel::GetBytesPerPixel(format);
+  }
+
+  // Write to a file of our own, then move it in place, so that a cache file is never
+  // read while it's being written, by another thread or another process.
+  const std::string path     = GetPath(key);
+  const std::string tempPath = path + '.' + std::to_string(getpid()) + '.' + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+  Writer writer(tempPath);
+  writer.Write(header);
+  writer.WriteBytes(raw.mIndices.data(), raw.mIndices.size() * sizeof(uint16_t));
+  for(auto& attrib : raw.mAttribs)
+  {
+    writer.Write(AttribHeader{static_cast<uint32_t>(attrib.mName.size()), static_cast<uint32_t>(attrib.mType), attrib.mNumElements, static_cast<uint32_t>(attrib.mData.size())});
+    writer.WriteBytes(attrib.mName.data(), attrib.mName.size());
+    writer.WriteBytes(attrib.mData.data(), attrib.mData.size());
+  }
+  writer.WriteBytes(raw.mBlendShapeUnnormalizeFactor.Begin(), raw.mBlendShapeUnnormalizeFactor.Count() * sizeof(float));
+  if(blendShapePixels)
+  {
+    writer.WriteBytes(blendShapePixels, header.mBlendShapeDataSize);
+  }
+
+  // The file for the key may have been written already, by another thread or process.
+  struct stat status;
+  const uint64_t replacedSize = stat(path.c_str(), &status) == 0 ? static_cast<uint64_t>(status.st_size) : 0u;
+
+  if(!writer.Close() || rename(tempPath.c_str(), path.c_str()) != 0)
+  {
+    remove(tempPath.c_str());
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  if(mIsTotalSizeKnown)
+  {
+    mTotalSize = mTotalSize - std::min(mTotalSize, replacedSize) + writer.GetSize();
+  }
+
+  if(!mIsTotalSizeKnown || mTotalSize > mMaxSize)
+  {
+    TrimFiles(path);
+  }
+  return true;
+}
+
+void MeshCache::Trim(const std::string& keepPath) const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  TrimFiles(keepPath);
+}
+
+void MeshCache::TrimFiles(const std::string& keepPath) const
+{
+  DIR* directory = opendir(mDirectory.empty() ? "." : mDirectory.c_str());
+  if(!directory)
+  {
+    return;
+  }
+
+  struct File
+  {
+    std::string mPath;
+    uint64_t    mSize;
+    time_t      mLastUsed;
+  };
+
+  std::vector<File> files;
+  uint64_t          totalSize = 0u;
+  while(auto entry = readdir(directory))
+  {
+    const std::string name   = entry->d_name;
+    const bool        isFile = HasSuffix(name, EXTENSION);
+    if(!isFile && name.find(EXTENSION + '.') == std::string::npos)
+    {
+      continue;
+    }
+
+    struct stat status;
+    std::string path = mDirectory + name;
+    if(stat(path.c_str(), &status) != 0 || !S_ISREG(status.st_mode))
+    {
+      continue;
+    }
+
+    if(isFile)
+    {
+      totalSize += status.st_size;
+      files.push_back(File{std::move(path), static_cast<uint64_t>(status.st_size), status.st_mtime});
+    }
+    else if(IsStaleTempFile(name, status.st_mtime))
+    {
+      remove(path.c_str());
+    }
+  }
+  closedir(directory);
+
+  mTotalSize        = totalSize;
+  mIsTotalSizeKnown = true;
+  if(totalSize <= mMaxSize)
+  {
+    return;
+  }
+
+  std::sort(files.begin(), files.end(), [](const File& lhs, const File& rhs) {
+    return lhs.mLastUsed < rhs.mLastUsed;
+  });
+
+  for(auto iFile = files.begin(); iFile != files.end() && totalSize > mMaxSize; ++iFile)
+  {
+    // Another thread or process may have removed it already.
+    if(iFile->mPath != keepPath && remove(iFile->mPath.c_str()) == 0)
+    {
+      totalSize -= iFile->mSize;
+    }
+  }
+  mTotalSize = totalSize;
+}
+
+} // namespace SceneLoader
+} // namespace Dali
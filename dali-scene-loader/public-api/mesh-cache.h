@@ -0,0 +1,116 @@
+#ifndef DALI_SCENE_LOADER_MESH_CACHE_H
+#define DALI_SCENE_LOADER_MESH_CACHE_H
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "dali-scene-loader/public-api/api.h"
+#include "dali-scene-loader/public-api/mesh-definition.h"
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "dali/public-api/images/pixel.h"
+
+namespace Dali
+{
+namespace SceneLoader
+{
+/**
+ * @brief An on-disk cache of the raw data of meshes, as produced by MeshDefinition::LoadRaw():
+ *  with the normals and tangents generated, the sparse accessors and min / max values
+ *  applied, and the blend shape texture built. Loading a mesh again then only takes
+ *  mapping its cache file, skipping the buffer file and all the preprocessing.
+ *
+ *  Each mesh is stored in a file of its own in the cache directory, named after its key.
+ *  The sections of the file are in native byte order and aligned to 4 bytes, so that
+ *  they're read straight from the mapping.
+ *
+ *  As a changed buffer file gets a new key, the files of its old keys are never read again.
+ *  Write() therefore keeps the cache files within a maximum size, removing the least
+ *  recently used ones first. Their total size is found by scanning the directory on the
+ *  first Write(), then kept up to date; the directory is only scanned again when the total
+ *  goes over the maximum size, which also picks up the files written by other processes.
+ * @note Read() and Write() may be called from any thread.
+ */
+class DALI_SCENE_LOADER_API MeshCache
+{
+public:
+  static constexpr uint64_t DEFAULT_MAX_SIZE = 256u * 1024u * 1024u; ///< The default maximum size of the cache files, in bytes.
+
+  /**
+   * @brief Creates a cache which stores its files in @a directory. The directory must exist;
+   *  if it can't be written to, the meshes are loaded without being cached.
+   * @param[in] directory The directory of the cache files.
+   * @param[in] maxSize The maximum size of all the cache files in @a directory, in bytes.
+   */
+  explicit MeshCache(const std::string& directory, uint64_t maxSize = DEFAULT_MAX_SIZE);
+
+  /**
+   * @return The key of the raw data of @a mesh, whose buffer file is at @a meshPath. It
+   *  depends on every property of @a mesh that takes part in the preprocessing, and on the
+   *  path, size and modification time of the buffer file. 0 if the buffer file doesn't exist.
+   */
+  static uint64_t GetKey(const MeshDefinition& mesh, const std::string& meshPath);
+
+  /**
+   * @return The path of the file that the raw data for @a key is stored in.
+   */
+  std::string GetPath(uint64_t key) const;
+
+  /**
+   * @brief Reads the raw data stored for @a key into @a raw, marking its file as recently used.
+   * @return Whether it was found and valid; if not, @a raw is left empty.
+   */
+  bool Read(uint64_t key, MeshDefinition::RawData& raw) const;
+
+  /**
+   * @brief Stores the raw data @a raw for @a key. As the pixels of raw.mBlendShapeData
+   *  aren't accessible, the blend shape texture is passed as @a blendShapePixels, of
+   *  @a width x @a height pixels of @a format; ignored if @a blendShapePixels is nullptr.
+   *  Then removes the least recently used cache files, if they take up more than the maximum size.
+   * @return Whether the raw data was stored.
+   */
+  bool Write(uint64_t key, const MeshDefinition::RawData& raw, const uint8_t* blendShapePixels, uint32_t width, uint32_t height, Pixel::Format format) const;
+
+  /**
+   * @brief Removes the least recently used cache files, except the one at @a keepPath,
+   *  until the cache files take up no more than the maximum size. Also removes the
+   *  temporary files left behind by writes that never finished.
+   */
+  void Trim(const std::string& keepPath = std::string()) const;
+
+private:
+  /**
+   * @brief Scans the directory and does the work of Trim(), updating mTotalSize.
+   * @note mMutex must be locked.
+   */
+  void TrimFiles(const std::string& keepPath) const;
+
+private:
+  std::string        mDirectory;
+  uint64_t           mMaxSize;
+  mutable std::mutex mMutex;                    ///< Guards mTotalSize and mIsTotalSizeKnown.
+  mutable uint64_t   mTotalSize        = 0u;    ///< The size of the cache files, as of the last scan and the writes since.
+  mutable bool       mIsTotalSizeKnown = false; ///< Whether the directory was scanned yet.
+};
+
+} // namespace SceneLoader
+} // namespace Dali
+
+#endif //DALI_SCENE_LOADER_MESH_CACHE_H
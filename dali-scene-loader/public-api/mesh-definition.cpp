@@ -17,10 +17,13 @@
 
 // INTERNAL INCLUDES
 #include "dali-scene-loader/public-api/mesh-definition.h"
+#include "dali-scene-loader/public-api/mesh-cache.h"
+#include "dali-scene-loader/internal/parallel.h"
+#include "dali-scene-loader/internal/vertex-kernels.h"
 
 // EXTERNAL INCLUDES
 #include <cstring>
-#include <fstream>
+#include <mutex>
 #include "dali/devel-api/adaptor-framework/pixel-buffer.h"
 
 namespace Dali
@@ -65,47 +68,129 @@ private:
 
 const std::string QUAD("quad");
 
-///@brief Reads a blob from the given stream @a source into @a target, which must have
-/// at least @a descriptor.length bytes.
-bool ReadBlob(const MeshDefinition::Blob& descriptor, std::istream& source, uint8_t* target)
+const uint32_t MIN_VERTICES_PER_THREAD = 16384u; ///< The per-vertex processing of smaller meshes isn't split across threads.
+
+template<size_t ElementSize>
+void Deinterleave(const uint8_t* source, uint32_t stride, uint32_t count, uint8_t* target)
+{
+  // The element size being a constant, the copies compile to a few (vector) moves.
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    memcpy(target, source, ElementSize);
+    source += stride;
+    target += ElementSize;
+  }
+}
+
+void Deinterleave(const uint8_t* source, uint32_t stride, uint32_t elementSize, uint32_t count, uint8_t* target)
 {
-  if(!source.seekg(descriptor.mOffset, std::istream::beg))
+  for(uint32_t i = 0u; i < count; ++i)
   {
-    return false;
+    memcpy(target, source, elementSize);
+    source += stride;
+    target += elementSize;
   }
+}
 
+///@brief Reads a blob from the given buffer @a source into @a target, which must have
+/// at least @a descriptor.GetBufferSize() bytes. Interleaved elements are packed tightly.
+bool ReadBlob(const MeshDefinition::Blob& descriptor, const BufferData& source, uint8_t* target)
+{
   if(descriptor.IsConsecutive())
   {
-    return !!source.read(reinterpret_cast<char*>(target), descriptor.mLength);
+    if(!source.IsInRange(descriptor.mOffset, descriptor.mLength))
+    {
+      return false;
+    }
+
+    if(descriptor.mLength > 0u)
+    {
+      memcpy(target, source.GetData() + descriptor.mOffset, descriptor.mLength);
+    }
+    return true;
   }
   else
   {
     DALI_ASSERT_DEBUG(descriptor.mStride > descriptor.mElementSizeHint);
-    const uint32_t diff     = descriptor.mStride - descriptor.mElementSizeHint;
-    uint32_t       readSize = 0;
-    while(readSize < descriptor.mLength &&
-          source.read(reinterpret_cast<char*>(target), descriptor.mElementSizeHint) &&
-          source.seekg(diff, std::istream::cur))
+    // An element is read for each stride in the length, which must be a whole number of strides.
+    const uint32_t stride      = descriptor.mStride;
+    const uint32_t elementSize = descriptor.mElementSizeHint;
+    if(descriptor.mLength % stride != 0u)
     {
-      readSize += descriptor.mStride;
-      target += descriptor.mElementSizeHint;
+      return false;
     }
-    return readSize == descriptor.mLength;
+
+    const uint32_t count = descriptor.mLength / stride;
+    if(count == 0u)
+    {
+      return true;
+    }
+
+    if(!source.IsInRange(descriptor.mOffset + static_cast<uint64_t>(count - 1u) * stride, elementSize))
+    {
+      return false;
+    }
+
+    const uint8_t* elements = source.GetData() + descriptor.mOffset;
+    switch(elementSize)
+    {
+      case sizeof(float):
+      {
+        Deinterleave<sizeof(float)>(elements, stride, count, target);
+        break;
+      }
+      case sizeof(Vector2):
+      {
+        Deinterleave<sizeof(Vector2)>(elements, stride, count, target);
+        break;
+      }
+      case sizeof(Vector3):
+      {
+        Deinterleave<sizeof(Vector3)>(elements, stride, count, target);
+        break;
+      }
+      case sizeof(Vector4):
+      {
+        Deinterleave<sizeof(Vector4)>(elements, stride, count, target);
+        break;
+      }
+      default:
+      {
+        Deinterleave(elements, stride, elementSize, count, target);
+        break;
+      }
+    }
+    return true;
+  }
+}
+
+///@brief Gets the tightly packed elements of a blob; consecutive elements are used from
+/// @a source without copying, interleaved ones are read into @a storage.
+///@return The elements, or nullptr if the blob is out of the bounds of @a source.
+const uint8_t* GetBlobData(const MeshDefinition::Blob& descriptor, const BufferData& source, std::vector<uint8_t>& storage)
+{
+  if(descriptor.IsConsecutive())
+  {
+    return source.IsInRange(descriptor.mOffset, descriptor.mLength) ? source.GetData() + descriptor.mOffset : nullptr;
   }
+
+  storage.resize(descriptor.GetBufferSize());
+  return ReadBlob(descriptor, source, storage.data()) ? storage.data() : nullptr;
 }
 
 template<typename T>
-void ReadValues(const std::vector<uint8_t>& valuesBuffer, const std::vector<uint8_t>& indicesBuffer, uint8_t* target, uint32_t count, uint32_t elementSizeHint)
+void ReadValues(const uint8_t* values, const uint8_t* indices, uint8_t* target, uint32_t count, uint32_t elementSizeHint)
 {
-  const T* const indicesPtr = reinterpret_cast<const T* const>(indicesBuffer.data());
   for(uint32_t index = 0u; index < count; ++index)
   {
-    uint32_t valuesIndex = indicesPtr[index] * elementSizeHint;
-    memcpy(target + valuesIndex, &valuesBuffer[index * elementSizeHint], elementSizeHint);
+    T sparseIndex;
+    memcpy(&sparseIndex, indices + index * sizeof(T), sizeof(T)); // the buffer may not be aligned for T.
+    uint32_t valuesIndex = sparseIndex * elementSizeHint;
+    memcpy(target + valuesIndex, values + index * elementSizeHint, elementSizeHint);
   }
 }
 
-bool ReadAccessor(const MeshDefinition::Accessor& accessor, std::istream& source, uint8_t* target)
+bool ReadAccessor(const MeshDefinition::Accessor& accessor, const BufferData& source, uint8_t* target)
 {
   bool success = false;
 
@@ -128,18 +213,16 @@ bool ReadAccessor(const MeshDefinition::Accessor& accessor, std::istream& source
       return false;
     }
 
-    const auto           indicesBufferSize = indices.GetBufferSize();
-    std::vector<uint8_t> indicesBuffer(indicesBufferSize);
-    success = ReadBlob(indices, source, indicesBuffer.data());
-    if(!success)
+    std::vector<uint8_t> indicesStorage;
+    const uint8_t*       indicesBuffer = GetBlobData(indices, source, indicesStorage);
+    if(!indicesBuffer)
     {
       return false;
     }
 
-    const auto           valuesBufferSize = values.GetBufferSize();
-    std::vector<uint8_t> valuesBuffer(valuesBufferSize);
-    success = ReadBlob(values, source, valuesBuffer.data());
-    if(!success)
+    std::vector<uint8_t> valuesStorage;
+    const uint8_t*       valuesBuffer = GetBlobData(values, source, valuesStorage);
+    if(!valuesBuffer)
     {
       return false;
     }
@@ -196,12 +279,9 @@ void GenerateNormals(MeshDefinition::RawData& raw)
     normals[indices[2]] += normal;
   }
 
-  auto iEnd = normals + attribs[0].mNumElements;
-  while(normals != iEnd)
-  {
-    normals->Normalize();
-    ++normals;
-  }
+  ParallelFor(attribs[0].mNumElements, MIN_VERTICES_PER_THREAD, [normals](uint32_t begin, uint32_t end) {
+    NormalizeVectors(normals + begin, end - begin);
+  });
 
   attribs.push_back({"aNormal", Property::VECTOR3, attribs[0].mNumElements, std::move(buffer)});
 }
@@ -248,15 +328,9 @@ void GenerateTangentsWithUvs(MeshDefinition::RawData& raw)
   }
 
   auto* normals = reinterpret_cast<const Vector3*>(attribs[1].mData.data());
-  auto  iEnd    = normals + attribs[1].mNumElements;
-  while(normals != iEnd)
-  {
-    *tangents -= *normals * normals->Dot(*tangents);
-    tangents->Normalize();
-
-    ++tangents;
-    ++normals;
-  }
+  ParallelFor(attribs[1].mNumElements, MIN_VERTICES_PER_THREAD, [tangents, normals](uint32_t begin, uint32_t end) {
+    OrthonormalizeTangents(tangents + begin, normals + begin, end - begin);
+  });
   attribs.push_back({"aTangent", Property::VECTOR3, attribs[0].mNumElements, std::move(buffer)});
 }
 
@@ -270,18 +344,9 @@ void GenerateTangents(MeshDefinition::RawData& raw)
   std::vector<uint8_t> buffer(attribs[0].mNumElements * sizeof(Vector3));
   auto                 tangents = reinterpret_cast<Vector3*>(buffer.data());
 
-  auto iEnd = normals + attribs[1].mNumElements;
-  while(normals != iEnd)
-  {
-    Vector3 t[]{normals->Cross(Vector3::XAXIS), normals->Cross(Vector3::YAXIS)};
-
-    *tangents = t[t[1].LengthSquared() > t[0].LengthSquared()];
-    *tangents -= *normals * normals->Dot(*tangents);
-    tangents->Normalize();
-
-    ++tangents;
-    ++normals;
-  }
+  ParallelFor(attribs[1].mNumElements, MIN_VERTICES_PER_THREAD, [normals, tangents](uint32_t begin, uint32_t end) {
+    CalculateTangents(normals + begin, tangents + begin, end - begin);
+  });
   attribs.push_back({"aTangent", Property::VECTOR3, attribs[0].mNumElements, std::move(buffer)});
 }
 
@@ -309,11 +374,52 @@ void CalculateTextureSize(uint32_t totalTextureSize, uint32_t& textureWidth, uin
   textureHeight = 1u << powHeight;
 }
 
-void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, std::ifstream& binFile, const std::vector<MeshDefinition::BlendShape>& blendShapes, uint32_t numberOfVertices, float& blendShapeUnnormalizeFactor)
+///@brief Reads the @a numberOfVertices Vector3s of a blend shape accessor into @a target, and applies
+/// their min / max. The tightly packed accessors are read in place.
+bool ReadBlendShapeVectors(const MeshDefinition::Accessor& accessor, const BufferData& binFile, uint32_t numberOfVertices, Vector3* target)
 {
-  uint32_t geometryBufferIndex = 0u;
-  float    maxDistance         = 0.f;
-  Vector3* geometryBufferV3    = reinterpret_cast<Vector3*>(geometryBuffer);
+  const auto bufferSize = accessor.mBlob.GetBufferSize();
+  const auto targetSize = numberOfVertices * sizeof(Vector3);
+  if(bufferSize == targetSize)
+  {
+    if(!accessor.mBlob.IsDefined())
+    {
+      memset(target, 0, targetSize); // sparse values replace zeros.
+    }
+
+    if(!ReadAccessor(accessor, binFile, reinterpret_cast<uint8_t*>(target)))
+    {
+      return false;
+    }
+    accessor.mBlob.ApplyMinMax(numberOfVertices, reinterpret_cast<float*>(target));
+  }
+  else
+  {
+    std::vector<uint8_t> buffer(bufferSize);
+    if(!ReadAccessor(accessor, binFile, buffer.data()))
+    {
+      return false;
+    }
+    accessor.mBlob.ApplyMinMax(bufferSize / sizeof(Vector3), reinterpret_cast<float*>(buffer.data()));
+    memcpy(target, buffer.data(), std::min<size_t>(bufferSize, targetSize));
+  }
+  return true;
+}
+
+///@brief Translates normal or tangent deltas to make all values positive.
+void PackBlendShapeDirections(Vector3* deltas, uint32_t numberOfVertices)
+{
+  ParallelFor(numberOfVertices, MIN_VERTICES_PER_THREAD, [deltas](uint32_t begin, uint32_t end) {
+    ScaleAndOffset(reinterpret_cast<float*>(deltas + begin), (end - begin) * 3u, 0.5f, 0.5f);
+  });
+}
+
+void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, const BufferData& binFile, const std::vector<MeshDefinition::BlendShape>& blendShapes, uint32_t numberOfVertices, float& blendShapeUnnormalizeFactor)
+{
+  uint32_t   geometryBufferIndex = 0u;
+  float      maxDistance         = 0.f;
+  Vector3*   geometryBufferV3    = reinterpret_cast<Vector3*>(geometryBuffer);
+  std::mutex maxDistanceMutex;
   for(const auto& blendShape : blendShapes)
   {
     if(blendShape.deltas.IsDefined())
@@ -322,22 +428,17 @@ void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, std::ifstream& binFile,
                           blendShape.deltas.mBlob.mStride >= sizeof(Vector3)) &&
                          "Blend Shape position buffer length not a multiple of element size");
 
-      const auto           bufferSize = blendShape.deltas.mBlob.GetBufferSize();
-      std::vector<uint8_t> buffer(bufferSize);
-      if(ReadAccessor(blendShape.deltas, binFile, buffer.data()))
+      Vector3* deltas = geometryBufferV3 + geometryBufferIndex;
+      if(ReadBlendShapeVectors(blendShape.deltas, binFile, numberOfVertices, deltas))
       {
-        blendShape.deltas.mBlob.ApplyMinMax(bufferSize / sizeof(Vector3), reinterpret_cast<float*>(buffer.data()));
-        // Calculate the difference with the original mesh.
         // Find the max distance to normalize the deltas.
-        const Vector3* const deltasBuffer = reinterpret_cast<const Vector3* const>(buffer.data());
-
-        for(uint32_t index = 0u; index < numberOfVertices; ++index)
-        {
-          Vector3& delta = geometryBufferV3[geometryBufferIndex++];
-          delta          = deltasBuffer[index];
+        ParallelFor(numberOfVertices, MIN_VERTICES_PER_THREAD, [&](uint32_t begin, uint32_t end) {
+          const float maxLengthSquared = GetMaxLengthSquared(deltas + begin, end - begin);
 
-          maxDistance = std::max(maxDistance, delta.LengthSquared());
-        }
+          std::lock_guard<std::mutex> lock(maxDistanceMutex);
+          maxDistance = std::max(maxDistance, maxLengthSquared);
+        });
+        geometryBufferIndex += numberOfVertices;
       }
     }
 
@@ -347,28 +448,11 @@ void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, std::ifstream& binFile,
                           blendShape.normals.mBlob.mStride >= sizeof(Vector3)) &&
                          "Blend Shape normals buffer length not a multiple of element size");
 
-      const auto           bufferSize = blendShape.normals.mBlob.GetBufferSize();
-      std::vector<uint8_t> buffer(bufferSize);
-      if(ReadAccessor(blendShape.normals, binFile, buffer.data()))
+      Vector3* deltas = geometryBufferV3 + geometryBufferIndex;
+      if(ReadBlendShapeVectors(blendShape.normals, binFile, numberOfVertices, deltas))
       {
-        blendShape.normals.mBlob.ApplyMinMax(bufferSize / sizeof(Vector3), reinterpret_cast<float*>(buffer.data()));
-
-        // Calculate the difference with the original mesh, and translate to make all values positive.
-        const Vector3* const deltasBuffer = reinterpret_cast<const Vector3* const>(buffer.data());
-
-        for(uint32_t index = 0u; index < numberOfVertices; ++index)
-        {
-          Vector3& delta = geometryBufferV3[geometryBufferIndex++];
-          delta          = deltasBuffer[index];
-
-          delta.x *= 0.5f;
-          delta.y *= 0.5f;
-          delta.z *= 0.5f;
-
-          delta.x += 0.5f;
-          delta.y += 0.5f;
-          delta.z += 0.5f;
-        }
+        PackBlendShapeDirections(deltas, numberOfVertices);
+        geometryBufferIndex += numberOfVertices;
       }
     }
 
@@ -378,28 +462,11 @@ void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, std::ifstream& binFile,
                           blendShape.tangents.mBlob.mStride >= sizeof(Vector3)) &&
                          "Blend Shape tangents buffer length not a multiple of element size");
 
-      const auto           bufferSize = blendShape.tangents.mBlob.GetBufferSize();
-      std::vector<uint8_t> buffer(bufferSize);
-      if(ReadAccessor(blendShape.tangents, binFile, buffer.data()))
+      Vector3* deltas = geometryBufferV3 + geometryBufferIndex;
+      if(ReadBlendShapeVectors(blendShape.tangents, binFile, numberOfVertices, deltas))
       {
-        blendShape.tangents.mBlob.ApplyMinMax(bufferSize / sizeof(Vector3), reinterpret_cast<float*>(buffer.data()));
-
-        // Calculate the difference with the original mesh, and translate to make all values positive.
-        const Vector3* const deltasBuffer = reinterpret_cast<const Vector3* const>(buffer.data());
-
-        for(uint32_t index = 0u; index < numberOfVertices; ++index)
-        {
-          Vector3& delta = geometryBufferV3[geometryBufferIndex++];
-          delta          = deltasBuffer[index];
-
-          delta.x *= 0.5f;
-          delta.y *= 0.5f;
-          delta.z *= 0.5f;
-
-          delta.x += 0.5f;
-          delta.y += 0.5f;
-          delta.z += 0.5f;
-        }
+        PackBlendShapeDirections(deltas, numberOfVertices);
+        geometryBufferIndex += numberOfVertices;
       }
     }
   }
@@ -414,13 +481,11 @@ void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, std::ifstream& binFile,
     {
       const float normalizeFactor = (fabsf(maxDistance) < Math::MACHINE_EPSILON_1000) ? 1.f : (0.5f / sqrtf(maxDistance));
 
-      for(uint32_t index = 0u; index < numberOfVertices; ++index)
-      {
-        Vector3& delta = geometryBufferV3[geometryBufferIndex++];
-        delta.x        = Clamp(((delta.x * normalizeFactor) + 0.5f), 0.f, 1.f);
-        delta.y        = Clamp(((delta.y * normalizeFactor) + 0.5f), 0.f, 1.f);
-        delta.z        = Clamp(((delta.z * normalizeFactor) + 0.5f), 0.f, 1.f);
-      }
+      Vector3* deltas = geometryBufferV3 + geometryBufferIndex;
+      ParallelFor(numberOfVertices, MIN_VERTICES_PER_THREAD, [deltas, normalizeFactor](uint32_t begin, uint32_t end) {
+        ScaleOffsetAndClamp(reinterpret_cast<float*>(deltas + begin), (end - begin) * 3u, normalizeFactor, 0.5f);
+      });
+      geometryBufferIndex += numberOfVertices;
 
       // Calculate and store the unnormalize factor.
       blendShapeUnnormalizeFactor = 1.f / normalizeFactor;
@@ -546,6 +611,13 @@ void MeshDefinition::RequestTangents()
 
 MeshDefinition::RawData
 MeshDefinition::LoadRaw(const std::string& modelsPath) const
+{
+  BufferCache buffers;
+  return LoadRaw(modelsPath, buffers);
+}
+
+MeshDefinition::RawData
+MeshDefinition::LoadRaw(const std::string& modelsPath, BufferCache& buffers, const MeshCache* cache) const
 {
   RawData raw;
   if(IsQuad())
@@ -554,12 +626,20 @@ MeshDefinition::LoadRaw(const std::string& modelsPath) const
   }
 
   const std::string meshPath = modelsPath + mUri;
-  std::ifstream     binFile(meshPath, std::ios::binary);
-  if(!binFile)
+  const uint64_t    cacheKey = cache ? MeshCache::GetKey(*this, meshPath) : 0u;
+  if(cacheKey != 0u && cache->Read(cacheKey, raw))
+  {
+    return raw;
+  }
+
+  const BufferData::Ptr buffer = buffers.Get(meshPath);
+  if(!buffer)
   {
     ExceptionFlinger(ASSERT_LOCATION) << "Failed to read geometry data from '" << meshPath << "'";
   }
 
+  const BufferData& binFile = *buffer;
+
   if(mIndices.IsDefined())
   {
     if(MaskMatch(mFlags, U32_INDICES))
@@ -794,6 +874,7 @@ MeshDefinition::LoadRaw(const std::string& modelsPath) const
     }
   }
 
+  Devel::PixelBuffer geometryPixelBuffer;
   if(HasBlendShapes())
   {
     const uint32_t numberOfVertices = mPositions.mBlob.mLength / sizeof(Vector3);
@@ -821,8 +902,8 @@ MeshDefinition::LoadRaw(const std::string& modelsPath) const
     const uint32_t numberOfBlendShapes = mBlendShapes.size();
     raw.mBlendShapeUnnormalizeFactor.Resize(numberOfBlendShapes);
 
-    Devel::PixelBuffer geometryPixelBuffer = Devel::PixelBuffer::New(textureWidth, textureHeight, Pixel::RGB32F);
-    uint8_t*           geometryBuffer      = geometryPixelBuffer.GetBuffer();
+    geometryPixelBuffer     = Devel::PixelBuffer::New(textureWidth, textureHeight, Pixel::RGB32F);
+    uint8_t* geometryBuffer = geometryPixelBuffer.GetBuffer();
 
     if(calculateGltf2BlendShapes)
     {
@@ -847,6 +928,23 @@ MeshDefinition::LoadRaw(const std::string& modelsPath) const
         ReadBlob(unnormalizeFactorBlob, binFile, reinterpret_cast<uint8_t*>(&raw.mBlendShapeUnnormalizeFactor[0u]));
       }
     }
+  }
+
+  if(cacheKey != 0u)
+  {
+    // The pixels of the blend shape texture can't be read back once converted.
+    if(geometryPixelBuffer)
+    {
+      cache->Write(cacheKey, raw, geometryPixelBuffer.GetBuffer(), geometryPixelBuffer.GetWidth(), geometryPixelBuffer.GetHeight(), geometryPixelBuffer.GetPixelFormat());
+    }
+    else
+    {
+      cache->Write(cacheKey, raw, nullptr, 0u, 0u, Pixel::INVALID);
+    }
+  }
+
+  if(geometryPixelBuffer)
+  {
     raw.mBlendShapeData = Devel::PixelBuffer::Convert(geometryPixelBuffer);
   }
 
@@ -20,6 +20,7 @@
 // INTERNAL INCLUDES
 #include "dali-scene-loader/public-api/api.h"
 #include "dali-scene-loader/public-api/blend-shape-details.h"
+#include "dali-scene-loader/public-api/buffer-cache.h"
 #include "dali-scene-loader/public-api/index.h"
 #include "dali-scene-loader/public-api/mesh-geometry.h"
 #include "dali-scene-loader/public-api/utils.h"
@@ -32,6 +33,8 @@ namespace Dali
 {
 namespace SceneLoader
 {
+class MeshCache;
+
 /**
  * @brief Defines a mesh with its attributes, the primitive type to render it as,
  *  and the file to load it from with the offset and length information for the
@@ -226,6 +229,16 @@ struct DALI_SCENE_LOADER_API MeshDefinition
    */
   RawData LoadRaw(const std::string& modelsPath) const;
 
+  /**
+   * @brief Loads raw geometry data as above, getting the buffer file from
+   *  @a buffers, so that it is only loaded once for all the meshes that share it.
+   *  If a @a cache is given, the raw data is read from it when it has been stored
+   *  before, skipping the buffer file and all processing; otherwise it is stored
+   *  there once loaded.
+   * @note This can be done on any thread.
+   */
+  RawData LoadRaw(const std::string& modelsPath, BufferCache& buffers, const MeshCache* cache = nullptr) const;
+
   /**
    * @brief Creates a MeshGeometry based firstly on the value of the uri member:
    *  if it is "quad", a textured quad is created; otherwise it uses the
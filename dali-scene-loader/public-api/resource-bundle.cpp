@@ -18,6 +18,10 @@
 // FILE HEADER
 #include "dali-scene-loader/public-api/resource-bundle.h"
 
+// INTERNAL
+#include "dali-scene-loader/internal/parallel.h"
+#include "dali-scene-loader/public-api/mesh-cache.h"
+
 // EXTERNAL
 #include <cstring>
 #include <fstream>
@@ -75,17 +79,31 @@ void ResourceBundle::LoadResources(const ResourceRefCounts& refCounts, PathProvi
 {
   const auto kForceLoad  = MaskMatch(options, Options::ForceReload);
   const auto kKeepUnused = MaskMatch(options, Options::KeepUnused);
+  const auto kParallel   = MaskMatch(options, Options::LoadInParallel);
+
+  // In parallel, the raw data are loaded by the jobs, then the resources are created from them in order.
+  std::vector<std::function<void()>> jobs;
 
-  const auto& refCountEnvMaps  = refCounts[ResourceType::Environment];
-  auto        environmentsPath = pathProvider(ResourceType::Environment);
+  const auto&                                 refCountEnvMaps  = refCounts[ResourceType::Environment];
+  auto                                        environmentsPath = pathProvider(ResourceType::Environment);
+  std::vector<EnvironmentDefinition::RawData> envMapRaws(kParallel ? refCountEnvMaps.Size() : 0u);
   for(uint32_t i = 0, iEnd = refCountEnvMaps.Size(); i != iEnd; ++i)
   {
     auto  refCount = refCountEnvMaps[i];
     auto& iEnvMap  = mEnvironmentMaps[i];
     if(refCount > 0 && (kForceLoad || !iEnvMap.second.IsLoaded()))
     {
-      auto raw       = iEnvMap.first.LoadRaw(environmentsPath);
-      iEnvMap.second = iEnvMap.first.Load(std::move(raw));
+      if(kParallel)
+      {
+        jobs.push_back([&iEnvMap, &raw = envMapRaws[i], &environmentsPath]() {
+          raw = iEnvMap.first.LoadRaw(environmentsPath);
+        });
+      }
+      else
+      {
+        auto raw       = iEnvMap.first.LoadRaw(environmentsPath);
+        iEnvMap.second = iEnvMap.first.Load(std::move(raw));
+      }
     }
     else if(!kKeepUnused && refCount == 0 && iEnvMap.second.IsLoaded())
     {
@@ -94,16 +112,26 @@ void ResourceBundle::LoadResources(const ResourceRefCounts& refCounts, PathProvi
     }
   }
 
-  const auto& refCountShaders = refCounts[ResourceType::Shader];
-  auto        shadersPath     = pathProvider(ResourceType::Shader);
+  const auto&                            refCountShaders = refCounts[ResourceType::Shader];
+  auto                                   shadersPath     = pathProvider(ResourceType::Shader);
+  std::vector<ShaderDefinition::RawData> shaderRaws(kParallel ? refCountShaders.Size() : 0u);
   for(uint32_t i = 0, iEnd = refCountShaders.Size(); i != iEnd; ++i)
   {
     auto  refCount = refCountShaders[i];
     auto& iShader  = mShaders[i];
     if(refCount > 0 && (kForceLoad || !iShader.second))
     {
-      auto raw       = iShader.first.LoadRaw(shadersPath);
-      iShader.second = iShader.first.Load(std::move(raw));
+      if(kParallel)
+      {
+        jobs.push_back([&iShader, &raw = shaderRaws[i], &shadersPath]() {
+          raw = iShader.first.LoadRaw(shadersPath);
+        });
+      }
+      else
+      {
+        auto raw       = iShader.first.LoadRaw(shadersPath);
+        iShader.second = iShader.first.Load(std::move(raw));
+      }
     }
     else if(!kKeepUnused && refCount == 0 && iShader.second)
     {
@@ -111,16 +139,28 @@ void ResourceBundle::LoadResources(const ResourceRefCounts& refCounts, PathProvi
     }
   }
 
-  const auto& refCountMeshes = refCounts[ResourceType::Mesh];
-  auto        modelsPath     = pathProvider(ResourceType::Mesh);
+  const auto&                          refCountMeshes = refCounts[ResourceType::Mesh];
+  auto                                 modelsPath     = pathProvider(ResourceType::Mesh);
+  BufferCache                          buffers; // the meshes of a scene usually share a few buffer files.
+  std::unique_ptr<MeshCache>           meshCache(mMeshCachePath.empty() ? nullptr : new MeshCache(mMeshCachePath, mMeshCacheMaxSize));
+  std::vector<MeshDefinition::RawData> meshRaws(kParallel ? refCountMeshes.Size() : 0u);
   for(uint32_t i = 0, iEnd = refCountMeshes.Size(); i != iEnd; ++i)
   {
     auto  refCount = refCountMeshes[i];
     auto& iMesh    = mMeshes[i];
     if(refCount > 0 && (kForceLoad || !iMesh.second.geometry))
     {
-      auto raw     = iMesh.first.LoadRaw(modelsPath);
-      iMesh.second = iMesh.first.Load(std::move(raw));
+      if(kParallel)
+      {
+        jobs.push_back([&iMesh, &raw = meshRaws[i], &modelsPath, &buffers, &meshCache]() {
+          raw = iMesh.first.LoadRaw(modelsPath, buffers, meshCache.get());
+        });
+      }
+      else
+      {
+        auto raw     = iMesh.first.LoadRaw(modelsPath, buffers, meshCache.get());
+        iMesh.second = iMesh.first.Load(std::move(raw));
+      }
     }
     else if(!kKeepUnused && refCount == 0 && iMesh.second.geometry)
     {
@@ -128,22 +168,75 @@ void ResourceBundle::LoadResources(const ResourceRefCounts& refCounts, PathProvi
     }
   }
 
-  const auto& refCountMaterials = refCounts[ResourceType::Material];
-  auto        imagesPath        = pathProvider(ResourceType::Material);
+  const auto&                              refCountMaterials = refCounts[ResourceType::Material];
+  auto                                     imagesPath        = pathProvider(ResourceType::Material);
+  std::vector<MaterialDefinition::RawData> materialRaws(kParallel ? refCountMaterials.Size() : 0u);
   for(uint32_t i = 0, iEnd = refCountMaterials.Size(); i != iEnd; ++i)
   {
     auto  refCount  = refCountMaterials[i];
     auto& iMaterial = mMaterials[i];
     if(refCount > 0 && (kForceLoad || !iMaterial.second))
     {
-      auto raw         = iMaterial.first.LoadRaw(imagesPath);
-      iMaterial.second = iMaterial.first.Load(mEnvironmentMaps, std::move(raw));
+      if(kParallel)
+      {
+        jobs.push_back([&iMaterial, &raw = materialRaws[i], &imagesPath]() {
+          raw = iMaterial.first.LoadRaw(imagesPath);
+        });
+      }
+      else
+      {
+        auto raw         = iMaterial.first.LoadRaw(imagesPath);
+        iMaterial.second = iMaterial.first.Load(mEnvironmentMaps, std::move(raw));
+      }
     }
     else if(!kKeepUnused && refCount == 0 && iMaterial.second)
     {
       iMaterial.second = TextureSet();
     }
   }
+
+  if(kParallel)
+  {
+    RunInParallel(jobs);
+
+    // The resources which were loaded are the ones with a reference, that are still to be created.
+    for(uint32_t i = 0, iEnd = refCountEnvMaps.Size(); i != iEnd; ++i)
+    {
+      auto& iEnvMap = mEnvironmentMaps[i];
+      if(refCountEnvMaps[i] > 0 && (kForceLoad || !iEnvMap.second.IsLoaded()))
+      {
+        iEnvMap.second = iEnvMap.first.Load(std::move(envMapRaws[i]));
+      }
+    }
+
+    for(uint32_t i = 0, iEnd = refCountShaders.Size(); i != iEnd; ++i)
+    {
+      auto& iShader = mShaders[i];
+      if(refCountShaders[i] > 0 && (kForceLoad || !iShader.second))
+      {
+        iShader.second = iShader.first.Load(std::move(shaderRaws[i]));
+      }
+    }
+
+    for(uint32_t i = 0, iEnd = refCountMeshes.Size(); i != iEnd; ++i)
+    {
+      auto& iMesh = mMeshes[i];
+      if(refCountMeshes[i] > 0 && (kForceLoad || !iMesh.second.geometry))
+      {
+        iMesh.second = iMesh.first.Load(std::move(meshRaws[i]));
+      }
+    }
+
+    // The materials are created last, from the environment maps.
+    for(uint32_t i = 0, iEnd = refCountMaterials.Size(); i != iEnd; ++i)
+    {
+      auto& iMaterial = mMaterials[i];
+      if(refCountMaterials[i] > 0 && (kForceLoad || !iMaterial.second))
+      {
+        iMaterial.second = iMaterial.first.Load(mEnvironmentMaps, std::move(materialRaws[i]));
+      }
+    }
+  }
 }
 
 } // namespace SceneLoader
@@ -20,6 +20,7 @@
 // INTERNAL
 #include "dali-scene-loader/public-api/environment-definition.h"
 #include "dali-scene-loader/public-api/material-definition.h"
+#include "dali-scene-loader/public-api/mesh-cache.h"
 #include "dali-scene-loader/public-api/mesh-definition.h"
 #include "dali-scene-loader/public-api/shader-definition.h"
 #include "dali-scene-loader/public-api/skeleton-definition.h"
@@ -72,9 +73,10 @@ public:
 
     enum Value : Type
     {
-      None        = 0,
-      ForceReload = NthBit(0), ///< Load resources [again] even if they were already loaded.
-      KeepUnused  = NthBit(1)  ///<s Don't reset handles to resources that had a 0 reference count.
+      None           = 0,
+      ForceReload    = NthBit(0), ///< Load resources [again] even if they were already loaded.
+      KeepUnused     = NthBit(1), ///<s Don't reset handles to resources that had a 0 reference count.
+      LoadInParallel = NthBit(2)  ///< Load the raw data of the resources in worker threads; only the DALi resources are created on the calling thread.
     };
   };
 
@@ -108,6 +110,8 @@ public:
    *  loaded unless we already have a handle to them (OR the ForceReload option was specified).
    *  Any handles we have to resources that come in with a zero ref count will be reset,
    *  UNLESS the KeepUnused option was specified.
+   *  With the LoadInParallel option, the raw data of all resources are loaded on as
+   *  many threads as there are cores, before the resources are created from them.
    */
   void LoadResources(const ResourceRefCounts& refCounts,
                      PathProvider             pathProvider,
@@ -120,6 +124,9 @@ public: // DATA
   MaterialDefinition::Vector    mMaterials;
 
   SkeletonDefinition::Vector mSkeletons;
+
+  std::string mMeshCachePath;                                    ///< If set, the directory that LoadResources() caches the preprocessed raw data of meshes in; see MeshCache.
+  uint64_t    mMeshCacheMaxSize = MeshCache::DEFAULT_MAX_SIZE; ///< The size in bytes that the cache files in mMeshCachePath are kept within.
 };
 
 } // namespace SceneLoader
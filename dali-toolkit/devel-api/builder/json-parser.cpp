@@ -102,6 +102,11 @@ void JsonParser::Write(std::ostream& output, int indent) const
   return GetImplementation(*this).Write(output, indent);
 }
 
+void JsonParser::WriteBinary(std::ostream& output) const
+{
+  return GetImplementation(*this).WriteBinary(output);
+}
+
 JsonParser::JsonParser(Internal::JsonParser* internal)
 : BaseHandle(internal)
 {
@@ -77,6 +77,7 @@ public:
   /*
    * Parse the source and construct a node tree.
    * Subsequent calls to this function will merge the trees.
+   * The source can also be a binary tree written by WriteBinary(), which is loaded without parsing.
    * @param source The json source to parse
    * @return true if parsed okay, otherwise an error.
    */
@@ -129,6 +130,16 @@ public:
    */
   void Write(std::ostream& output, int indent) const;
 
+  /*
+   * Write the tree to output stream in a compact binary format.
+   * The binary tree can be given to Parse() instead of the json source, e.g. a json theme file can be
+   * precompiled offline by dali-theme-compiler and replaced by its binary tree, which the StyleManager then
+   * loads without parsing.
+   * The binary format is only read on machines with the byte order of the writer.
+   * @param output The binary stream to write to
+   */
+  void WriteBinary(std::ostream& output) const;
+
 public: // Not intended for application developers
   /**
    * This constructor is used by Dali New() methods
@@ -45,6 +45,7 @@ TreeNode::TreeNode()
   mNextSibling(NULL),
   mFirstChild(NULL),
   mLastChild(NULL),
+  mChildIndex(NULL),
   mStringValue(NULL),
   mType(TreeNode::IS_NULL),
   mSubstituion(false)
@@ -117,6 +118,11 @@ size_t TreeNode::Count(std::string_view childName) const
 
 const TreeNode* TreeNode::GetChild(std::string_view childName) const
 {
+  if(mChildIndex)
+  {
+    return mChildIndex->Find(childName);
+  }
+
   const TreeNode* p = mFirstChild;
   while(p)
   {
@@ -31,6 +31,7 @@ namespace Toolkit
 namespace Internal DALI_INTERNAL
 {
 class TreeNodeManipulator;
+struct TreeNodeChildIndex;
 
 } // namespace DALI_INTERNAL
 
@@ -219,6 +220,8 @@ private:
   TreeNode* mFirstChild;  ///< The nodes first child
   TreeNode* mLastChild;   ///< The nodes last child
 
+  Internal::TreeNodeChildIndex* mChildIndex; ///< The index of the children by name, only for nodes with many children
+
   union
   {
     const char* mStringValue; ///< The node string value
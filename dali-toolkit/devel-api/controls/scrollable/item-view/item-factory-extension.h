@@ -0,0 +1,76 @@
+#ifndef DALI_TOOLKIT_ITEM_FACTORY_EXTENSION_H
+#define DALI_TOOLKIT_ITEM_FACTORY_EXTENSION_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/scrollable/item-view/item-factory.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+/**
+ * @brief The extension of ItemFactory which lets ItemView recycle the actors of its items.
+ *
+ * When the factory returns an extension from ItemFactory::GetExtension(), the actors which
+ * ItemView releases are kept, after ItemFactory::ItemReleased() is called, in a pool for each
+ * item view type. When an item of the same type becomes visible, ItemView takes an actor from
+ * the pool and passes it to BindItem() instead of calling ItemFactory::NewItem(), so the
+ * controls and visuals of the items aren't created and destroyed while scrolling.
+ *
+ * Only the actors created by ItemFactory::NewItem() are recycled. Once released, they belong
+ * to ItemView, and the factory should not keep or reuse them itself.
+ */
+class ItemFactory::Extension
+{
+public:
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~Extension()
+  {
+  }
+
+  /**
+   * @brief Queries the view type of an item; the actors are only recycled between items of the
+   * same type, e.g. headers and rows of a list.
+   *
+   * @param[in] itemId The ID of the item
+   * @return The view type of the item
+   */
+  virtual unsigned int GetItemViewType(unsigned int itemId)
+  {
+    return 0u;
+  }
+
+  /**
+   * @brief Binds a recycled actor, created by ItemFactory::NewItem() for an item of the same
+   * view type, to another item; typically by updating its contents.
+   *
+   * @param[in] itemId The ID of the newly visible item
+   * @param[in] actor The actor to represent the item
+   */
+  virtual void BindItem(unsigned int itemId, Actor actor) = 0;
+};
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_ITEM_FACTORY_EXTENSION_H
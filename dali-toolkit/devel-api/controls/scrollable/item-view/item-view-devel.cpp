@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/controls/scrollable/item-view/item-view-devel.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/scrollable/item-view/item-view-impl.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelItemView
+{
+void SetBatchedLayoutEnabled(ItemView itemView, bool enabled)
+{
+  GetImpl(itemView).SetBatchedLayoutEnabled(enabled);
+}
+
+bool IsBatchedLayoutEnabled(ItemView itemView)
+{
+  return GetImpl(itemView).IsBatchedLayoutEnabled();
+}
+
+} // namespace DevelItemView
+
+} // namespace Toolkit
+
+} // namespace Dali
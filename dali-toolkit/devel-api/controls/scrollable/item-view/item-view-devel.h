@@ -0,0 +1,57 @@
+#ifndef DALI_TOOLKIT_ITEM_VIEW_DEVEL_H
+#define DALI_TOOLKIT_ITEM_VIEW_DEVEL_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/scrollable/item-view/item-view.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelItemView
+{
+/**
+ * @brief Enable or disable the batched layout of the items.
+ *
+ * When enabled, the items of the grid and depth layouts are updated in one loop each frame,
+ * instead of by the constraints which the layout applies to each item. Other layouts keep
+ * using their constraints. It's disabled by default.
+ *
+ * @param[in] itemView The ItemView
+ * @param[in] enabled True to update the items in a batch
+ * @note The items of a batched layout are hidden by setting their alpha to 0, rather than their visibility.
+ */
+DALI_TOOLKIT_API void SetBatchedLayoutEnabled(ItemView itemView, bool enabled);
+
+/**
+ * @brief Query whether the batched layout of the items is enabled.
+ *
+ * @param[in] itemView The ItemView
+ * @return True if the items are updated in a batch
+ */
+DALI_TOOLKIT_API bool IsBatchedLayoutEnabled(ItemView itemView);
+
+} // namespace DevelItemView
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_ITEM_VIEW_DEVEL_H
@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/controls/scrollable/item-view/variable-size-list-layout.h>
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/animation/constraint.h>
+#include <dali/public-api/object/weak-handle.h>
+#include <algorithm>
+#include <cmath>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/scrollable/item-view/item-extent-index.h>
+#include <dali-toolkit/public-api/controls/scrollable/item-view/item-view.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace // unnamed namespace
+{
+const float DEFAULT_ITEM_EXTENT                   = 100.0f;
+const float DEFAULT_SCROLL_SPEED_FACTOR           = 1.0f;
+const float DEFAULT_MAXIMUM_SWIPE_SPEED           = 100.0f;
+const float DEFAULT_ITEM_FLICK_ANIMATION_DURATION = 0.00015f; // per pixel, i.e. 0.015 seconds per item of the default extent
+
+/**
+ * @brief The distance between the center of an item and the center of the layout, along the scroll direction.
+ *
+ * The layout position is the opposite of the offset of the top of the layout, in pixels.
+ */
+float GetItemOffset(double itemOffset, float itemExtent, float layoutPosition, float layoutExtent)
+{
+  return static_cast<float>(itemOffset + layoutPosition + (itemExtent - layoutExtent) * 0.5f);
+}
+
+Vector3 CalculateItemPosition(float itemOffset, ControlOrientation::Type orientation)
+{
+  switch(orientation)
+  {
+    case ControlOrientation::Up:
+    {
+      return Vector3(0.0f, itemOffset, 0.0f);
+    }
+    case ControlOrientation::Left:
+    {
+      return Vector3(itemOffset, 0.0f, 0.0f);
+    }
+    case ControlOrientation::Down:
+    {
+      return Vector3(0.0f, -itemOffset, 0.0f);
+    }
+    default: // ControlOrientation::Right
+    {
+      return Vector3(-itemOffset, 0.0f, 0.0f);
+    }
+  }
+}
+
+struct VariableSizeListPositionConstraint
+{
+  VariableSizeListPositionConstraint(double itemOffset, float itemExtent, ControlOrientation::Type orientation)
+  : mItemOffset(itemOffset),
+    mItemExtent(itemExtent),
+    mOrientation(orientation)
+  {
+  }
+
+  void operator()(Vector3& current, const PropertyInputContainer& inputs)
+  {
+    const float    layoutPosition = inputs[0]->GetFloat();
+    const Vector3& layoutSize     = inputs[1]->GetVector3();
+    const float    layoutExtent   = IsHorizontal(mOrientation) ? layoutSize.width : layoutSize.height;
+
+    current = CalculateItemPosition(GetItemOffset(mItemOffset, mItemExtent, layoutPosition, layoutExtent), mOrientation);
+  }
+
+public:
+  double                   mItemOffset;
+  float                    mItemExtent;
+  ControlOrientation::Type mOrientation;
+};
+
+void VariableSizeListRotationConstraint0(Quaternion& current, const PropertyInputContainer& /* inputs */)
+{
+  current = Quaternion(Radian(0.0f), Vector3::ZAXIS);
+}
+
+void VariableSizeListRotationConstraint90(Quaternion& current, const PropertyInputContainer& /* inputs */)
+{
+  current = Quaternion(Radian(1.5f * Math::PI), Vector3::ZAXIS);
+}
+
+void VariableSizeListRotationConstraint180(Quaternion& current, const PropertyInputContainer& /* inputs */)
+{
+  current = Quaternion(Radian(Math::PI), Vector3::ZAXIS);
+}
+
+void VariableSizeListRotationConstraint270(Quaternion& current, const PropertyInputContainer& /* inputs */)
+{
+  current = Quaternion(Radian(0.5f * Math::PI), Vector3::ZAXIS);
+}
+
+struct VariableSizeListVisibilityConstraint
+{
+  VariableSizeListVisibilityConstraint(double itemOffset, float itemExtent, bool horizontal)
+  : mItemOffset(itemOffset),
+    mItemExtent(itemExtent),
+    mHorizontal(horizontal)
+  {
+  }
+
+  void operator()(bool& current, const PropertyInputContainer& inputs)
+  {
+    const float    layoutPosition = inputs[0]->GetFloat();
+    const Vector3& layoutSize     = inputs[1]->GetVector3();
+    const float    layoutExtent   = mHorizontal ? layoutSize.width : layoutSize.height;
+
+    // Whether any part of the item is within the layout.
+    const float itemOffset = GetItemOffset(mItemOffset, mItemExtent, layoutPosition, layoutExtent);
+    current                = std::abs(itemOffset) < (layoutExtent + mItemExtent) * 0.5f;
+  }
+
+public:
+  double mItemOffset;
+  float  mItemExtent;
+  bool   mHorizontal;
+};
+
+} // unnamed namespace
+
+namespace Dali
+{
+namespace Toolkit
+{
+struct VariableSizeListLayout::Impl
+{
+  Impl()
+  : mExtents(DEFAULT_ITEM_EXTENT),
+    mItemView(),
+    mScrollSpeedFactor(DEFAULT_SCROLL_SPEED_FACTOR),
+    mMaximumSwipeSpeed(DEFAULT_MAXIMUM_SWIPE_SPEED),
+    mItemFlickAnimationDuration(DEFAULT_ITEM_FLICK_ANIMATION_DURATION)
+  {
+  }
+
+  Internal::ItemExtentIndex     mExtents;
+  WeakHandle<Toolkit::ItemView> mItemView; ///< The ItemView whose items were last constrained by the layout.
+
+  float mScrollSpeedFactor;
+  float mMaximumSwipeSpeed;
+  float mItemFlickAnimationDuration;
+};
+
+VariableSizeListLayoutPtr VariableSizeListLayout::New()
+{
+  return VariableSizeListLayoutPtr(new VariableSizeListLayout());
+}
+
+VariableSizeListLayout::~VariableSizeListLayout()
+{
+  delete mImpl;
+}
+
+void VariableSizeListLayout::SetDefaultItemExtent(float extent)
+{
+  if(extent != mImpl->mExtents.GetDefaultExtent())
+  {
+    mImpl->mExtents.SetDefaultExtent(extent);
+    UpdateItems(0u);
+  }
+}
+
+float VariableSizeListLayout::GetDefaultItemExtent() const
+{
+  return mImpl->mExtents.GetDefaultExtent();
+}
+
+void VariableSizeListLayout::SetItemExtent(unsigned int itemId, float extent)
+{
+  const float oldExtent = mImpl->mExtents.GetExtent(itemId);
+  mImpl->mExtents.SetExtent(itemId, extent);
+  if(mImpl->mExtents.GetExtent(itemId) != oldExtent)
+  {
+    UpdateItems(itemId);
+  }
+}
+
+float VariableSizeListLayout::GetItemExtent(unsigned int itemId) const
+{
+  return mImpl->mExtents.GetExtent(itemId);
+}
+
+void VariableSizeListLayout::ClearItemExtents()
+{
+  mImpl->mExtents.Clear();
+  UpdateItems(0u);
+}
+
+void VariableSizeListLayout::SetScrollSpeedFactor(float scrollSpeed)
+{
+  mImpl->mScrollSpeedFactor = scrollSpeed;
+}
+
+void VariableSizeListLayout::SetMaximumSwipeSpeed(float speed)
+{
+  mImpl->mMaximumSwipeSpeed = speed;
+}
+
+void VariableSizeListLayout::SetItemFlickAnimationDuration(float durationSeconds)
+{
+  mImpl->mItemFlickAnimationDuration = durationSeconds;
+}
+
+float VariableSizeListLayout::GetScrollSpeedFactor() const
+{
+  return mImpl->mScrollSpeedFactor;
+}
+
+float VariableSizeListLayout::GetMaximumSwipeSpeed() const
+{
+  return mImpl->mMaximumSwipeSpeed;
+}
+
+float VariableSizeListLayout::GetItemFlickAnimationDuration() const
+{
+  return mImpl->mItemFlickAnimationDuration;
+}
+
+float VariableSizeListLayout::GetClosestOnScreenLayoutPosition(int itemID, float currentLayoutPosition, const Vector3& layoutSize)
+{
+  const Internal::ItemExtentIndex& extents      = mImpl->mExtents;
+  const float                      layoutExtent = IsHorizontal(GetOrientation()) ? layoutSize.width : layoutSize.height;
+  const unsigned int               itemId       = static_cast<unsigned int>(std::max(itemID, 0));
+
+  const double scrollOffset = -currentLayoutPosition;
+  const double itemBegin    = extents.GetOffset(itemId);
+  const double itemEnd      = itemBegin + extents.GetExtent(itemId);
+
+  if(itemBegin < scrollOffset || itemEnd - itemBegin >= layoutExtent)
+  {
+    // Align the item to the start of the layout
+    return static_cast<float>(-itemBegin);
+  }
+  if(itemEnd > scrollOffset + layoutExtent)
+  {
+    // Align the item to the end of the layout
+    return static_cast<float>(layoutExtent - itemEnd);
+  }
+  return currentLayoutPosition;
+}
+
+float VariableSizeListLayout::GetMinimumLayoutPosition(unsigned int numberOfItems, Vector3 layoutSize) const
+{
+  const float  layoutExtent = IsHorizontal(GetOrientation()) ? layoutSize.width : layoutSize.height;
+  const double totalExtent  = mImpl->mExtents.GetOffset(numberOfItems);
+
+  // The last item ends at the end of the layout, unless all the items fit within it.
+  return totalExtent > layoutExtent ? static_cast<float>(layoutExtent - totalExtent) : 0.0f;
+}
+
+float VariableSizeListLayout::GetClosestAnchorPosition(float layoutPosition) const
+{
+  // Anchor the start of the layout to the closest edge of the item there.
+  const double       scrollOffset = -layoutPosition;
+  const unsigned int itemId       = mImpl->mExtents.FindItem(scrollOffset);
+  const double       itemBegin    = mImpl->mExtents.GetOffset(itemId);
+  const double       itemEnd      = itemBegin + mImpl->mExtents.GetExtent(itemId);
+
+  return static_cast<float>(scrollOffset - itemBegin <= itemEnd - scrollOffset ? -itemBegin : -itemEnd);
+}
+
+float VariableSizeListLayout::GetItemScrollToPosition(unsigned int itemId) const
+{
+  return static_cast<float>(-mImpl->mExtents.GetOffset(itemId));
+}
+
+ItemRange VariableSizeListLayout::GetItemsWithinArea(float firstItemPosition, Vector3 layoutSize) const
+{
+  const float  layoutExtent = IsHorizontal(GetOrientation()) ? layoutSize.width : layoutSize.height;
+  const double scrollOffset = -firstItemPosition;
+
+  unsigned int firstItemIndex = mImpl->mExtents.FindItem(scrollOffset);
+  unsigned int lastItemIndex  = mImpl->mExtents.FindItem(scrollOffset + layoutExtent) + 1u;
+
+  return ItemRange(firstItemIndex, lastItemIndex);
+}
+
+unsigned int VariableSizeListLayout::GetReserveItemCount(Vector3 layoutSize) const
+{
+  const float layoutExtent = IsHorizontal(GetOrientation()) ? layoutSize.width : layoutSize.height;
+  return static_cast<unsigned int>(ceil(layoutExtent / mImpl->mExtents.GetDefaultExtent()));
+}
+
+void VariableSizeListLayout::GetDefaultItemSize(unsigned int itemId, const Vector3& layoutSize, Vector3& itemSize) const
+{
+  itemSize.width  = IsHorizontal(GetOrientation()) ? layoutSize.height : layoutSize.width;
+  itemSize.height = itemSize.depth = mImpl->mExtents.GetExtent(itemId);
+}
+
+Degree VariableSizeListLayout::GetScrollDirection() const
+{
+  Degree                   scrollDirection(0.0f);
+  ControlOrientation::Type orientation = GetOrientation();
+
+  if(orientation == ControlOrientation::Up)
+  {
+    scrollDirection = Degree(0.0f);
+  }
+  else if(orientation == ControlOrientation::Left)
+  {
+    scrollDirection = Degree(90.0f);
+  }
+  else if(orientation == ControlOrientation::Down)
+  {
+    scrollDirection = Degree(180.0f);
+  }
+  else // orientation == ControlOrientation::Right
+  {
+    scrollDirection = Degree(270.0f);
+  }
+
+  return scrollDirection;
+}
+
+void VariableSizeListLayout::ApplyConstraints(Actor& actor, const int itemId, const Vector3& layoutSize, const Actor& itemViewActor)
+{
+  Dali::Toolkit::ItemView itemView = Dali::Toolkit::ItemView::DownCast(itemViewActor);
+  if(itemView)
+  {
+    // Remember the ItemView, to constrain its items again when their extents change.
+    mImpl->mItemView = WeakHandle<Toolkit::ItemView>(itemView);
+
+    // The constraints take the offset and extent of the item as they are now; SetItemExtent() applies them again.
+    const double                   itemOffset  = mImpl->mExtents.GetOffset(itemId);
+    const float                    itemExtent  = mImpl->mExtents.GetExtent(itemId);
+    const ControlOrientation::Type orientation = GetOrientation();
+
+    // Position constraint
+    Constraint constraint = Constraint::New<Vector3>(actor, Actor::Property::POSITION, VariableSizeListPositionConstraint(itemOffset, itemExtent, orientation));
+    constraint.AddSource(ParentSource(Toolkit::ItemView::Property::LAYOUT_POSITION));
+    constraint.AddSource(ParentSource(Actor::Property::SIZE));
+    constraint.Apply();
+
+    // Rotation constraint
+    if(orientation == ControlOrientation::Up)
+    {
+      constraint = Constraint::New<Quaternion>(actor, Actor::Property::ORIENTATION, &VariableSizeListRotationConstraint0);
+    }
+    else if(orientation == ControlOrientation::Left)
+    {
+      constraint = Constraint::New<Quaternion>(actor, Actor::Property::ORIENTATION, &VariableSizeListRotationConstraint90);
+    }
+    else if(orientation == ControlOrientation::Down)
+    {
+      constraint = Constraint::New<Quaternion>(actor, Actor::Property::ORIENTATION, &VariableSizeListRotationConstraint180);
+    }
+    else // orientation == ControlOrientation::Right
+    {
+      constraint = Constraint::New<Quaternion>(actor, Actor::Property::ORIENTATION, &VariableSizeListRotationConstraint270);
+    }
+    constraint.Apply();
+
+    // Visibility constraint
+    constraint = Constraint::New<bool>(actor, Actor::Property::VISIBLE, VariableSizeListVisibilityConstraint(itemOffset, itemExtent, IsHorizontal(orientation)));
+    constraint.AddSource(ParentSource(Toolkit::ItemView::Property::LAYOUT_POSITION));
+    constraint.AddSource(ParentSource(Actor::Property::SIZE));
+    constraint.SetRemoveAction(Dali::Constraint::DISCARD);
+    constraint.Apply();
+  }
+}
+
+Vector3 VariableSizeListLayout::GetItemPosition(int itemID, float currentLayoutPosition, const Vector3& layoutSize) const
+{
+  const ControlOrientation::Type orientation  = GetOrientation();
+  const float                    layoutExtent = IsHorizontal(orientation) ? layoutSize.width : layoutSize.height;
+  const unsigned int             itemId       = static_cast<unsigned int>(std::max(itemID, 0));
+
+  return CalculateItemPosition(GetItemOffset(mImpl->mExtents.GetOffset(itemId), mImpl->mExtents.GetExtent(itemId), currentLayoutPosition, layoutExtent), orientation);
+}
+
+void VariableSizeListLayout::UpdateItems(unsigned int firstItemId)
+{
+  Toolkit::ItemView itemView = mImpl->mItemView.GetHandle();
+  if(!itemView || itemView.GetActiveLayout().Get() != this)
+  {
+    return;
+  }
+
+  // Only the items of the ItemView, i.e. those within the visible area and its reserve, are constrained again.
+  ItemRange range(0u, 0u);
+  itemView.GetItemsRange(range);
+
+  const Vector3 layoutSize = itemView.GetCurrentProperty<Vector3>(Actor::Property::SIZE);
+  for(unsigned int itemId = std::max(firstItemId, range.begin); itemId < range.end; ++itemId)
+  {
+    Actor actor = itemView.GetItem(itemId);
+    if(actor)
+    {
+      Vector3 size;
+      GetItemSize(itemId, layoutSize, size);
+      actor.SetProperty(Actor::Property::SIZE, size.GetVectorXY());
+
+      actor.RemoveConstraints();
+      ApplyConstraints(actor, itemId, layoutSize, itemView);
+    }
+  }
+}
+
+VariableSizeListLayout::VariableSizeListLayout()
+: mImpl(new Impl())
+{
+}
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,226 @@
+#ifndef DALI_TOOLKIT_VARIABLE_SIZE_LIST_LAYOUT_H
+#define DALI_TOOLKIT_VARIABLE_SIZE_LIST_LAYOUT_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/scrollable/item-view/item-layout.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+class VariableSizeListLayout;
+
+typedef IntrusivePtr<VariableSizeListLayout> VariableSizeListLayoutPtr; ///< Pointer to a Dali::Toolkit::VariableSizeListLayout object
+
+/**
+ * @brief An ItemView layout which arranges items in a single column, each with its own extent
+ * along the scroll direction, e.g. the rows of a chat or a feed.
+ *
+ * The extents are kept in an index of their sums, so that the visible items, and the position of
+ * an item, are found in O(log n), and changing the extent of one item is O(log n) too; the list
+ * isn't laid out again. The items whose extent isn't set have the default extent, so only the
+ * items which were measured need to be set.
+ *
+ * Unlike the other layouts, the layout positions are in pixels: the layout position is the
+ * opposite of the offset of the top of the view from the top of the first item, so that a drag
+ * moves the items by the same distance whatever their extents. ItemView::ScrollToItem() scrolls
+ * the top of the item to the top of the view.
+ *
+ * When the extent of an item changes, the items of the ItemView after it are positioned again
+ * at once; the items which aren't shown are positioned when they're added.
+ *
+ * @note As ItemView::SetRefreshInterval() is in layout positions, it is in pixels with this layout.
+ * By default, the ItemView refreshes every 20 items of the default extent.
+ * The overshoot of the ItemView is full once it scrolls one default extent beyond either end.
+ * @note The size of the items is given by their extent, so ItemLayout::SetItemSize() should
+ * not be used with this layout.
+ */
+class DALI_TOOLKIT_API VariableSizeListLayout : public ItemLayout
+{
+public:
+  /**
+   * @brief Create a new variable size list layout.
+   */
+  static VariableSizeListLayoutPtr New();
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~VariableSizeListLayout();
+
+  /**
+   * @brief Set the extent of the items whose extent isn't set.
+   *
+   * @pre extent must be greater than zero.
+   * @param[in] extent The default extent of the items.
+   */
+  void SetDefaultItemExtent(float extent);
+
+  /**
+   * @brief Get the extent of the items whose extent isn't set.
+   *
+   * @return The default extent of the items.
+   */
+  float GetDefaultItemExtent() const;
+
+  /**
+   * @brief Set the extent of an item along the scroll direction.
+   *
+   * The items which the ItemView shows from this one onwards are positioned again, in O(log n) each.
+   *
+   * @param[in] itemId The ID of the item.
+   * @param[in] extent The extent of the item.
+   */
+  void SetItemExtent(unsigned int itemId, float extent);
+
+  /**
+   * @brief Get the extent of an item along the scroll direction.
+   *
+   * @param[in] itemId The ID of the item.
+   * @return The extent of the item.
+   */
+  float GetItemExtent(unsigned int itemId) const;
+
+  /**
+   * @brief Reset the extent of all the items to the default extent, e.g. when the items are replaced.
+   */
+  void ClearItemExtents();
+
+  /**
+   * @brief Set the factor used to customise the scroll speed while dragging and swiping the layout.
+   *
+   * The factor is in layout positions, i.e. pixels, per pixel dragged; it is 1 by default.
+   *
+   * @param[in] scrollSpeed The scroll speed factor.
+   */
+  void SetScrollSpeedFactor(float scrollSpeed);
+
+  /**
+   * @brief Set the maximum swipe speed in pixels per second.
+   *
+   * @param[in] speed The maximum swipe speed.
+   */
+  void SetMaximumSwipeSpeed(float speed);
+
+  /**
+   * @brief Set the duration of the flick animation in seconds, per pixel of the flick.
+   *
+   * @pre durationSeconds must be greater than zero.
+   * @param[in] durationSeconds The duration of flick animation in seconds.
+   */
+  void SetItemFlickAnimationDuration(float durationSeconds);
+
+  /**
+   * @copydoc ItemLayout::GetScrollSpeedFactor()
+   */
+  float GetScrollSpeedFactor() const override;
+
+  /**
+   * @copydoc ItemLayout::GetMaximumSwipeSpeed()
+   */
+  float GetMaximumSwipeSpeed() const override;
+
+  /**
+   * @copydoc ItemLayout::GetItemFlickAnimationDuration()
+   */
+  float GetItemFlickAnimationDuration() const override;
+
+  /**
+   * @copydoc ItemLayout::GetClosestOnScreenLayoutPosition()
+   */
+  float GetClosestOnScreenLayoutPosition(int itemID, float currentLayoutPosition, const Vector3& layoutSize) override;
+
+private:
+  /**
+   * @copydoc ItemLayout::GetMinimumLayoutPosition()
+   */
+  float GetMinimumLayoutPosition(unsigned int numberOfItems, Vector3 layoutSize) const override;
+
+  /**
+   * @copydoc ItemLayout::GetClosestAnchorPosition()
+   */
+  float GetClosestAnchorPosition(float layoutPosition) const override;
+
+  /**
+   * @copydoc ItemLayout::GetItemScrollToPosition()
+   */
+  float GetItemScrollToPosition(unsigned int itemId) const override;
+
+  /**
+   * @copydoc ItemLayout::GetItemsWithinArea()
+   */
+  ItemRange GetItemsWithinArea(float firstItemPosition, Vector3 layoutSize) const override;
+
+  /**
+   * @copydoc ItemLayout::GetReserveItemCount()
+   */
+  unsigned int GetReserveItemCount(Vector3 layoutSize) const override;
+
+  /**
+   * @copydoc ItemLayout::GetDefaultItemSize()
+   */
+  void GetDefaultItemSize(unsigned int itemId, const Vector3& layoutSize, Vector3& itemSize) const override;
+
+  /**
+   * @copydoc ItemLayout::GetScrollDirection()
+   */
+  Degree GetScrollDirection() const override;
+
+  /**
+   * @copydoc ItemLayout::ApplyConstraints()
+   */
+  void ApplyConstraints(Actor& actor, const int itemId, const Vector3& layoutSize, const Actor& itemViewActor) override;
+
+  /**
+   * @copydoc ItemLayout::GetItemPosition()
+   */
+  Vector3 GetItemPosition(int itemID, float currentLayoutPosition, const Vector3& layoutSize) const override;
+
+  /**
+   * @brief Constrain the items of the ItemView which uses this layout again, from @a firstItemId,
+   * after their offsets or extents have changed.
+   *
+   * @param[in] firstItemId The first item which has moved.
+   */
+  void UpdateItems(unsigned int firstItemId);
+
+protected:
+  /**
+   * @brief Protected constructor; see also VariableSizeListLayout::New().
+   */
+  VariableSizeListLayout();
+
+private:
+  // Undefined
+  VariableSizeListLayout(const VariableSizeListLayout& itemLayout);
+
+  // Undefined
+  VariableSizeListLayout& operator=(const VariableSizeListLayout& rhs);
+
+private:
+  struct Impl;
+  Impl* mImpl;
+};
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_VARIABLE_SIZE_LIST_LAYOUT_H
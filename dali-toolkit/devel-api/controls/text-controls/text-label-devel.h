@@ -201,6 +201,24 @@ enum Type
    * @note If the value is less than 1, the lines could to be overlapped.
    */
   RELATIVE_LINE_SIZE,
+
+  /**
+   * @brief Whether the text is rasterized in a worker thread.
+   * @details Name "enableAsyncRendering", type Property::BOOLEAN.
+   * @note The default value is false, the text is rasterized synchronously in the event thread.
+   *   When enabled, the previous text is displayed until the new one has been rasterized.
+   *   A text higher than the maximum texture size is always rasterized synchronously.
+   */
+  ENABLE_ASYNC_RENDERING,
+
+  /**
+   * @brief The area of the label where its text is visible, e.g. the part of the label within the parent scrolling it.
+   * @details Name "visibleArea", type Property::VECTOR4 (x, y, width, height), in the local coordinates of the label from its top left corner.
+   * @note The default value is Vector4::ZERO, the whole label is visible.
+   *   A text higher than the maximum texture size is cut into tiles, and only the tiles within the visible area are rendered.
+   *   The other tiles are rendered once the visible area reaches them, so the parent scrolling the label is expected to update it.
+   */
+  VISIBLE_AREA,
 };
 
 } // namespace Property
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -47,6 +47,35 @@ TextureSet RemoveTexture(const std::string& textureUrl)
   return textureMgr.RemoveExternalTexture(textureUrl);
 }
 
+void SetUnusedTextureCacheBudget(uint32_t budget)
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  textureMgr.SetUnusedTextureCacheBudget(budget);
+}
+
+uint32_t GetUnusedTextureCacheBudget()
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  return static_cast<uint32_t>(textureMgr.GetUnusedTextureCacheBudget());
+}
+
+CacheStatistics GetCacheStatistics()
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+
+  auto            internalStatistics = textureMgr.GetCacheStatistics();
+  CacheStatistics statistics;
+  statistics.hitCount                = internalStatistics.hitCount;
+  statistics.missCount               = internalStatistics.missCount;
+  statistics.evictionCount           = internalStatistics.evictionCount;
+  statistics.unusedTextureCount      = internalStatistics.unusedTextureCount;
+  statistics.unusedTextureMemorySize = static_cast<uint32_t>(internalStatistics.unusedTextureMemorySize);
+  return statistics;
+}
+
 } // namespace TextureManager
 
 } // namespace Toolkit
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_DEVEL_API_TEXTURE_MANAGER_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -61,6 +61,39 @@ DALI_TOOLKIT_API std::string AddTexture(TextureSet& textureSet);
  */
 DALI_TOOLKIT_API TextureSet RemoveTexture(const std::string& textureUrl);
 
+/**
+ * @brief Statistics of the texture cache of toolkit.
+ */
+struct CacheStatistics
+{
+  uint32_t hitCount{0u};                ///< The number of loads served by a texture already in the cache, whether it is in use or unused
+  uint32_t missCount{0u};               ///< The number of loads which were not found in the cache
+  uint32_t evictionCount{0u};           ///< The number of unused textures removed because the cache was over the budget
+  uint32_t unusedTextureCount{0u};      ///< The number of unused textures currently kept in the cache
+  uint32_t unusedTextureMemorySize{0u}; ///< The memory size of unused textures currently kept in the cache, in bytes
+};
+
+/**
+ * @brief Set the memory budget of textures which are not used by any visual.
+ * When the last visual stops using an uploaded texture, toolkit keeps the texture while the budget allows,
+ * so the same image can be shown again without decoding and uploading it. Least recently used textures are removed first.
+ * @note The default budget is 0, which removes textures immediately. It can be changed by DALI_TEXTURE_UNUSED_CACHE_BUDGET environment variable.
+ * @param[in] budget The budget in bytes
+ */
+DALI_TOOLKIT_API void SetUnusedTextureCacheBudget(uint32_t budget);
+
+/**
+ * @brief Get the memory budget of textures which are not used by any visual.
+ * @return The budget in bytes
+ */
+DALI_TOOLKIT_API uint32_t GetUnusedTextureCacheBudget();
+
+/**
+ * @brief Get the statistics of the texture cache.
+ * @return The statistics
+ */
+DALI_TOOLKIT_API CacheStatistics GetCacheStatistics();
+
 } // namespace TextureManager
 
 } // namespace Toolkit
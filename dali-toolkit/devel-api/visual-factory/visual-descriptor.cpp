@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit/devel-api/visual-factory/visual-descriptor.h>
+#include <dali-toolkit/internal/visuals/visual-descriptor-impl.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+VisualDescriptor::VisualDescriptor()
+{
+}
+
+VisualDescriptor::~VisualDescriptor()
+{
+}
+
+VisualDescriptor VisualDescriptor::New(const Property::Map& propertyMap)
+{
+  Internal::VisualDescriptorPtr descriptor = Internal::VisualDescriptor::New(propertyMap);
+  return VisualDescriptor(descriptor.Get());
+}
+
+VisualDescriptor VisualDescriptor::DownCast(BaseHandle handle)
+{
+  return VisualDescriptor(dynamic_cast<Dali::Toolkit::Internal::VisualDescriptor*>(handle.GetObjectPtr()));
+}
+
+VisualDescriptor::VisualDescriptor(const VisualDescriptor& handle)
+: BaseHandle(handle)
+{
+}
+
+VisualDescriptor& VisualDescriptor::operator=(const VisualDescriptor& handle)
+{
+  BaseHandle::operator=(handle);
+  return *this;
+}
+
+const Property::Map& VisualDescriptor::GetProperties() const
+{
+  return GetImplementation(*this).GetProperties();
+}
+
+VisualDescriptor::VisualDescriptor(Internal::VisualDescriptor* pointer)
+: BaseHandle(pointer)
+{
+}
+
+} // namespace Toolkit
+
+} // namespace Dali
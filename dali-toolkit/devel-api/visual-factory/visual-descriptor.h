@@ -0,0 +1,112 @@
+#ifndef DALI_TOOLKIT_VISUAL_DESCRIPTOR_H
+#define DALI_TOOLKIT_VISUAL_DESCRIPTOR_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-handle.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+class VisualDescriptor;
+}
+
+/**
+ * @brief A visual property map compiled once, from which the VisualFactory creates many visuals.
+ *
+ * VisualFactory::CreateVisual(const Property::Map&) finds the visual type and the url in the map,
+ * and resolves the location and type of the url, whenever a visual is created. The descriptor does
+ * it once, when it's created, so that creating the same visual again, e.g. for each control of a
+ * style, skips that work. The descriptor also converts the string keys of the properties which
+ * every visual reads, e.g. "mixColor" or "cornerRadius", to their index keys, so that the visuals
+ * created don't match them again. The other properties, e.g. those of a particular visual type,
+ * are still read by each visual when it's created.
+ *
+ * The descriptor keeps a copy of the map; it doesn't change when the original map is changed.
+ * @see VisualFactory::CreateVisual(const VisualDescriptor&)
+ */
+class DALI_TOOLKIT_API VisualDescriptor : public BaseHandle
+{
+public:
+  /**
+   * @brief Create an uninitialized handle.
+   */
+  VisualDescriptor();
+
+  /**
+   * @brief Destructor - non virtual.
+   */
+  ~VisualDescriptor();
+
+  /**
+   * @brief Creates a VisualDescriptor object.
+   *
+   * @param[in] propertyMap The map contains the properties required by the visual, as for VisualFactory::CreateVisual().
+   * @return A handle to an initialized descriptor.
+   */
+  static VisualDescriptor New(const Property::Map& propertyMap);
+
+  /**
+   * @brief Downcast to a VisualDescriptor handle.
+   *
+   * If handle is not a VisualDescriptor, the returned handle is left uninitialized.
+   * @param[in] handle Handle to an object
+   * @return VisualDescriptor handle or an uninitialized handle.
+   */
+  static VisualDescriptor DownCast(BaseHandle handle);
+
+  /**
+   * @brief Copy constructor.
+   *
+   * @param[in] handle Handle to an object
+   */
+  VisualDescriptor(const VisualDescriptor& handle);
+
+  /**
+   * @brief Assignment operator.
+   *
+   * @param[in] handle Handle to an object
+   * @return A reference to this object.
+   */
+  VisualDescriptor& operator=(const VisualDescriptor& handle);
+
+  /**
+   * @brief Get the properties of the visual.
+   *
+   * @return The property map the descriptor was created from, with the string keys of the
+   *  properties which every visual reads converted to index keys.
+   */
+  const Property::Map& GetProperties() const;
+
+public: // Not intended for application developers
+  explicit DALI_INTERNAL VisualDescriptor(Internal::VisualDescriptor* impl);
+};
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_VISUAL_DESCRIPTOR_H
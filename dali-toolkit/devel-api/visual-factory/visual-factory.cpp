@@ -96,6 +96,11 @@ Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyMap)
   return GetImplementation(*this).CreateVisual(propertyMap);
 }
 
+Visual::Base VisualFactory::CreateVisual(const VisualDescriptor& descriptor)
+{
+  return GetImplementation(*this).CreateVisual(descriptor);
+}
+
 Visual::Base VisualFactory::CreateVisual(const std::string& url, ImageDimensions size)
 {
   return GetImplementation(*this).CreateVisual(url, size);
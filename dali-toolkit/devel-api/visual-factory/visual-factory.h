@@ -25,6 +25,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-descriptor.h>
 
 namespace Dali
 {
@@ -98,6 +99,17 @@ public:
    */
   Visual::Base CreateVisual(const Property::Map& propertyMap);
 
+  /**
+   * @brief Request the visual described by a descriptor.
+   *
+   * This is the same as CreateVisual(const Property::Map&) with the map of the descriptor,
+   * without parsing the map again; use it to create the same visual many times.
+   *
+   * @param[in] descriptor The descriptor created from the properties of the visual.
+   * @return The handle to the created visual
+   */
+  Visual::Base CreateVisual(const VisualDescriptor& descriptor);
+
   /**
    * @brief Request the visual to render the given resource at the url.
    *
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_DEVEL_API_VISUALS_IMAGE_VISUAL_ACTIONS_DEVEL_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -35,7 +35,16 @@ namespace Action
  */
 enum Type
 {
-  RELOAD = VISUAL_ACTION_START_INDEX ///< Force reloading of the image, all visuals using this image will get the latest one.
+  RELOAD = VISUAL_ACTION_START_INDEX, ///< Force reloading of the image, all visuals using this image will get the latest one.
+
+  /**
+   * @brief Set the priority of the image load while the visual is on scene.
+   * @details Attributes Type Property::INTEGER. Loads with a higher priority are decoded first. The default is 0.
+   * e.g. a scrolling container can lower the priority of visuals far from the viewport.
+   * @note Loads of visuals which are off scene have the lowest priority,
+   * and are dropped before decoding if the image is released when the visual is off scene.
+   */
+  SET_LOAD_PRIORITY
 };
 
 } // namespace Action
@@ -204,7 +204,7 @@ void Builder::LoadFromString(std::string const& data, Dali::Toolkit::Builder::UI
     if(mParser.Parse(data))
     {
       // Drop the styles and get them to be rebuilt against the new parse tree as required.
-      mStyles.Clear();
+      ClearStyles(true);
     }
     else
     {
@@ -226,11 +226,17 @@ void Builder::LoadFromString(std::string const& data, Dali::Toolkit::Builder::UI
 void Builder::AddConstants(const Property::Map& map)
 {
   mReplacementMap.Merge(map);
+
+  // The recorded styles may use the previous constants.
+  ClearStyles(false);
 }
 
 void Builder::AddConstant(const std::string& key, const Property::Value& value)
 {
   mReplacementMap[key] = value;
+
+  // The recorded styles may use the previous constant.
+  ClearStyles(false);
 }
 
 const Property::Map& Builder::GetConfigurations() const
@@ -307,6 +313,8 @@ BaseHandle Builder::CreateFromJson(const std::string& json)
 
   if(mParser.Parse(newTemplate))
   {
+    ClearStyles(true);
+
     Replacement replacement(mReplacementMap);
     ret = Create("@temp@", replacement);
   }
@@ -326,6 +334,9 @@ bool Builder::ApplyFromJson(Handle& handle, const std::string& json)
 
   if(mParser.Parse(newStyle))
   {
+    // The previous '@temp@' style must not be reused.
+    ClearStyles(true);
+
     Replacement replacement(mReplacementMap);
     ret = ApplyStyle("@temp@", handle, replacement);
   }
@@ -341,16 +352,7 @@ bool Builder::ApplyStyle(const std::string& styleName, Handle& handle)
 
 bool Builder::LookupStyleName(const std::string& styleName)
 {
-  DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
-
-  OptionalChild styles = IsChild(*mParser.GetRoot(), KEYNAME_STYLES);
-  OptionalChild style  = IsChildIgnoreCase(*styles, styleName);
-
-  if(styles && style)
-  {
-    return true;
-  }
-  return false;
+  return NULL != FindStyleNode(styleName);
 }
 
 const StylePtr Builder::GetStyle(const std::string& styleName)
@@ -1091,14 +1093,9 @@ void Builder::SetupTask(RenderTask& task, const TreeNode& node, const Replacemen
 
 bool Builder::ApplyStyle(const std::string& styleName, Handle& handle, const Replacement& replacement)
 {
-  DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
-
-  OptionalChild styles = IsChild(*mParser.GetRoot(), KEYNAME_STYLES);
+  const TreeNode* style = FindStyleNode(styleName);
 
-  std::string   styleNameLower(styleName);
-  OptionalChild style = IsChildIgnoreCase(*styles, styleNameLower);
-
-  if(styles && style)
+  if(style)
   {
     ApplyAllStyleProperties(*mParser.GetRoot(), *style, handle, replacement);
     return true;
@@ -1109,6 +1106,38 @@ bool Builder::ApplyStyle(const std::string& styleName, Handle& handle, const Rep
   }
 }
 
+const TreeNode* Builder::FindStyleNode(const std::string& styleName)
+{
+  DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
+
+  // Every control looks up the style of its type, and of its qualifiers, so the case insensitive
+  // search through all the styles is only done once per name. Unknown names are cached as well.
+  auto iter = mStyleNodes.find(styleName);
+  if(iter == mStyleNodes.end())
+  {
+    const TreeNode* styleNode = NULL;
+    if(OptionalChild styles = IsChild(*mParser.GetRoot(), KEYNAME_STYLES))
+    {
+      if(OptionalChild style = IsChildIgnoreCase(*styles, styleName))
+      {
+        styleNode = &(*style);
+      }
+    }
+    iter = mStyleNodes.emplace(styleName, styleNode).first;
+  }
+  return iter->second;
+}
+
+void Builder::ClearStyles(bool parseTreeChanged)
+{
+  mStyles.Clear();
+  mRecordedStyles.clear();
+  if(parseTreeChanged)
+  {
+    mStyleNodes.clear();
+  }
+}
+
 void Builder::ApplyAllStyleProperties(const TreeNode& root, const TreeNode& node, Dali::Handle& handle, const Replacement& constant)
 {
   const char* styleName = node.GetName();
@@ -1118,8 +1147,13 @@ void Builder::ApplyAllStyleProperties(const TreeNode& root, const TreeNode& node
   StylePtr* matchedStyle = NULL;
   if(styleName)
   {
-    matchedStyle = mStyles.Find(styleName);
-    if(!matchedStyle)
+    // The style is recorded once, with its states and sub-states, then applied to every control using it.
+    auto recordedStyle = mRecordedStyles.find(&node);
+    if(recordedStyle != mRecordedStyles.end())
+    {
+      matchedStyle = &recordedStyle->second;
+    }
+    else
     {
       OptionalChild styleNodes      = IsChild(root, KEYNAME_STYLES);
       OptionalChild inheritFromNode = IsChild(node, KEYNAME_INHERIT);
@@ -1157,7 +1191,8 @@ void Builder::ApplyAllStyleProperties(const TreeNode& root, const TreeNode& node
 
         RecordStyle(style, node, handle, constant);
         mStyles.Add(styleName, style); // shallow copy
-        matchedStyle = &style;
+        mRecordedStyles[&node] = style;
+        matchedStyle           = &style;
       }
     }
   }
@@ -28,6 +28,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/builder/builder.h>
@@ -274,6 +275,20 @@ private:
                   Handle&            handle,
                   const Replacement& replacement);
 
+  /**
+   * Find the node of a style in the parse tree, ignoring the case of the name.
+   * The result is cached until the parse tree changes.
+   * @param[in] styleName The style name to search for
+   * @return The style node, or NULL if there is no such style
+   */
+  const TreeNode* FindStyleNode(const std::string& styleName);
+
+  /**
+   * Drop the recorded styles, so they are recorded again with the current constants.
+   * @param[in] parseTreeChanged Whether the parse tree changed, so the style nodes are searched again
+   */
+  void ClearStyles(bool parseTreeChanged);
+
   void ApplyAllStyleProperties(const TreeNode&    root,
                                const TreeNode&    node,
                                Dali::Handle&      handle,
@@ -382,6 +397,9 @@ private:
   Property::Map                       mConfigurationMap;
   MappingsLut                         mCompleteMappings;
   Dictionary<StylePtr>                mStyles; // State based styles
+
+  std::unordered_map<std::string, const TreeNode*> mStyleNodes;    // Style nodes by requested name, NULL if not found
+  std::unordered_map<const TreeNode*, StylePtr>    mRecordedStyles; // Recorded styles by style node
   Toolkit::Builder::BuilderSignalType mQuitSignal;
 };
 
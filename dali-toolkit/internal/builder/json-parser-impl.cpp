@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/builder/json-parser-state.h>
+#include <dali-toolkit/internal/builder/tree-node-binary.h>
 #include <dali-toolkit/internal/builder/tree-node-manipulator.h>
 
 namespace Dali
@@ -67,65 +68,74 @@ JsonParser::JsonParser(const TreeNode& tree)
   mNumberOfChars(0),
   mNumberOfNodes(0)
 {
-  mRoot = TreeNodeManipulator::Copy(tree, mNumberOfNodes, mNumberOfChars);
-
-  mSources.push_back(VectorChar((sizeof(char) * mNumberOfChars)));
-
-  VectorChar& buffer = mSources.back();
-
-  VectorCharIter start = buffer.begin();
-
-  TreeNodeManipulator modify(mRoot);
-
-  modify.MoveStrings(start, buffer.end());
+  mRoot = TreeNodeManipulator::Copy(tree, mArena, mNumberOfNodes, mNumberOfChars);
 }
 
 JsonParser::~JsonParser()
 {
-  if(mRoot)
-  {
-    TreeNodeManipulator modify(mRoot);
-    modify.RemoveChildren();
-    delete mRoot;
-    mRoot = NULL;
-  }
+  // The nodes and the strings are released with the arena.
 }
 
 bool JsonParser::Parse(const std::string& source)
 {
-  mSources.push_back(VectorChar(source.begin(), source.end()));
+  if(IsBinaryTree(source.data(), source.size()))
+  {
+    return ParseBinary(source);
+  }
+
+  // The source is parsed in place, and the strings of the nodes point into it.
+  char* buffer = mArena.CopyString(source.data(), source.size());
 
-  JsonParserState parserState(mRoot);
+  JsonParserState parserState(mRoot, mArena);
 
-  if(parserState.ParseJson(mSources.back()))
+  if(parserState.ParseJson(buffer, source.size()))
   {
     mRoot = parserState.GetRoot();
 
     mNumberOfChars += parserState.GetParsedStringSize();
     mNumberOfNodes += parserState.GetCreatedNodeCount();
 
-    mErrorDescription = ERROR_DESCRIPTION_NONE;
-    mErrorPosition    = 0;
-    mErrorLine        = 0;
-    mErrorColumn      = 0;
+    SetError(ERROR_DESCRIPTION_NONE, 0, 0, 0);
   }
   else
   {
     mRoot = NULL;
 
-    mErrorDescription = parserState.GetErrorDescription();
-    if(NULL == mErrorDescription)
-    {
-      mErrorDescription = ERROR_DESCRIPTION_NONE;
-    }
-    mErrorPosition = parserState.GetErrorPosition();
-    mErrorLine     = parserState.GetErrorLineNumber();
-    mErrorColumn   = parserState.GetErrorColumn();
+    SetError(parserState.GetErrorDescription(), parserState.GetErrorPosition(), parserState.GetErrorLineNumber(), parserState.GetErrorColumn());
+  }
+
+  return mRoot != NULL;
+}
+
+bool JsonParser::ParseBinary(const std::string& source)
+{
+  // The strings of the nodes point into the copy of the binary tree.
+  char* buffer = mArena.CopyString(source.data(), source.size());
+
+  TreeNode*   root  = mRoot;
+  const char* error = ReadBinaryTree(buffer, source.size(), root, mArena, mNumberOfNodes, mNumberOfChars);
+  if(NULL == error)
+  {
+    mRoot = root;
+    SetError(ERROR_DESCRIPTION_NONE, 0, 0, 0);
+  }
+  else
+  {
+    mRoot = NULL;
+    SetError(error, 0, 0, 0);
   }
 
   return mRoot != NULL;
 }
 
+void JsonParser::SetError(const char* description, int position, int line, int column)
+{
+  mErrorDescription = (NULL == description) ? ERROR_DESCRIPTION_NONE : description;
+  mErrorPosition    = position;
+  mErrorLine        = line;
+  mErrorColumn      = column;
+}
+
 const TreeNode* JsonParser::GetRoot() const
 {
   return mRoot;
@@ -158,17 +168,24 @@ int JsonParser::GetErrorColumn() const
 
 void JsonParser::Pack(void)
 {
-  mSources.push_back(VectorChar((sizeof(char) * mNumberOfChars)));
-
-  VectorChar& buffer = mSources.back();
+  if(mRoot)
+  {
+    // Copy the tree into a single block, without the sources and the nodes replaced by merge operations.
+    // The block also holds the indexes of the children, which the copy builds in the same arena.
+    TreeNodeArena packed(mNumberOfNodes * (sizeof(TreeNode) + alignof(TreeNode)) + mNumberOfChars + TreeNodeManipulator::GetChildIndexesSize(*mRoot));
 
-  VectorCharIter start = buffer.begin();
+    mNumberOfNodes = 0;
+    mNumberOfChars = 0;
+    mRoot          = TreeNodeManipulator::Copy(*mRoot, packed, mNumberOfNodes, mNumberOfChars);
 
-  TreeNodeManipulator modify(mRoot);
-
-  modify.MoveStrings(start, buffer.end());
+    // The previous memory is released with packed.
+    mArena.Swap(packed);
+  }
+}
 
-  mSources.erase(mSources.begin(), --mSources.end());
+std::size_t JsonParser::GetMemorySize() const
+{
+  return mArena.GetCapacity();
 }
 
 void JsonParser::Write(std::ostream& output, int indent) const
@@ -177,6 +194,14 @@ void JsonParser::Write(std::ostream& output, int indent) const
   modify.Write(output, indent);
 }
 
+void JsonParser::WriteBinary(std::ostream& output) const
+{
+  if(mRoot)
+  {
+    WriteBinaryTree(*mRoot, output);
+  }
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
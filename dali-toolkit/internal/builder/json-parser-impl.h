@@ -21,7 +21,6 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/base-object.h>
-#include <list>
 #include <string>
 
 // INTERNAL INCLUDES
@@ -29,6 +28,7 @@
 #include <dali-toolkit/devel-api/builder/tree-node.h>
 
 #include <dali-toolkit/internal/builder/builder-get-is.inl.h>
+#include <dali-toolkit/internal/builder/tree-node-arena.h>
 
 namespace Dali
 {
@@ -96,22 +96,39 @@ public:
    */
   int GetErrorColumn() const;
 
+  /*
+   * Get the size of the memory of the nodes and of their strings
+   * @return The size in bytes of all the blocks of the arena
+   */
+  std::size_t GetMemorySize() const;
+
   /*
    * @copydoc Toolkit::JsonParser::Write()
    */
   void Write(std::ostream& output, int indent) const;
 
-private:
-  typedef std::vector<char>    VectorChar;
-  typedef VectorChar::iterator VectorCharIter;
-
-  typedef std::list<VectorChar>           SourceContainer;
-  typedef std::list<VectorChar>::iterator SourceContainerIter;
+  /*
+   * @copydoc Toolkit::JsonParser::WriteBinary()
+   */
+  void WriteBinary(std::ostream& output) const;
 
+private:
   JsonParser(JsonParser&);
   JsonParser& operator=(const JsonParser&);
 
-  SourceContainer mSources; ///< List of strings from Parse() merge operations
+  /*
+   * Read a binary tree written by WriteBinary(), merging it like Parse()
+   * @param source The binary tree
+   * @return true if read okay
+   */
+  bool ParseBinary(const std::string& source);
+
+  /*
+   * Set the error of the last Parse()
+   */
+  void SetError(const char* description, int position, int line, int column);
+
+  TreeNodeArena mArena; ///< The memory of the nodes and of the strings from Parse() merge operations
 
   TreeNode* mRoot; ///< Tree root
 
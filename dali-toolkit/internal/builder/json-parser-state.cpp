@@ -241,8 +241,11 @@ bool IsNumber(char c)
 
 } // namespace
 
-JsonParserState::JsonParserState(TreeNode* _root)
-: mRoot(_root),
+JsonParserState::JsonParserState(TreeNode* _root, TreeNodeArena& arena)
+: mIter(nullptr),
+  mEnd(nullptr),
+  mArena(arena),
+  mRoot(_root),
   mCurrent(_root),
   mErrorDescription(nullptr),
   mErrorNewLine(0),
@@ -263,7 +266,7 @@ TreeNode* JsonParserState::CreateNewNode(const char* name, TreeNode::NodeType ty
 {
   TreeNode* node = nullptr;
 
-  node = TreeNodeManipulator::NewTreeNode();
+  node = TreeNodeManipulator::NewTreeNode(mArena);
   TreeNodeManipulator modifyNew(node);
   modifyNew.SetType(type);
   modifyNew.SetName(name);
@@ -274,7 +277,7 @@ TreeNode* JsonParserState::CreateNewNode(const char* name, TreeNode::NodeType ty
   }
   else
   {
-    mCurrent.AddChild(node);
+    mCurrent.AddChild(node, mArena);
     mCurrent = modifyNew;
   }
 
@@ -491,7 +494,7 @@ bool JsonParserState::ParseNumber()
 {
   mCurrent.SetType(TreeNode::INTEGER);
 
-  VectorCharIter first = mIter;
+  char*          first = mIter;
   char           c     = Char();
 
   if(!(c == '-' || IsNumber(c)))
@@ -512,7 +515,7 @@ bool JsonParserState::ParseNumber()
   if(mCurrent.GetType() == TreeNode::INTEGER)
   {
     int i = 0;
-    if(StringToInteger(&(*first), &(*mIter), i))
+    if(StringToInteger(first, mIter, i))
     {
       mCurrent.SetInteger(i);
     }
@@ -525,7 +528,7 @@ bool JsonParserState::ParseNumber()
   if(mCurrent.GetType() == TreeNode::FLOAT)
   {
     float f = 0.f;
-    if(StringToFloat(&(*first), &(*mIter), f))
+    if(StringToFloat(first, mIter, f))
     {
       mCurrent.SetFloat(f);
     }
@@ -541,8 +544,8 @@ bool JsonParserState::ParseNumber()
 char* JsonParserState::EncodeString()
 {
   int            substitution = 0;
-  VectorCharIter first        = mIter;
-  VectorCharIter last         = mIter;
+  char*          first        = mIter;
+  char*          last         = mIter;
 
   while(*mIter)
   {
@@ -677,7 +680,7 @@ char* JsonParserState::EncodeString()
   mCurrent.SetSubstitution(substitution > 1);
 
   // return true;
-  return &(*first);
+  return first;
 
 } // ParseString()
 
@@ -847,17 +850,17 @@ bool JsonParserState::HandleValueState(char*& name, const char currentChar, cons
   return handled;
 }
 
-bool JsonParserState::ParseJson(VectorChar& source)
+bool JsonParserState::ParseJson(char* source, size_t length)
 {
   Reset();
 
-  if(0 == source.size())
+  if(0 == length)
   {
     return Error("Empty source buffer to parse");
   }
 
-  mIter = source.begin();
-  mEnd  = source.end();
+  mIter = source;
+  mEnd  = source + length;
 
   char* name          = nullptr;
   char  currentChar   = 0;
@@ -922,7 +925,7 @@ bool JsonParserState::ParseJson(VectorChar& source)
     return Error("Unexpected termination character");
   }
 
-  mIter = source.end();
+  mIter = mEnd;
 
   return true;
 
@@ -1062,7 +1065,7 @@ bool JsonParserState::HandleCharacterLowercaseF(const char* name)
 
 bool JsonParserState::HandleCharacterComma(const char* name)
 {
-  if(0 == mCurrent.Size())
+  if(!mCurrent.HasChildren())
   {
     return Error("Missing Value");
   }
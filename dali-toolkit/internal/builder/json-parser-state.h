@@ -61,16 +61,18 @@ public:
   /**
    * Constructor
    * @param tree Tree to start with, pass NULL if no existing tree
+   * @param arena The arena owning the memory of the new nodes
    */
-  explicit JsonParserState(TreeNode* tree);
+  JsonParserState(TreeNode* tree, TreeNodeArena& arena);
 
   /**
    * Parse json source
-   * The source is modified in place
-   * @param source The vector buffer to parse
+   * The source is modified in place, and must be followed by a null character
+   * @param source The buffer to parse
+   * @param length The number of characters to parse
    * @return true if parsed successfully
    */
-  bool ParseJson(VectorChar& source);
+  bool ParseJson(char* source, size_t length);
 
   /**
    * Get the root node
@@ -133,9 +135,9 @@ public:
   };
 
 private:
-  VectorCharIter      mIter;                 ///< Current position
-  VectorCharIter      mStart;                ///< Start position
-  VectorCharIter      mEnd;                  ///< End of buffer being parsed
+  char*               mIter;                 ///< Current position
+  char*               mEnd;                  ///< End of buffer being parsed
+  TreeNodeArena&      mArena;                ///< The arena of the new nodes
   TreeNode*           mRoot;                 ///< Root node created
   TreeNodeManipulator mCurrent;              ///< The Current modifiable node
   const char*         mErrorDescription;     ///< The error description if set
@@ -263,9 +265,6 @@ private:
    */
   inline bool AtLeast(int n)
   {
-    // The standard suggests vector.end() can be decremented as
-    //   iter v.back() { *--v.end() }
-    // (ISO/IEC 14882:2003 C++ Standard 23.1.1/12 – Sequences)
     return (mEnd - mIter) > n;
   }
 
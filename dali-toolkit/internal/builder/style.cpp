@@ -97,9 +97,9 @@ void Style::ApplyVisuals(
 {
   for(Dictionary<Property::Map>::iterator iter = visualMaps.Begin(); iter != visualMaps.End(); ++iter)
   {
-    const std::string& visualName   = (*iter).key;
-    Property::Map      map          = (*iter).entry;
-    Property::Map*     instancedMap = instancedProperties.Find(visualName);
+    const std::string&   visualName   = (*iter).key;
+    const Property::Map& map          = (*iter).entry;
+    Property::Map*       instancedMap = instancedProperties.Find(visualName);
     ApplyVisual(handle, visualName, map, instancedMap);
   }
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/builder/tree-node-arena.h>
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+TreeNodeArena::TreeNodeArena(std::size_t blockSize)
+: mBlocks(),
+  mCurrent(nullptr),
+  mEnd(nullptr),
+  mBlockSize(blockSize > 0u ? blockSize : DEFAULT_BLOCK_SIZE),
+  mCapacity(0u)
+{
+}
+
+TreeNodeArena::~TreeNodeArena() = default;
+
+void* TreeNodeArena::Allocate(std::size_t size, std::size_t alignment)
+{
+  DALI_ASSERT_DEBUG(alignment > 0u && (alignment & (alignment - 1u)) == 0u && alignment <= alignof(std::max_align_t));
+
+  const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mCurrent);
+  const std::size_t    padding = static_cast<std::size_t>(-address & (alignment - 1u));
+
+  if(mCurrent && static_cast<std::size_t>(mEnd - mCurrent) >= size + padding)
+  {
+    char* memory = mCurrent + padding;
+    mCurrent     = memory + size;
+    return memory;
+  }
+
+  if(size > mBlockSize / 4u)
+  {
+    // A large allocation (e.g. a json source) gets its own block, so the free space of the current block is kept.
+    // The blocks are aligned for any type.
+    return AllocateBlock(size);
+  }
+
+  char* block = AllocateBlock(mBlockSize);
+  mCurrent    = block + size;
+  mEnd        = block + mBlockSize;
+
+  // A large first block is sized for its contents (e.g. a packed tree); what overflows it gets the default size.
+  mBlockSize = std::min(mBlockSize, DEFAULT_BLOCK_SIZE);
+  return block;
+}
+
+char* TreeNodeArena::CopyString(const char* string, std::size_t length)
+{
+  char* copy = static_cast<char*>(Allocate(length + 1u, alignof(char)));
+  if(length > 0u)
+  {
+    std::memcpy(copy, string, length);
+  }
+  copy[length] = 0;
+  return copy;
+}
+
+char* TreeNodeArena::CopyString(const char* string)
+{
+  DALI_ASSERT_DEBUG(string);
+  return CopyString(string, std::strlen(string));
+}
+
+void TreeNodeArena::Swap(TreeNodeArena& arena)
+{
+  mBlocks.swap(arena.mBlocks);
+  std::swap(mCurrent, arena.mCurrent);
+  std::swap(mEnd, arena.mEnd);
+  std::swap(mCapacity, arena.mCapacity);
+}
+
+std::size_t TreeNodeArena::GetCapacity() const
+{
+  return mCapacity;
+}
+
+char* TreeNodeArena::AllocateBlock(std::size_t size)
+{
+  mBlocks.emplace_back(new char[size]);
+  mCapacity += size;
+  return mBlocks.back().get();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,123 @@
+#ifndef DALI_SCRIPT_TREE_NODE_ARENA_H
+#define DALI_SCRIPT_TREE_NODE_ARENA_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/*
+ * TreeNodeArena owns the memory of the TreeNodes of a JsonParser and of their strings.
+ *
+ * The memory is allocated from large blocks by bumping a pointer, and all the blocks are
+ * released in one step when the arena is destroyed. Nothing is freed before that: the memory of
+ * the nodes removed from the tree is only reclaimed with the arena.
+ *
+ * No destructor is called on the objects allocated in the arena, so only trivially destructible
+ * data (as the TreeNode) can be stored.
+ */
+class TreeNodeArena
+{
+public:
+  /*
+   * Constructor
+   * @param blockSize The size of the first memory block, allocated when first needed. The later blocks
+   *                  are at most DEFAULT_BLOCK_SIZE, so that a first block sized for its contents isn't repeated.
+   */
+  explicit TreeNodeArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+  /*
+   * Destructor, releases all the blocks.
+   */
+  ~TreeNodeArena();
+
+  /*
+   * Allocate uninitialised memory
+   * @param size The number of bytes
+   * @param alignment The alignment of the memory, at most alignof(std::max_align_t)
+   * @return The allocated memory
+   */
+  void* Allocate(std::size_t size, std::size_t alignment);
+
+  /*
+   * Copy a string into the arena
+   * @param string The characters to copy
+   * @param length The number of characters
+   * @return The null terminated copy of the string
+   */
+  char* CopyString(const char* string, std::size_t length);
+
+  /*
+   * Copy a null terminated string into the arena
+   * @param string The string to copy
+   * @return The copy of the string
+   */
+  char* CopyString(const char* string);
+
+  /*
+   * Exchange the memory of two arenas
+   * The size of the next blocks isn't exchanged, so an arena with a large first block doesn't pass its size on.
+   * @param arena The arena to swap with
+   */
+  void Swap(TreeNodeArena& arena);
+
+  /*
+   * Get the size of all the allocated blocks
+   * @return The size in bytes
+   */
+  std::size_t GetCapacity() const;
+
+  static constexpr std::size_t DEFAULT_BLOCK_SIZE = 16384u; ///< The default size of a memory block
+
+private:
+  /*
+   * Allocate a new block of at least the given size
+   * @param size The size needed
+   * @return The start of the block
+   */
+  char* AllocateBlock(std::size_t size);
+
+  // Undefined
+  TreeNodeArena(const TreeNodeArena&) = delete;
+
+  // Undefined
+  TreeNodeArena& operator=(const TreeNodeArena&) = delete;
+
+private:
+  std::vector<std::unique_ptr<char[]>> mBlocks;    ///< The memory blocks
+  char*                                mCurrent;   ///< The next free byte of the current block
+  char*                                mEnd;       ///< The end of the current block
+  std::size_t                          mBlockSize; ///< The size of the next block
+  std::size_t                          mCapacity;  ///< The size of all the blocks
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_SCRIPT_TREE_NODE_ARENA_H
@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/builder/tree-node-binary.h>
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/builder/tree-node-manipulator.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+const char     BINARY_TREE_MAGIC[4]      = {'\0', 'D', 'T', 'B'};
+const uint32_t BINARY_TREE_VERSION       = 1u;
+const uint32_t BINARY_TREE_BYTE_ORDER    = 0x01020304u;
+const uint32_t BINARY_TREE_NO_STRING     = 0xFFFFFFFFu;
+const uint8_t  BINARY_TREE_LAST_TYPE     = static_cast<uint8_t>(TreeNode::BOOLEAN);
+const char     ERROR_BAD_HEADER[]        = "Binary tree with an unsupported version or byte order";
+const char     ERROR_BAD_SIZE[]          = "Binary tree size doesn't match its header";
+const char     ERROR_BAD_NODE[]          = "Binary tree node with a bad type or string";
+const char     ERROR_BAD_STRUCTURE[]     = "Binary tree nodes don't form a single tree";
+const char     ERROR_UNTERMINATED_DATA[] = "Binary tree strings are not null terminated";
+
+/*
+ * The header of the binary tree
+ */
+struct BinaryTreeHeader
+{
+  char     magic[4];      ///< BINARY_TREE_MAGIC
+  uint32_t version;       ///< BINARY_TREE_VERSION
+  uint32_t byteOrderMark; ///< BINARY_TREE_BYTE_ORDER in the byte order of the writer
+  uint32_t numberOfNodes; ///< The number of node records
+  uint32_t stringsSize;   ///< The size of the strings
+};
+
+/*
+ * The record of a node
+ */
+struct BinaryTreeNode
+{
+  uint32_t name;             ///< The offset of the name in the strings, or BINARY_TREE_NO_STRING
+  uint32_t value;            ///< The offset of the string value, the integer, the bits of the float or the boolean
+  uint32_t numberOfChildren; ///< The number of children, which follow the node
+  uint8_t  type;             ///< The TreeNode::NodeType
+  uint8_t  substitution;     ///< The string substitution flag
+  uint8_t  padding[2];       ///< Unused, zero
+};
+
+/*
+ * Builds the records and the strings of a tree
+ */
+class BinaryTreeWriter
+{
+public:
+  void AddNode(const TreeNode& node)
+  {
+    BinaryTreeNode record = {};
+    record.name           = AddString(node.GetName());
+    record.type           = static_cast<uint8_t>(node.GetType());
+
+    switch(node.GetType())
+    {
+      case TreeNode::STRING:
+      {
+        record.value        = AddString(node.GetString());
+        record.substitution = node.HasSubstitution() ? 1u : 0u;
+        break;
+      }
+      case TreeNode::INTEGER:
+      {
+        const int value = node.GetInteger();
+        std::memcpy(&record.value, &value, sizeof(record.value));
+        break;
+      }
+      case TreeNode::FLOAT:
+      {
+        const float value = node.GetFloat();
+        std::memcpy(&record.value, &value, sizeof(record.value));
+        break;
+      }
+      case TreeNode::BOOLEAN:
+      {
+        record.value = node.GetBoolean() ? 1u : 0u;
+        break;
+      }
+      case TreeNode::IS_NULL:
+      case TreeNode::OBJECT:
+      case TreeNode::ARRAY:
+      {
+        break;
+      }
+    }
+
+    const size_t index = mNodes.size();
+    mNodes.push_back(record);
+
+    uint32_t numberOfChildren = 0u;
+    for(TreeNode::ConstIterator iter = node.CBegin(); iter != node.CEnd(); ++iter)
+    {
+      AddNode((*iter).second);
+      ++numberOfChildren;
+    }
+    mNodes[index].numberOfChildren = numberOfChildren;
+  }
+
+  void Write(std::ostream& output) const
+  {
+    BinaryTreeHeader header;
+    std::memcpy(header.magic, BINARY_TREE_MAGIC, sizeof(header.magic));
+    header.version       = BINARY_TREE_VERSION;
+    header.byteOrderMark = BINARY_TREE_BYTE_ORDER;
+    header.numberOfNodes = static_cast<uint32_t>(mNodes.size());
+    header.stringsSize   = static_cast<uint32_t>(mStrings.size());
+
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char*>(mNodes.data()), mNodes.size() * sizeof(BinaryTreeNode));
+    output.write(mStrings.data(), mStrings.size());
+  }
+
+private:
+  uint32_t AddString(const char* string)
+  {
+    if(!string)
+    {
+      return BINARY_TREE_NO_STRING;
+    }
+
+    // The strings are interned, e.g. the property names repeated in every style are stored once.
+    auto result = mStringOffsets.emplace(std::string_view(string), static_cast<uint32_t>(mStrings.size()));
+    if(result.second)
+    {
+      mStrings.append(string);
+      mStrings.push_back('\0');
+    }
+    return result.first->second;
+  }
+
+  std::vector<BinaryTreeNode>                    mNodes;         ///< The node records in depth first order
+  std::string                                    mStrings;       ///< The null terminated strings
+  std::unordered_map<std::string_view, uint32_t> mStringOffsets; ///< The offset of each string, the views point to the tree strings
+};
+
+/*
+ * Merges the records of a validated binary tree into a tree
+ */
+class BinaryTreeReader
+{
+public:
+  BinaryTreeReader(const char* nodes, const char* strings, TreeNodeArena& arena, int& numberOfNodes, int& numberOfChars)
+  : mNodes(nodes),
+    mStrings(strings),
+    mArena(arena),
+    mNumberOfNodes(numberOfNodes),
+    mNumberOfChars(numberOfChars),
+    mNext(0u)
+  {
+  }
+
+  /*
+   * Read the next node and its children. The nodes are found and modified like NewNode() of a merging json parse.
+   */
+  void ReadNode(TreeNode* parent, TreeNode*& root)
+  {
+    BinaryTreeNode record;
+    std::memcpy(&record, mNodes + sizeof(BinaryTreeNode) * mNext++, sizeof(record));
+
+    const char*              name = GetString(record.name);
+    const TreeNode::NodeType type = static_cast<TreeNode::NodeType>(record.type);
+
+    TreeNode* node = NULL;
+    if(NULL == parent)
+    {
+      node = root;
+    }
+    else if(name)
+    {
+      node = const_cast<TreeNode*>(parent->GetChild(name));
+    }
+
+    if(node)
+    {
+      TreeNodeManipulator modify(node);
+      modify.SetName(name);
+      modify.SetType(type);
+    }
+    else
+    {
+      node = TreeNodeManipulator::NewTreeNode(mArena);
+      TreeNodeManipulator modify(node);
+      modify.SetType(type);
+      modify.SetName(name);
+      if(parent)
+      {
+        TreeNodeManipulator(parent).AddChild(node, mArena);
+      }
+      else
+      {
+        root = node;
+      }
+      ++mNumberOfNodes;
+    }
+
+    TreeNodeManipulator modify(node);
+    switch(type)
+    {
+      case TreeNode::STRING:
+      {
+        const char* string = GetString(record.value);
+        modify.SetString(string);
+        modify.SetSubstitution(record.substitution != 0u);
+        mNumberOfChars += std::strlen(string) + 1;
+        break;
+      }
+      case TreeNode::INTEGER:
+      {
+        int value;
+        std::memcpy(&value, &record.value, sizeof(value));
+        modify.SetInteger(value);
+        break;
+      }
+      case TreeNode::FLOAT:
+      {
+        float value;
+        std::memcpy(&value, &record.value, sizeof(value));
+        modify.SetFloat(value);
+        break;
+      }
+      case TreeNode::BOOLEAN:
+      {
+        modify.SetBoolean(record.value != 0u);
+        break;
+      }
+      case TreeNode::IS_NULL:
+      case TreeNode::OBJECT:
+      case TreeNode::ARRAY:
+      {
+        break;
+      }
+    }
+
+    if(name)
+    {
+      mNumberOfChars += std::strlen(name) + 1;
+    }
+
+    for(uint32_t child = 0u; child < record.numberOfChildren; ++child)
+    {
+      ReadNode(node, root);
+    }
+  }
+
+private:
+  const char* GetString(uint32_t offset) const
+  {
+    return (BINARY_TREE_NO_STRING == offset) ? NULL : mStrings + offset;
+  }
+
+  const char*    mNodes;         ///< The node records
+  const char*    mStrings;       ///< The strings
+  TreeNodeArena& mArena;         ///< The arena of the new nodes
+  int&           mNumberOfNodes; ///< The number of created nodes
+  int&           mNumberOfChars; ///< The size of the string data
+  uint32_t       mNext;          ///< The index of the next record
+};
+
+/*
+ * Check the records before modifying the tree, so a bad binary tree never leaves a partially merged tree
+ */
+const char* Validate(const BinaryTreeHeader& header, const char* nodes, const char* strings)
+{
+  if(header.stringsSize > 0u && strings[header.stringsSize - 1u] != '\0')
+  {
+    return ERROR_UNTERMINATED_DATA;
+  }
+
+  // The number of nodes still expected by their parents.
+  uint64_t expected = 1u;
+  for(uint32_t index = 0u; index < header.numberOfNodes; ++index)
+  {
+    BinaryTreeNode record;
+    std::memcpy(&record, nodes + sizeof(BinaryTreeNode) * index, sizeof(record));
+
+    const bool badName   = record.name != BINARY_TREE_NO_STRING && record.name >= header.stringsSize;
+    const bool badString = record.type == TreeNode::STRING && record.value >= header.stringsSize;
+    if(record.type > BINARY_TREE_LAST_TYPE || badName || badString)
+    {
+      return ERROR_BAD_NODE;
+    }
+
+    if(0u == expected)
+    {
+      return ERROR_BAD_STRUCTURE;
+    }
+    expected = expected - 1u + record.numberOfChildren;
+  }
+
+  return (0u == expected) ? NULL : ERROR_BAD_STRUCTURE;
+}
+
+} // namespace
+
+bool IsBinaryTree(const char* data, std::size_t size)
+{
+  return size >= sizeof(BINARY_TREE_MAGIC) && 0 == std::memcmp(data, BINARY_TREE_MAGIC, sizeof(BINARY_TREE_MAGIC));
+}
+
+void WriteBinaryTree(const TreeNode& root, std::ostream& output)
+{
+  BinaryTreeWriter writer;
+  writer.AddNode(root);
+  writer.Write(output);
+}
+
+const char* ReadBinaryTree(const char* data, std::size_t size, TreeNode*& root, TreeNodeArena& arena, int& numberOfNodes, int& numberOfChars)
+{
+  BinaryTreeHeader header;
+  if(size < sizeof(header))
+  {
+    return ERROR_BAD_SIZE;
+  }
+  std::memcpy(&header, data, sizeof(header));
+
+  if(!IsBinaryTree(data, size) || header.version != BINARY_TREE_VERSION || header.byteOrderMark != BINARY_TREE_BYTE_ORDER)
+  {
+    return ERROR_BAD_HEADER;
+  }
+
+  if(size != sizeof(header) + sizeof(BinaryTreeNode) * static_cast<uint64_t>(header.numberOfNodes) + header.stringsSize)
+  {
+    return ERROR_BAD_SIZE;
+  }
+
+  const char* nodes   = data + sizeof(header);
+  const char* strings = nodes + sizeof(BinaryTreeNode) * header.numberOfNodes;
+
+  if(const char* error = Validate(header, nodes, strings))
+  {
+    return error;
+  }
+
+  BinaryTreeReader reader(nodes, strings, arena, numberOfNodes, numberOfChars);
+  reader.ReadNode(NULL, root);
+
+  return NULL;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
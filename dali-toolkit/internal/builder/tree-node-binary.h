@@ -0,0 +1,83 @@
+#ifndef DALI_SCRIPT_TREE_NODE_BINARY_H
+#define DALI_SCRIPT_TREE_NODE_BINARY_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <ostream>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/builder/tree-node.h>
+#include <dali-toolkit/internal/builder/tree-node-arena.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/*
+ * The binary format of a TreeNode tree, a precompiled json source which is loaded without parsing.
+ *
+ * The format is made of:
+ *  - a header with the magic bytes, the format version, a byte order mark and the number of nodes and
+ *    the size of the strings,
+ *  - the nodes in depth first order, each one followed by its children. A node is a fixed size record
+ *    with its type, its name, its value and its number of children,
+ *  - the strings, null terminated, each distinct string stored once.
+ *
+ * The data is in the byte order of the machine which wrote it. The magic bytes start with a null
+ * character, so the format is never mistaken for a json source.
+ */
+
+/*
+ * Check whether the data is a binary tree
+ * @param data The data
+ * @param size The size of the data
+ * @return true if the data starts with the binary tree magic bytes
+ */
+bool IsBinaryTree(const char* data, std::size_t size);
+
+/*
+ * Write the tree in the binary format
+ * @param root The root of the tree
+ * @param output The stream to write to
+ */
+void WriteBinaryTree(const TreeNode& root, std::ostream& output);
+
+/*
+ * Read a binary tree, and merge it into the given tree with the same rules as a merging json parse.
+ * The data is validated before the tree is modified.
+ * @param data The binary tree. The strings of the nodes point into it, so it must be kept with the tree.
+ * @param size The size of the data
+ * @param root The tree to merge into, NULL to create a new tree. Set to the root of the tree.
+ * @param arena The arena owning the memory of the new nodes
+ * @param numberOfNodes Incremented by the number of created nodes
+ * @param numberOfChars Incremented by the size of the string data
+ * @return NULL if the tree was read, else the error description
+ */
+const char* ReadBinaryTree(const char* data, std::size_t size, TreeNode*& root, TreeNodeArena& arena, int& numberOfNodes, int& numberOfChars);
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_SCRIPT_TREE_NODE_BINARY_H
@@ -16,7 +16,10 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstring>
+#include <functional>
+#include <new>
 #include <sstream>
 
 // INTERNAL INCLUDES
@@ -32,6 +35,84 @@ namespace Internal
 {
 namespace
 {
+const uint32_t CHILD_INDEX_THRESHOLD      = 16u; ///< The number of children from which the children are indexed
+const uint32_t CHILD_INDEX_MINIMUM_SLOTS  = 64u; ///< The minimum number of slots of an index
+const uint32_t CHILD_INDEX_SLOTS_PER_NODE = 4u;  ///< The number of slots per child when an index is built
+
+inline uint32_t GetFirstSlot(std::string_view name, uint32_t capacity)
+{
+  return static_cast<uint32_t>(std::hash<std::string_view>()(name)) & (capacity - 1u);
+}
+
+/*
+ * Insert the child into the index, unless a previous child has the same name
+ */
+void InsertChild(TreeNodeChildIndex& index, TreeNode* child)
+{
+  const std::string_view name(child->GetName());
+
+  for(uint32_t slot = GetFirstSlot(name, index.capacity);; slot = (slot + 1u) & (index.capacity - 1u))
+  {
+    TreeNode*& entry = index.slots[slot];
+    if(NULL == entry)
+    {
+      entry = child;
+      ++index.count;
+      return;
+    }
+    if(name == entry->GetName())
+    {
+      return;
+    }
+  }
+}
+
+/*
+ * Whether the node has at least the given number of children
+ */
+bool HasAtLeastChildren(const TreeNode* node, uint32_t numberOfChildren)
+{
+  uint32_t count = 0u;
+  for(TreeNode::ConstIterator iter = node->CBegin(); iter != node->CEnd() && count < numberOfChildren; ++iter)
+  {
+    ++count;
+  }
+  return count == numberOfChildren;
+}
+
+/*
+ * Whether Copy() indexes the children of the node
+ */
+bool IsChildIndexCopied(const TreeNode* node)
+{
+  if(!HasAtLeastChildren(node, CHILD_INDEX_THRESHOLD))
+  {
+    return false;
+  }
+
+  for(TreeNode::ConstIterator iter = node->CBegin(); iter != node->CEnd(); ++iter)
+  {
+    if((*iter).first)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * The number of slots of an index built for the given number of children
+ */
+uint32_t GetChildIndexCapacity(uint32_t numberOfChildren)
+{
+  uint32_t capacity = CHILD_INDEX_MINIMUM_SLOTS;
+  while(capacity < numberOfChildren * CHILD_INDEX_SLOTS_PER_NODE)
+  {
+    capacity *= 2u;
+  }
+  return capacity;
+}
+
 void Indent(std::ostream& o, int level, int indentWidth)
 {
   for(int i = 0; i < level * indentWidth; ++i)
@@ -68,9 +149,10 @@ TreeNodeManipulator::TreeNodeManipulator(TreeNode* node)
 {
 }
 
-TreeNode* TreeNodeManipulator::NewTreeNode()
+TreeNode* TreeNodeManipulator::NewTreeNode(TreeNodeArena& arena)
 {
-  return new TreeNode();
+  // The TreeNode destructor does nothing, so the nodes are never destroyed and only released with the arena.
+  return new(arena.Allocate(sizeof(TreeNode), alignof(TreeNode))) TreeNode();
 }
 
 void TreeNodeManipulator::ShallowCopy(const TreeNode* from, TreeNode* to)
@@ -115,93 +197,67 @@ void TreeNodeManipulator::ShallowCopy(const TreeNode* from, TreeNode* to)
   }
 }
 
-void TreeNodeManipulator::MoveNodeStrings(VectorCharIter& start, const VectorCharIter& sentinel)
+void TreeNodeManipulator::RemoveChildren()
 {
   DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
-  if(mNode->mName)
-  {
-    mNode->mName = CopyString(mNode->mName, start, sentinel);
-  }
 
-  if(TreeNode::STRING == mNode->mType)
-  {
-    mNode->mStringValue = CopyString(mNode->mStringValue, start, sentinel);
-  }
-}
-
-void TreeNodeManipulator::MoveStrings(VectorCharIter& start, const VectorCharIter& sentinel)
-{
-  DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
-  TreeNodeManipulator modify(mNode);
-  modify.MoveNodeStrings(start, sentinel);
-  RecurseMoveChildStrings(start, sentinel);
+  mNode->mChildIndex = NULL;
+  mNode->mFirstChild = NULL;
+  mNode->mLastChild  = NULL;
 }
 
-void TreeNodeManipulator::RecurseMoveChildStrings(VectorCharIter& start, const VectorCharIter& sentinel)
+TreeNode* TreeNodeManipulator::Copy(const TreeNode& tree, TreeNodeArena& arena, int& numberNodes, int& numberChars)
 {
-  DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
+  TreeNode* root = NewTreeNode(arena);
 
-  TreeNode* child = mNode->mFirstChild;
-  while(child)
-  {
-    TreeNodeManipulator manipChild(child);
-    manipChild.MoveNodeStrings(start, sentinel);
-    child = child->mNextSibling;
-  }
+  ShallowCopy(&tree, root);
 
-  child = mNode->mFirstChild;
-  while(child)
-  {
-    TreeNodeManipulator manipChild(child);
-    manipChild.RecurseMoveChildStrings(start, sentinel);
-    child = child->mNextSibling;
-  }
-}
+  CopyNodeStrings(root, arena, numberChars);
 
-void TreeNodeManipulator::RemoveChildren()
-{
-  DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
+  ++numberNodes;
 
-  CollectNodes collector;
+  CopyChildren(&tree, root, arena, numberNodes, numberChars);
 
-  DepthFirst(mNode, collector);
+  return root;
+}
 
-  for(CollectNodes::iterator iter = collector.nodes.begin(); iter != collector.nodes.end(); ++iter)
+std::size_t TreeNodeManipulator::GetChildIndexesSize(const TreeNode& tree)
+{
+  std::size_t size = 0u;
+  if(IsChildIndexCopied(&tree))
   {
-    if(*iter != mNode)
-    {
-      delete *iter;
-    }
+    // Including the padding for the alignment of the index and of its slots.
+    const uint32_t capacity = GetChildIndexCapacity(static_cast<uint32_t>(tree.Size()));
+    size += sizeof(TreeNodeChildIndex) + alignof(TreeNodeChildIndex) + sizeof(TreeNode*) * capacity + alignof(TreeNode*);
   }
 
-  mNode->mFirstChild = NULL;
-  mNode->mLastChild  = NULL;
+  for(TreeNode::ConstIterator iter = tree.CBegin(); iter != tree.CEnd(); ++iter)
+  {
+    size += GetChildIndexesSize((*iter).second);
+  }
+  return size;
 }
 
-TreeNode* TreeNodeManipulator::Copy(const TreeNode& tree, int& numberNodes, int& numberChars)
+void TreeNodeManipulator::CopyNodeStrings(TreeNode* node, TreeNodeArena& arena, int& numberChars)
 {
-  TreeNode* root = NewTreeNode();
+  DALI_ASSERT_DEBUG(node && "Operation on NULL JSON node");
 
-  ShallowCopy(&tree, root);
-
-  if(tree.mName)
+  if(node->mName)
   {
-    numberChars += std::strlen(tree.mName) + 1;
+    const size_t length = std::strlen(node->mName);
+    node->mName         = arena.CopyString(node->mName, length);
+    numberChars += length + 1;
   }
 
-  if(TreeNode::STRING == tree.mType)
+  if(TreeNode::STRING == node->mType)
   {
-    numberChars += std::strlen(tree.mStringValue) + 1;
+    const size_t length = std::strlen(node->mStringValue);
+    node->mStringValue  = arena.CopyString(node->mStringValue, length);
+    numberChars += length + 1;
   }
-
-  ++numberNodes;
-
-  CopyChildren(&tree, root, numberNodes, numberChars);
-
-  return root;
 }
 
-void TreeNodeManipulator::CopyChildren(const TreeNode* from, TreeNode* to, int& numberNodes, int& numberChars)
+void TreeNodeManipulator::CopyChildren(const TreeNode* from, TreeNode* to, TreeNodeArena& arena, int& numberNodes, int& numberChars)
 {
   DALI_ASSERT_DEBUG(from && "Operation on NULL JSON node");
   DALI_ASSERT_DEBUG(to);
@@ -209,31 +265,30 @@ void TreeNodeManipulator::CopyChildren(const TreeNode* from, TreeNode* to, int&
   for(TreeNode::ConstIterator iter = from->CBegin(); iter != from->CEnd(); ++iter)
   {
     const TreeNode* child = &((*iter).second);
-    if(child->mName)
-    {
-      numberChars += std::strlen(child->mName) + 1;
-    }
 
-    if(TreeNode::STRING == child->mType)
-    {
-      numberChars += std::strlen(child->mStringValue) + 1;
-    }
-
-    TreeNode* newNode = NewTreeNode();
+    TreeNode* newNode = NewTreeNode(arena);
 
     ShallowCopy(child, newNode);
 
+    CopyNodeStrings(newNode, arena, numberChars);
+
     TreeNodeManipulator modify(to);
 
-    modify.AddChild(newNode);
+    modify.LinkChild(newNode);
 
     ++numberNodes;
 
-    CopyChildren(child, newNode, numberNodes, numberChars);
+    CopyChildren(child, newNode, arena, numberNodes, numberChars);
+  }
+
+  // Index the children once they're all copied, rather than growing the index while adding them.
+  if(IsChildIndexCopied(to))
+  {
+    BuildChildIndex(to, arena);
   }
 }
 
-TreeNode* TreeNodeManipulator::AddChild(TreeNode* rhs)
+void TreeNodeManipulator::LinkChild(TreeNode* rhs)
 {
   DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
 
@@ -246,9 +301,56 @@ TreeNode* TreeNodeManipulator::AddChild(TreeNode* rhs)
   {
     mNode->mFirstChild = mNode->mLastChild = rhs;
   }
+}
+
+TreeNode* TreeNodeManipulator::AddChild(TreeNode* rhs, TreeNodeArena& arena)
+{
+  LinkChild(rhs);
+
+  if(rhs->mName)
+  {
+    TreeNodeChildIndex* index = mNode->mChildIndex;
+    if(index)
+    {
+      InsertChild(*index, rhs);
+
+      // Keep the index at most half full. The previous table is released with the arena.
+      if(index->count * 2u > index->capacity)
+      {
+        BuildChildIndex(mNode, arena);
+      }
+    }
+    else if(HasAtLeastChildren(mNode, CHILD_INDEX_THRESHOLD))
+    {
+      BuildChildIndex(mNode, arena);
+    }
+  }
   return rhs;
 }
 
+void TreeNodeManipulator::BuildChildIndex(TreeNode* node, TreeNodeArena& arena)
+{
+  DALI_ASSERT_DEBUG(node && "Operation on NULL JSON node");
+
+  const uint32_t capacity = GetChildIndexCapacity(static_cast<uint32_t>(node->Size()));
+
+  TreeNodeChildIndex* index = static_cast<TreeNodeChildIndex*>(arena.Allocate(sizeof(TreeNodeChildIndex), alignof(TreeNodeChildIndex)));
+  index->slots              = static_cast<TreeNode**>(arena.Allocate(sizeof(TreeNode*) * capacity, alignof(TreeNode*)));
+  index->capacity           = capacity;
+  index->count              = 0u;
+  std::fill(index->slots, index->slots + capacity, static_cast<TreeNode*>(NULL));
+
+  for(TreeNode* child = node->mFirstChild; child; child = child->mNextSibling)
+  {
+    if(child->mName)
+    {
+      InsertChild(*index, child);
+    }
+  }
+
+  node->mChildIndex = index;
+}
+
 TreeNode::NodeType TreeNodeManipulator::GetType() const
 {
   DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
@@ -263,6 +365,13 @@ size_t TreeNodeManipulator::Size() const
   return mNode->Size();
 }
 
+bool TreeNodeManipulator::HasChildren() const
+{
+  DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
+
+  return NULL != mNode->mFirstChild;
+}
+
 void TreeNodeManipulator::SetType(TreeNode::NodeType type)
 {
   DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
@@ -304,6 +413,14 @@ void TreeNodeManipulator::SetType(TreeNode::NodeType type)
 void TreeNodeManipulator::SetName(const char* name)
 {
   DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
+
+  // Renaming an indexed child invalidates the index of its parent, the children are then searched without index.
+  TreeNode* parent = mNode->mParent;
+  if(parent && parent->mChildIndex && (!name || !mNode->mName || std::strcmp(name, mNode->mName) != 0))
+  {
+    parent->mChildIndex = NULL;
+  }
+
   mNode->mName = name;
 }
 
@@ -319,7 +436,7 @@ TreeNode* TreeNodeManipulator::GetParent() const
   return NULL == mNode ? NULL : mNode->mParent;
 }
 
-const TreeNode* TreeNodeManipulator::GetChild(const std::string& name) const
+const TreeNode* TreeNodeManipulator::GetChild(std::string_view name) const
 {
   DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
   return NULL == mNode ? NULL : mNode->GetChild(name);
@@ -544,6 +661,18 @@ void TreeNodeManipulator::DoWrite(const TreeNode* value, std::ostream& output, i
   } // switch
 } // DoWrite
 
+const TreeNode* TreeNodeChildIndex::Find(std::string_view name) const
+{
+  for(uint32_t slot = GetFirstSlot(name, capacity);; slot = (slot + 1u) & (capacity - 1u))
+  {
+    const TreeNode* entry = slots[slot];
+    if(NULL == entry || name == entry->GetName())
+    {
+      return entry;
+    }
+  }
+}
+
 const TreeNode* FindIt(std::string_view childName, const TreeNode* node)
 {
   DALI_ASSERT_DEBUG(node);
@@ -570,27 +699,6 @@ const TreeNode* FindIt(std::string_view childName, const TreeNode* node)
   return found;
 }
 
-char* CopyString(const char* fromString, VectorCharIter& iter, const VectorCharIter& sentinel)
-{
-  DALI_ASSERT_DEBUG(fromString);
-  DALI_ASSERT_DEBUG(iter != sentinel);
-
-  char*       start = &(*iter);
-  const char* ptr   = fromString;
-
-  if(ptr)
-  {
-    while(*ptr != 0)
-    {
-      DALI_ASSERT_DEBUG(iter != sentinel);
-      *iter++ = *ptr++;
-    }
-
-    *iter++ = 0;
-  }
-  return start;
-}
-
 } // namespace Internal
 
 } // namespace Toolkit
@@ -19,8 +19,10 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <string_view>
 #include <utility> // pair
 
 #include <dali-toolkit/public-api/dali-toolkit-common.h>
@@ -28,6 +30,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/builder/tree-node.h>
+#include <dali-toolkit/internal/builder/tree-node-arena.h>
 
 namespace Dali
 {
@@ -35,8 +38,26 @@ namespace Toolkit
 {
 namespace Internal
 {
-typedef std::vector<char>    VectorChar;
-typedef VectorChar::iterator VectorCharIter;
+/*
+ * Hashed index of the named children of a TreeNode.
+ *
+ * Built by TreeNodeManipulator::AddChild() and Copy() for the nodes with many children, so that
+ * GetChild() doesn't walk all the siblings. The index is allocated in the arena of the tree. When
+ * several children have the same name, the first one is found, as without index.
+ */
+struct TreeNodeChildIndex
+{
+  /*
+   * Find a child by name
+   * @param name The name of the child
+   * @return The child if found, else NULL
+   */
+  const TreeNode* Find(std::string_view name) const;
+
+  TreeNode** slots;    ///< Open addressing table of the children, NULL for an empty slot
+  uint32_t   capacity; ///< The number of slots, a power of two
+  uint32_t   count;    ///< The number of indexed children
+};
 
 /*
  * TreeNodeManipulator performs modification operations on a TreeNode which are
@@ -53,9 +74,10 @@ public:
 
   /*
    * Create a new TreeNode instance
+   * @param arena The arena owning the memory of the node
    * @return new TreeNode
    */
-  static TreeNode* NewTreeNode();
+  static TreeNode* NewTreeNode(TreeNodeArena& arena);
 
   /*
    * Shallow copy node data
@@ -65,32 +87,36 @@ public:
    */
   static void ShallowCopy(const TreeNode* from, TreeNode* to);
 
-  /*
-   * Moves all string data to a new buffer. There must be enough space for all string data.
-   * @param start The buffer start
-   * @param sentinel The end of the buffer
-   */
-  void MoveStrings(VectorCharIter& start, const VectorCharIter& sentinel);
-
   /*
    * Remove all children from the node
+   * The memory of the children is released with their arena
    */
   void RemoveChildren();
 
   /*
-   * Make a deep copy of the tree.
+   * Make a deep copy of the tree, including its strings.
    * @param tree The tree to copy
+   * @param arena The arena owning the memory of the copy
    * @param numberOfNodes The number of nodes that were copied
    * @param numberOfChars The size of string data.
    */
-  static TreeNode* Copy(const TreeNode& tree, int& numberOfNodes, int& numberOfChars);
+  static TreeNode* Copy(const TreeNode& tree, TreeNodeArena& arena, int& numberOfNodes, int& numberOfChars);
+
+  /*
+   * Get the memory that Copy() allocates for the indexes of the children of the tree
+   * @param tree The tree to copy
+   * @return The size in bytes, including the padding for alignment
+   */
+  static std::size_t GetChildIndexesSize(const TreeNode& tree);
 
   /*
    * Add child to the node
+   * The children of the node are indexed by name when there are many of them.
    * @param child The child to add
+   * @param arena The arena owning the memory of the tree
    * @return the added child
    */
-  TreeNode* AddChild(TreeNode* child);
+  TreeNode* AddChild(TreeNode* child, TreeNodeArena& arena);
 
   /*
    * Change the type of the Node
@@ -126,6 +152,12 @@ public:
    */
   size_t Size() const;
 
+  /*
+   * Check whether the node has children, without counting them
+   * @return true if the node has at least one child
+   */
+  bool HasChildren() const;
+
   /*
    * Set the node as a string value
    * @param string The string value
@@ -161,7 +193,7 @@ public:
    * @param name The childs name
    * @return The nodes if found, else NULL
    */
-  const TreeNode* GetChild(const std::string& name) const;
+  const TreeNode* GetChild(std::string_view name) const;
 
   /*
    * @copydoc Dali::Scripting::JsonParser::Write()
@@ -172,19 +204,24 @@ private:
   TreeNode* mNode;
 
   /*
-   * Move the nodes strings to the buffer
+   * Copy the nodes strings to the arena
    */
-  void MoveNodeStrings(VectorCharIter& start, const VectorCharIter& sentinel);
+  static void CopyNodeStrings(TreeNode* node, TreeNodeArena& arena, int& numberChars);
 
   /*
-   * Recursively move child strings to the buffer
+   * Build the index of the children of the node by name
    */
-  void RecurseMoveChildStrings(VectorCharIter& start, const VectorCharIter& sentinel);
+  static void BuildChildIndex(TreeNode* node, TreeNodeArena& arena);
+
+  /*
+   * Link the child after the last child of the node, without indexing it
+   */
+  void LinkChild(TreeNode* child);
 
   /*
    * Recursively copy children
    */
-  static void CopyChildren(const TreeNode* from, TreeNode* to, int& numberNodes, int& numberChars);
+  static void CopyChildren(const TreeNode* from, TreeNode* to, TreeNodeArena& arena, int& numberNodes, int& numberChars);
 
   /*
    * Do write to string stream
@@ -239,16 +276,6 @@ void DepthFirst(TreeNode* node, Operation& operation)
  */
 const TreeNode* FindIt(std::string_view childName, const TreeNode* tree);
 
-/*
- * Copy string to a buffer
- * Raises if there is not enough space in the buffer
- * @param fromString The string
- * @param iter The start of the buffer
- * @param sentinel The buffer sentinel
- * @return The start of the given buffer
- */
-char* CopyString(const char* fromString, VectorCharIter& iter, const VectorCharIter& sentinel);
-
 } // namespace Internal
 
 } // namespace Toolkit
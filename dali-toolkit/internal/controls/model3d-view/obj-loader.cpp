@@ -21,8 +21,10 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 #include <string.h>
-#include <sstream>
+#include <cmath>
+#include <iterator>
 #include <string>
+#include <string_view>
 
 namespace Dali
 {
@@ -33,7 +35,168 @@ namespace Internal
 namespace
 {
 const int MAX_POINT_INDICES = 4;
+
+const double POWERS_OF_TEN[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22}; // all exact in a double.
+const uint64_t MAX_MANTISSA = 100000000000000000u; // further digits would overflow.
+
+bool IsSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+bool IsDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Calls @a function with the [begin, end) range of each line of the buffer, but the first
+ *  one, which is skipped.
+ */
+template<typename Function>
+void ForEachLine(const char* begin, const char* end, Function function)
+{
+  const char* lineBegin = static_cast<const char*>(memchr(begin, '\n', end - begin));
+  while(lineBegin)
+  {
+    ++lineBegin;
+    const char* lineEnd = static_cast<const char*>(memchr(lineBegin, '\n', end - lineBegin));
+    function(lineBegin, lineEnd ? lineEnd : end);
+    lineBegin = lineEnd;
+  }
+}
+
+/**
+ * @brief Reads the next whitespace separated token of the line, without copying it.
+ * @return The token, empty at the end of the line.
+ */
+std::string_view ReadToken(const char*& cursor, const char* end)
+{
+  while(cursor != end && IsSpace(*cursor))
+  {
+    ++cursor;
+  }
+
+  const char* begin = cursor;
+  while(cursor != end && !IsSpace(*cursor))
+  {
+    ++cursor;
+  }
+  return std::string_view(begin, cursor - begin);
+}
+
+/**
+ * @brief Reads an integer, with an optional sign, from @a cursor.
+ * @return The integer, 0 if there were no digits.
+ */
+int ReadInt(const char*& cursor, const char* end)
+{
+  bool negative = false;
+  if(cursor != end && (*cursor == '-' || *cursor == '+'))
+  {
+    negative = *cursor == '-';
+    ++cursor;
+  }
+
+  int value = 0;
+  for(; cursor != end && IsDigit(*cursor); ++cursor)
+  {
+    value = value * 10 + (*cursor - '0');
+  }
+  return negative ? -value : value;
+}
+
+/**
+ * @brief Reads a decimal floating point number, after any whitespace, regardless of the locale.
+ * @return The number, 0 if there were no digits.
+ */
+float ReadFloat(const char*& cursor, const char* end)
+{
+  while(cursor != end && IsSpace(*cursor))
+  {
+    ++cursor;
+  }
+
+  bool negative = false;
+  if(cursor != end && (*cursor == '-' || *cursor == '+'))
+  {
+    negative = *cursor == '-';
+    ++cursor;
+  }
+
+  uint64_t mantissa = 0u;
+  int      exponent = 0;
+  for(; cursor != end && IsDigit(*cursor); ++cursor)
+  {
+    if(mantissa < MAX_MANTISSA)
+    {
+      mantissa = mantissa * 10u + (*cursor - '0');
+    }
+    else
+    {
+      ++exponent;
+    }
+  }
+
+  if(cursor != end && *cursor == '.')
+  {
+    for(++cursor; cursor != end && IsDigit(*cursor); ++cursor)
+    {
+      if(mantissa < MAX_MANTISSA)
+      {
+        mantissa = mantissa * 10u + (*cursor - '0');
+        --exponent;
+      }
+    }
+  }
+
+  if(cursor != end && (*cursor == 'e' || *cursor == 'E'))
+  {
+    ++cursor;
+    exponent += ReadInt(cursor, end);
+  }
+
+  double value = static_cast<double>(mantissa);
+  if(mantissa != 0u)
+  {
+    const int numPowers = static_cast<int>(std::size(POWERS_OF_TEN));
+    if(exponent > 0)
+    {
+      value *= exponent < numPowers ? POWERS_OF_TEN[exponent] : std::pow(10.0, exponent);
+    }
+    else if(exponent < 0)
+    {
+      value /= -exponent < numPowers ? POWERS_OF_TEN[-exponent] : std::pow(10.0, -exponent);
+    }
+  }
+  return static_cast<float>(negative ? -value : value);
+}
+
+/**
+ * @brief Reads the indices of a point of a face, of the form A, A/B, A//C or A/B/C.
+ *  The missing indices are 0.
+ */
+void ReadFaceIndices(std::string_view token, int& pointIndex, int& textureIndex, int& normalIndex)
+{
+  const char* cursor = token.data();
+  const char* end    = cursor + token.size();
+
+  pointIndex   = ReadInt(cursor, end);
+  textureIndex = 0;
+  normalIndex  = 0;
+  if(cursor != end && *cursor == '/')
+  {
+    ++cursor;
+    textureIndex = ReadInt(cursor, end);
+    if(cursor != end && *cursor == '/')
+    {
+      ++cursor;
+      normalIndex = ReadInt(cursor, end);
+    }
+  }
 }
+
+} // namespace
 using namespace Dali;
 
 ObjLoader::ObjLoader()
@@ -342,155 +505,115 @@ void ObjLoader::CreateGeometryArray(Dali::Vector<Vertex>&         vertices,
 
 bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
 {
-  Vector3     point;
-  Vector2     texture;
-  std::string vet[MAX_POINT_INDICES], name;
-  int         ptIdx[MAX_POINT_INDICES];
-  int         nrmIdx[MAX_POINT_INDICES];
-  int         texIdx[MAX_POINT_INDICES];
-  TriIndex    triangle, triangle2;
-  int         pntAcum = 0, texAcum = 0, nrmAcum = 0;
-  bool        iniObj     = false;
-  bool        hasTexture = false;
-  int         face       = 0;
+  Vector3  point;
+  Vector2  texture;
+  int      ptIdx[MAX_POINT_INDICES];
+  int      nrmIdx[MAX_POINT_INDICES];
+  int      texIdx[MAX_POINT_INDICES];
+  TriIndex triangle, triangle2;
+  int      pntAcum = 0, texAcum = 0, nrmAcum = 0;
+  bool     iniObj     = false;
+  bool     hasTexture = false;
 
   //Init AABB for the file
   mSceneAABB.Init();
 
-  std::string strMatActual;
-
-  std::string        input(objBuffer, fileSize);
-  std::istringstream ss(input);
-  ss.imbue(std::locale("C"));
-
-  std::string line;
-  std::getline(ss, line);
+  const char* begin = objBuffer;
+  const char* end   = objBuffer + static_cast<std::streamoff>(fileSize);
+
+  //Count the elements first, so that each array is allocated once.
+  //A quad face makes two triangles, so the points of each face are counted.
+  uint32_t numPoints = 0, numNormals = 0, numTextures = 0, numTriangles = 0;
+  ForEachLine(begin, end, [&](const char* cursor, const char* lineEnd) {
+    auto tag = ReadToken(cursor, lineEnd);
+    numPoints += tag == "v";
+    numNormals += tag == "vn";
+    numTextures += tag == "vt";
+    if(tag == "f")
+    {
+      int numIndices = 0;
+      while(numIndices < MAX_POINT_INDICES && !ReadToken(cursor, lineEnd).empty())
+      {
+        numIndices++;
+      }
+      numTriangles += (numIndices == 3) ? 1u : (numIndices == 4) ? 2u : 0u;
+    }
+  });
 
-  while(std::getline(ss, line))
-  {
-    std::istringstream isline(line, std::istringstream::in);
-    std::string        tag;
+  mPoints.Reserve(mPoints.Size() + numPoints);
+  mNormals.Reserve(mNormals.Size() + numNormals);
+  mTextures.Reserve(mTextures.Size() + numTextures);
+  mTriangles.Reserve(mTriangles.Size() + numTriangles);
 
-    isline >> tag;
+  ForEachLine(begin, end, [&](const char* cursor, const char* lineEnd) {
+    auto tag = ReadToken(cursor, lineEnd);
 
     if(tag == "v")
     {
       //Two different objects in the same file
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      point.x = ReadFloat(cursor, lineEnd);
+      point.y = ReadFloat(cursor, lineEnd);
+      point.z = ReadFloat(cursor, lineEnd);
       mPoints.PushBack(point);
 
       mSceneAABB.ConsiderNewPointInVolume(point);
     }
     else if(tag == "vn")
     {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      point.x = ReadFloat(cursor, lineEnd);
+      point.y = ReadFloat(cursor, lineEnd);
+      point.z = ReadFloat(cursor, lineEnd);
 
       mNormals.PushBack(point);
     }
     else if(tag == "#_#tangent")
     {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      point.x = ReadFloat(cursor, lineEnd);
+      point.y = ReadFloat(cursor, lineEnd);
+      point.z = ReadFloat(cursor, lineEnd);
 
       mTangents.PushBack(point);
     }
     else if(tag == "#_#binormal")
     {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      point.x = ReadFloat(cursor, lineEnd);
+      point.y = ReadFloat(cursor, lineEnd);
+      point.z = ReadFloat(cursor, lineEnd);
 
       mBiTangents.PushBack(point);
     }
     else if(tag == "vt")
     {
-      isline >> texture.x;
-      isline >> texture.y;
+      texture.x = ReadFloat(cursor, lineEnd);
+      texture.y = ReadFloat(cursor, lineEnd);
 
       texture.y = 1.0 - texture.y;
       mTextures.PushBack(texture);
     }
     else if(tag == "#_#vt1")
     {
-      isline >> texture.x;
-      isline >> texture.y;
+      texture.x = ReadFloat(cursor, lineEnd);
+      texture.y = ReadFloat(cursor, lineEnd);
 
       texture.y = 1.0 - texture.y;
       mTextures2.PushBack(texture);
     }
-    else if(tag == "s")
-    {
-    }
     else if(tag == "f")
     {
-      if(!iniObj)
-      {
-        //name assign
-
-        iniObj = true;
-      }
+      iniObj = true;
 
+      //Each point is of the form A, A/B, A//C or A/B/C: point, texture and normal indices.
+      //Whether there are texture coordinates is decided by the first point.
       int numIndices = 0;
-      while((numIndices < MAX_POINT_INDICES) && (isline >> vet[numIndices]))
+      for(auto index = ReadToken(cursor, lineEnd); !index.empty() && numIndices < MAX_POINT_INDICES; index = ReadToken(cursor, lineEnd))
       {
-        numIndices++;
-      }
-
-      //Hold slashes that separate attributes of the same point.
-      char separator;
-      char separator2;
-
-      const char* subString; //A pointer to the position in the string as we move through it.
-
-      subString = strstr(vet[0].c_str(), "/"); //Search for the first '/'
-
-      if(subString)
-      {
-        if(subString[1] == '/') // Of the form A//C, so has points and normals but no texture coordinates.
+        ReadFaceIndices(index, ptIdx[numIndices], texIdx[numIndices], nrmIdx[numIndices]);
+        if(numIndices == 0)
         {
-          for(int i = 0; i < numIndices; i++)
-          {
-            std::istringstream isindex(vet[i]);
-            isindex >> ptIdx[i] >> separator >> separator2 >> nrmIdx[i];
-            texIdx[i] = 0;
-          }
-        }
-        else if(strstr(subString, "/")) // Of the form A/B/C, so has points, textures and normals.
-        {
-          for(int i = 0; i < numIndices; i++)
-          {
-            std::istringstream isindex(vet[i]);
-            isindex >> ptIdx[i] >> separator >> texIdx[i] >> separator2 >> nrmIdx[i];
-          }
-
-          hasTexture = true;
-        }
-        else // Of the form A/B, so has points and textures but no normals.
-        {
-          for(int i = 0; i < numIndices; i++)
-          {
-            std::istringstream isindex(vet[i]);
-            isindex >> ptIdx[i] >> separator >> texIdx[i];
-            nrmIdx[i] = 0;
-          }
-
-          hasTexture = true;
-        }
-      }
-      else // Simply of the form A, as in, point indices only.
-      {
-        for(int i = 0; i < numIndices; i++)
-        {
-          std::istringstream isindex(vet[i]);
-          isindex >> ptIdx[i];
-          texIdx[i] = 0;
-          nrmIdx[i] = 0;
+          auto slash = index.find('/');
+          hasTexture |= slash != std::string_view::npos && slash + 1 < index.size() && index[slash + 1] != '/';
         }
+        numIndices++;
       }
 
       //If it is a triangle
@@ -503,7 +626,6 @@ bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
           triangle.textureIndex[i] = texIdx[i] - 1 - texAcum;
         }
         mTriangles.PushBack(triangle);
-        face++;
       }
       //If on the other hand it is a quad, we will create two triangles
       else if(numIndices == 4)
@@ -515,7 +637,6 @@ bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
           triangle.textureIndex[i] = texIdx[i] - 1 - texAcum;
         }
         mTriangles.PushBack(triangle);
-        face++;
 
         for(int i = 0; i < 3; i++)
         {
@@ -525,22 +646,9 @@ bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
           triangle2.textureIndex[i] = texIdx[idx] - 1 - texAcum;
         }
         mTriangles.PushBack(triangle2);
-        face++;
       }
     }
-    else if(tag == "usemtl")
-    {
-      isline >> strMatActual;
-    }
-    else if(tag == "mtllib")
-    {
-      isline >> strMatActual;
-    }
-    else if(tag == "g")
-    {
-      isline >> name;
-    }
-  }
+  });
 
   if(iniObj)
   {
@@ -555,65 +663,25 @@ bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
 
 void ObjLoader::LoadMaterial(char* objBuffer, std::streampos fileSize, std::string& diffuseTextureUrl, std::string& normalTextureUrl, std::string& glossTextureUrl)
 {
-  float fR, fG, fB;
-
-  std::string info;
-
-  std::string        input(objBuffer, fileSize);
-  std::istringstream ss(input);
-  ss.imbue(std::locale("C"));
+  ForEachLine(objBuffer, objBuffer + static_cast<std::streamoff>(fileSize), [&](const char* cursor, const char* lineEnd) {
+    auto tag = ReadToken(cursor, lineEnd);
 
-  std::string line;
-  std::getline(ss, line);
-
-  while(std::getline(ss, line))
-  {
-    std::istringstream isline(line, std::istringstream::in);
-    std::string        tag;
-
-    isline >> tag;
-
-    if(tag == "newmtl") //name of the material
+    if(tag == "map_Kd")
     {
-      isline >> info;
-    }
-    else if(tag == "Ka") //ambient color
-    {
-      isline >> fR >> fG >> fB;
-    }
-    else if(tag == "Kd") //diffuse color
-    {
-      isline >> fR >> fG >> fB;
-    }
-    else if(tag == "Ks") //specular color
-    {
-      isline >> fR >> fG >> fB;
-    }
-    else if(tag == "Tf") //color
-    {
-    }
-    else if(tag == "Ni")
-    {
-    }
-    else if(tag == "map_Kd")
-    {
-      isline >> info;
-      diffuseTextureUrl = info;
+      diffuseTextureUrl = ReadToken(cursor, lineEnd);
       mHasDiffuseMap    = true;
     }
     else if(tag == "bump")
     {
-      isline >> info;
-      normalTextureUrl = info;
+      normalTextureUrl = ReadToken(cursor, lineEnd);
       mHasNormalMap    = true;
     }
     else if(tag == "map_Ks")
     {
-      isline >> info;
-      glossTextureUrl = info;
+      glossTextureUrl = ReadToken(cursor, lineEnd);
       mHasSpecularMap = true;
     }
-  }
+  });
 
   mMaterialLoaded = true;
 }
@@ -681,6 +749,21 @@ Vector3 ObjLoader::GetSize()
   return size;
 }
 
+const Dali::Vector<Vector3>& ObjLoader::GetPoints() const
+{
+  return mPoints;
+}
+
+const Dali::Vector<Vector3>& ObjLoader::GetNormals() const
+{
+  return mNormals;
+}
+
+const Dali::Vector<ObjLoader::TriIndex>& ObjLoader::GetTriangles() const
+{
+  return mTriangles;
+}
+
 void ObjLoader::ClearArrays()
 {
   mPoints.Clear();
@@ -118,6 +118,10 @@ public:
   Vector3 GetCenter();
   Vector3 GetSize();
 
+  const Dali::Vector<Vector3>&  GetPoints() const;
+  const Dali::Vector<Vector3>&  GetNormals() const;
+  const Dali::Vector<TriIndex>& GetTriangles() const;
+
   void ClearArrays();
 
   bool IsTexturePresent();
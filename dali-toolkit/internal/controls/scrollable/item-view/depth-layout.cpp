@@ -167,9 +167,14 @@ struct DepthRotationConstraint
     }
   }
 
+  inline Quaternion GetRotation() const
+  {
+    return Quaternion(Radian(mMultiplier * Math::PI), Vector3::ZAXIS) * Quaternion(mTiltAngle, Vector3::XAXIS);
+  }
+
   void operator()(Quaternion& current, const PropertyInputContainer& /* inputs */)
   {
-    current = Quaternion(Radian(mMultiplier * Math::PI), Vector3::ZAXIS) * Quaternion(mTiltAngle, Vector3::XAXIS);
+    current = GetRotation();
   }
 
   Radian mTiltAngle;
@@ -189,7 +194,12 @@ struct DepthColorConstraint
   void operator()(Vector4& current, const Dali::PropertyInputContainer& inputs)
   {
     float layoutPosition = inputs[0]->GetFloat() + static_cast<float>(mItemId);
-    float row            = (layoutPosition - static_cast<float>(mColumnNumber)) / mNumberOfColumns;
+    SetColor(current, layoutPosition);
+  }
+
+  inline void SetColor(Vector4& current, float layoutPosition)
+  {
+    float row = (layoutPosition - static_cast<float>(mColumnNumber)) / mNumberOfColumns;
 
     float darkness(1.0f);
     float alpha(1.0f);
@@ -257,6 +267,66 @@ namespace Toolkit
 {
 namespace Internal
 {
+namespace
+{
+/**
+ * Updates the position and the color of all the items of a depth layout in one loop, as the constraints of the layout do.
+ */
+class DepthUpdateFunction : public ItemLayoutUpdater::Function
+{
+public:
+  DepthUpdateFunction(const DepthPositionConstraint& position, const DepthColorConstraint& color, ControlOrientation::Type orientation)
+  : mPosition(position),
+    mColor(color),
+    mOrientation(orientation)
+  {
+  }
+
+  void Update(UpdateProxy& updateProxy, float layoutPosition, const Vector3& layoutSize, const ItemLayoutUpdater::ItemContainer& items) override
+  {
+    Vector3 position;
+    Vector4 color;
+    for(const auto& item : items)
+    {
+      const float itemLayoutPosition = layoutPosition + static_cast<float>(item.itemId);
+      mPosition.mColumnNumber = mColor.mColumnNumber = item.itemId % mPosition.mNumberOfColumns;
+
+      if(mOrientation == ControlOrientation::Up)
+      {
+        mPosition.Orientation0(position, itemLayoutPosition, layoutSize);
+      }
+      else if(mOrientation == ControlOrientation::Left)
+      {
+        mPosition.Orientation90(position, itemLayoutPosition, layoutSize);
+      }
+      else if(mOrientation == ControlOrientation::Down)
+      {
+        mPosition.Orientation180(position, itemLayoutPosition, layoutSize);
+      }
+      else // mOrientation == ControlOrientation::Right
+      {
+        mPosition.Orientation270(position, itemLayoutPosition, layoutSize);
+      }
+      updateProxy.BakePosition(item.actorId, position);
+
+      // The color is only set for this frame, as the color constraint is discarded. Its alpha is 0
+      // where the visibility constraint hides the item, as the visibility can't be set from the update thread.
+      if(updateProxy.GetColor(item.actorId, color))
+      {
+        mColor.SetColor(color, itemLayoutPosition);
+        updateProxy.SetColor(item.actorId, color);
+      }
+    }
+  }
+
+private:
+  DepthPositionConstraint  mPosition;
+  DepthColorConstraint     mColor;
+  ControlOrientation::Type mOrientation;
+};
+
+} // namespace
+
 struct DepthLayout::Impl
 {
   Impl()
@@ -496,6 +566,27 @@ void DepthLayout::ApplyConstraints(Actor& actor, const int itemId, const Vector3
   }
 }
 
+ItemLayoutUpdater::FunctionPtr DepthLayout::CreateUpdateFunction(const Vector3& layoutSize) const
+{
+  // The items of the layout are all of the same size.
+  Vector3 itemSize;
+  GetItemSize(0u, layoutSize, itemSize);
+
+  DepthPositionConstraint position(0u,
+                                   mImpl->mNumberOfColumns,
+                                   0u,
+                                   itemSize,
+                                   -sinf(mImpl->mTiltAngle) * mImpl->mRowSpacing,
+                                   cosf(mImpl->mTiltAngle) * mImpl->mRowSpacing);
+  DepthColorConstraint    color(0u, mImpl->mNumberOfColumns, mImpl->mNumberOfRows * 0.5f, 0u);
+  return ItemLayoutUpdater::FunctionPtr(new DepthUpdateFunction(position, color, GetOrientation()));
+}
+
+void DepthLayout::SetBatchedItemProperties(Actor& actor, const int /* itemId */, const Vector3& /* layoutSize */)
+{
+  actor.SetProperty(Actor::Property::ORIENTATION, DepthRotationConstraint(mImpl->mItemTiltAngle, GetOrientation()).GetRotation());
+}
+
 void DepthLayout::SetDepthLayoutProperties(const Property::Map& properties)
 {
   // Set any properties specified for DepthLayout.
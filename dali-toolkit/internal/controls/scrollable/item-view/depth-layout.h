@@ -19,6 +19,7 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/scrollable/item-view/item-layout-updater.h>
 #include <dali-toolkit/public-api/controls/scrollable/item-view/item-layout.h>
 
 namespace Dali
@@ -34,7 +35,7 @@ typedef IntrusivePtr<DepthLayout> DepthLayoutPtr;
 /**
  * This layout arranges items in a grid, which scrolls along the Z-Axis.
  */
-class DepthLayout : public ItemLayout
+class DepthLayout : public ItemLayout, public BatchedItemLayout
 {
 public:
   /**
@@ -160,6 +161,16 @@ public:
    */
   int GetNextFocusItemID(int itemID, int maxItems, Dali::Toolkit::Control::KeyboardFocus::Direction direction, bool loopEnabled) override;
 
+  /**
+   * @copydoc BatchedItemLayout::CreateUpdateFunction()
+   */
+  ItemLayoutUpdater::FunctionPtr CreateUpdateFunction(const Vector3& layoutSize) const override;
+
+  /**
+   * @copydoc BatchedItemLayout::SetBatchedItemProperties()
+   */
+  void SetBatchedItemProperties(Actor& actor, const int itemId, const Vector3& layoutSize) override;
+
 private:
   /**
    * @copydoc ItemLayout::GetMinimumLayoutPosition()
@@ -134,24 +134,44 @@ public:
   float        mZGap;
 };
 
+Quaternion GetGridRotation(ControlOrientation::Type orientation)
+{
+  if(orientation == ControlOrientation::Up)
+  {
+    return Quaternion(Radian(0.0f), Vector3::ZAXIS);
+  }
+  else if(orientation == ControlOrientation::Left)
+  {
+    return Quaternion(Radian(1.5f * Math::PI), Vector3::ZAXIS);
+  }
+  else if(orientation == ControlOrientation::Down)
+  {
+    return Quaternion(Radian(Math::PI), Vector3::ZAXIS);
+  }
+  else // orientation == ControlOrientation::Right
+  {
+    return Quaternion(Radian(0.5f * Math::PI), Vector3::ZAXIS);
+  }
+}
+
 void GridRotationConstraint0(Quaternion& current, const PropertyInputContainer& /* inputs */)
 {
-  current = Quaternion(Radian(0.0f), Vector3::ZAXIS);
+  current = GetGridRotation(ControlOrientation::Up);
 }
 
 void GridRotationConstraint90(Quaternion& current, const PropertyInputContainer& /* inputs */)
 {
-  current = Quaternion(Radian(1.5f * Math::PI), Vector3::ZAXIS);
+  current = GetGridRotation(ControlOrientation::Left);
 }
 
 void GridRotationConstraint180(Quaternion& current, const PropertyInputContainer& /* inputs */)
 {
-  current = Quaternion(Radian(Math::PI), Vector3::ZAXIS);
+  current = GetGridRotation(ControlOrientation::Down);
 }
 
 void GridRotationConstraint270(Quaternion& current, const PropertyInputContainer& /* inputs */)
 {
-  current = Quaternion(Radian(0.5f * Math::PI), Vector3::ZAXIS);
+  current = GetGridRotation(ControlOrientation::Right);
 }
 
 void GridColorConstraint(Vector4& current, const PropertyInputContainer& /* inputs */)
@@ -179,15 +199,20 @@ struct GridVisibilityConstraint
   {
   }
 
+  inline bool IsVisible(float layoutPosition, float layoutExtent)
+  {
+    float row         = (layoutPosition - static_cast<float>(mColumnIndex)) / mNumberOfColumns;
+    int   rowsPerPage = ceil(layoutExtent / (mItemSize.y + mRowSpacing));
+
+    return (row > -2.0f) && (row < rowsPerPage);
+  }
+
   void Portrait(bool& current, const PropertyInputContainer& inputs)
   {
     float          layoutPosition = inputs[0]->GetFloat() + static_cast<float>(mItemId);
     const Vector3& layoutSize     = inputs[1]->GetVector3();
 
-    float row         = (layoutPosition - static_cast<float>(mColumnIndex)) / mNumberOfColumns;
-    int   rowsPerPage = ceil(layoutSize.height / (mItemSize.y + mRowSpacing));
-
-    current = (row > -2.0f) && (row < rowsPerPage);
+    current = IsVisible(layoutPosition, layoutSize.height);
   }
 
   void Landscape(bool& current, const PropertyInputContainer& inputs)
@@ -195,10 +220,7 @@ struct GridVisibilityConstraint
     float          layoutPosition = inputs[0]->GetFloat() + static_cast<float>(mItemId);
     const Vector3& layoutSize     = inputs[1]->GetVector3();
 
-    float row         = (layoutPosition - static_cast<float>(mColumnIndex)) / mNumberOfColumns;
-    int   rowsPerPage = ceil(layoutSize.width / (mItemSize.y + mRowSpacing));
-
-    current = (row > -2.0f) && (row < rowsPerPage);
+    current = IsVisible(layoutPosition, layoutSize.width);
   }
 
 public:
@@ -219,6 +241,72 @@ namespace Toolkit
 {
 namespace Internal
 {
+namespace
+{
+/**
+ * Updates the position, and the color, of all the items of a grid in one loop, as the constraints of the layout do.
+ */
+class GridUpdateFunction : public ItemLayoutUpdater::Function
+{
+public:
+  GridUpdateFunction(const GridPositionConstraint& position, const GridVisibilityConstraint& visibility, ControlOrientation::Type orientation)
+  : mPosition(position),
+    mVisibility(visibility),
+    mOrientation(orientation)
+  {
+  }
+
+  void Update(UpdateProxy& updateProxy, float layoutPosition, const Vector3& layoutSize, const ItemLayoutUpdater::ItemContainer& items) override
+  {
+    const float layoutExtent = IsVertical(mOrientation) ? layoutSize.height : layoutSize.width;
+
+    Vector3 position;
+    Vector4 color;
+    for(const auto& item : items)
+    {
+      const float itemLayoutPosition = layoutPosition + static_cast<float>(item.itemId);
+      mPosition.mColumnIndex = mVisibility.mColumnIndex = item.itemId % mPosition.mNumberOfColumns;
+
+      if(mOrientation == ControlOrientation::Up)
+      {
+        mPosition.Orientation0(position, itemLayoutPosition, layoutSize);
+      }
+      else if(mOrientation == ControlOrientation::Left)
+      {
+        mPosition.Orientation90(position, itemLayoutPosition, layoutSize);
+      }
+      else if(mOrientation == ControlOrientation::Down)
+      {
+        mPosition.Orientation180(position, itemLayoutPosition, layoutSize);
+      }
+      else // mOrientation == ControlOrientation::Right
+      {
+        mPosition.Orientation270(position, itemLayoutPosition, layoutSize);
+      }
+      updateProxy.BakePosition(item.actorId, position);
+
+      // The color is only set for this frame, as the color constraint is discarded. The rows out of the view
+      // are hidden by their alpha, as the visibility can't be set from the update thread.
+      if(updateProxy.GetColor(item.actorId, color))
+      {
+        color.r = color.g = color.b = 1.0f;
+        if(!mVisibility.IsVisible(itemLayoutPosition, layoutExtent))
+        {
+          color.a = 0.0f;
+        }
+        updateProxy.SetColor(item.actorId, color);
+      }
+    }
+  }
+
+private:
+  GridPositionConstraint   mPosition;
+  GridVisibilityConstraint mVisibility;
+  ControlOrientation::Type mOrientation;
+};
+
+} // namespace
+
 struct GridLayout::Impl
 {
   Impl()
@@ -613,6 +701,22 @@ void GridLayout::ApplyConstraints(Actor& actor, const int itemId, const Vector3&
   }
 }
 
+ItemLayoutUpdater::FunctionPtr GridLayout::CreateUpdateFunction(const Vector3& layoutSize) const
+{
+  // The items of the grid are all of the same size.
+  Vector3 itemSize;
+  GetItemSize(0u, layoutSize, itemSize);
+
+  GridPositionConstraint   position(0u, 0u, mImpl->mNumberOfColumns, mImpl->mRowSpacing, mImpl->mColumnSpacing, mImpl->mTopMargin, mImpl->mSideMargin, itemSize, mImpl->mZGap);
+  GridVisibilityConstraint visibility(0u, 0u, mImpl->mNumberOfColumns, mImpl->mRowSpacing, mImpl->mColumnSpacing, mImpl->mSideMargin, itemSize);
+  return ItemLayoutUpdater::FunctionPtr(new GridUpdateFunction(position, visibility, GetOrientation()));
+}
+
+void GridLayout::SetBatchedItemProperties(Actor& actor, const int /* itemId */, const Vector3& /* layoutSize */)
+{
+  actor.SetProperty(Actor::Property::ORIENTATION, GetGridRotation(GetOrientation()));
+}
+
 void GridLayout::SetGridLayoutProperties(const Property::Map& properties)
 {
   // Set any properties specified for gridLayout.
@@ -19,7 +19,7 @@
  */
 
 // INTERNAL INCLUDES
-
+#include <dali-toolkit/internal/controls/scrollable/item-view/item-layout-updater.h>
 #include <dali-toolkit/public-api/controls/scrollable/item-view/item-layout.h>
 
 #include <dali-toolkit/public-api/dali-toolkit-common.h>
@@ -37,7 +37,7 @@ typedef IntrusivePtr<GridLayout> GridLayoutPtr; ///< Pointer to a Dali::Toolkit:
 /**
  * @brief An ItemView layout which arranges items in a grid.
  */
-class GridLayout : public ItemLayout
+class GridLayout : public ItemLayout, public BatchedItemLayout
 {
 public:
   /**
@@ -205,6 +205,16 @@ public:
    */
   int GetNextFocusItemID(int itemID, int maxItems, Dali::Toolkit::Control::KeyboardFocus::Direction direction, bool loopEnabled) override;
 
+  /**
+   * @copydoc BatchedItemLayout::CreateUpdateFunction()
+   */
+  ItemLayoutUpdater::FunctionPtr CreateUpdateFunction(const Vector3& layoutSize) const override;
+
+  /**
+   * @copydoc BatchedItemLayout::SetBatchedItemProperties()
+   */
+  void SetBatchedItemProperties(Actor& actor, const int itemId, const Vector3& layoutSize) override;
+
 private:
   /**
    * @copydoc ItemLayout::GetMinimumLayoutPosition()
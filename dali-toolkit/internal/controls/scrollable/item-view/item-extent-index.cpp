@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/scrollable/item-view/item-extent-index.h>
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+#include <algorithm>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+inline unsigned int LowestBit(unsigned int value)
+{
+  return value & (~value + 1u);
+}
+
+} // namespace
+
+ItemExtentIndex::ItemExtentIndex(float defaultExtent)
+: mExtents(),
+  mTree(1u, 0.0),
+  mDefaultExtent(defaultExtent)
+{
+  DALI_ASSERT_ALWAYS(defaultExtent > 0.0f && "The default extent must be greater than zero");
+}
+
+void ItemExtentIndex::SetDefaultExtent(float extent)
+{
+  DALI_ASSERT_ALWAYS(extent > 0.0f && "The default extent must be greater than zero");
+  if(extent == mDefaultExtent)
+  {
+    return;
+  }
+  mDefaultExtent = extent;
+
+  // Build the tree again, each node adding itself to its parent.
+  const unsigned int count = mExtents.size();
+  for(unsigned int i = 1u; i <= count; ++i)
+  {
+    mTree[i] = GetExtent(i - 1u);
+  }
+  for(unsigned int i = 1u; i <= count; ++i)
+  {
+    const unsigned int parent = i + LowestBit(i);
+    if(parent <= count)
+    {
+      mTree[parent] += mTree[i];
+    }
+  }
+}
+
+float ItemExtentIndex::GetDefaultExtent() const
+{
+  return mDefaultExtent;
+}
+
+void ItemExtentIndex::SetExtent(unsigned int itemId, float extent)
+{
+  extent = std::max(extent, 0.0f);
+  while(mExtents.size() <= itemId)
+  {
+    Append(-1.0f);
+  }
+
+  const double delta = static_cast<double>(extent) - GetExtent(itemId);
+  mExtents[itemId]   = extent;
+  if(delta != 0.0)
+  {
+    for(unsigned int i = itemId + 1u, count = mExtents.size(); i <= count; i += LowestBit(i))
+    {
+      mTree[i] += delta;
+    }
+  }
+}
+
+void ItemExtentIndex::Clear()
+{
+  mExtents.clear();
+  mTree.resize(1u);
+}
+
+float ItemExtentIndex::GetExtent(unsigned int itemId) const
+{
+  return itemId < mExtents.size() && mExtents[itemId] >= 0.0f ? mExtents[itemId] : mDefaultExtent;
+}
+
+double ItemExtentIndex::GetOffset(unsigned int itemId) const
+{
+  const unsigned int count = mExtents.size();
+  return itemId <= count ? GetSum(itemId) : GetSum(count) + static_cast<double>(itemId - count) * mDefaultExtent;
+}
+
+unsigned int ItemExtentIndex::FindItem(double offset) const
+{
+  if(offset < 0.0)
+  {
+    return 0u;
+  }
+
+  // Descend the tree, from the largest range within the items, to the last item which ends before the offset.
+  const unsigned int count  = mExtents.size();
+  unsigned int       itemId = 0u;
+  unsigned int       step   = 1u;
+  while(step <= count / 2u)
+  {
+    step *= 2u;
+  }
+  for(; step > 0u && count > 0u; step /= 2u)
+  {
+    if(itemId + step <= count && mTree[itemId + step] <= offset)
+    {
+      itemId += step;
+      offset -= mTree[itemId];
+    }
+  }
+
+  if(itemId < count)
+  {
+    return itemId;
+  }
+  return count + static_cast<unsigned int>(offset / mDefaultExtent);
+}
+
+double ItemExtentIndex::GetSum(unsigned int count) const
+{
+  double sum = 0.0;
+  for(; count > 0u; count -= LowestBit(count))
+  {
+    sum += mTree[count];
+  }
+  return sum;
+}
+
+void ItemExtentIndex::Append(float extent)
+{
+  mExtents.push_back(extent);
+
+  // The node of the new item sums the items in its range, which are all before it.
+  const unsigned int count = mExtents.size();
+  mTree.push_back(GetExtent(count - 1u) + GetSum(count - 1u) - GetSum(count - LowestBit(count)));
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,105 @@
+#ifndef DALI_TOOLKIT_INTERNAL_ITEM_EXTENT_INDEX_H
+#define DALI_TOOLKIT_INTERNAL_ITEM_EXTENT_INDEX_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <vector>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief An index of the extents of the items of a layout, along its scroll direction.
+ *
+ * The extents are kept in a Fenwick tree, so that the offset of an item, and the item at an
+ * offset, are found in O(log n), as is the update of the extent of an item. The items whose
+ * extent isn't set, including those beyond the last one set, have the default extent.
+ */
+class ItemExtentIndex
+{
+public:
+  /**
+   * @brief Creates an index where all the items have @a defaultExtent.
+   */
+  explicit ItemExtentIndex(float defaultExtent);
+
+  /**
+   * @brief Sets the extent of the items whose extent isn't set. O(n).
+   * @pre @a extent is greater than zero.
+   */
+  void SetDefaultExtent(float extent);
+
+  /**
+   * @return The extent of the items whose extent isn't set.
+   */
+  float GetDefaultExtent() const;
+
+  /**
+   * @brief Sets the extent of an item; negative extents are clamped to 0. O(log n), and
+   * O(log n) for each item added between the last one set and @a itemId.
+   */
+  void SetExtent(unsigned int itemId, float extent);
+
+  /**
+   * @brief Resets the extent of all the items to the default one.
+   */
+  void Clear();
+
+  /**
+   * @return The extent of an item. O(1).
+   */
+  float GetExtent(unsigned int itemId) const;
+
+  /**
+   * @return The sum of the extents of the items before @a itemId. O(log n).
+   */
+  double GetOffset(unsigned int itemId) const;
+
+  /**
+   * @return The item which spans @a offset, skipping the items of no extent; 0 if it's negative. O(log n).
+   */
+  unsigned int FindItem(double offset) const;
+
+private:
+  /**
+   * @return The sum of the extents of the first @a count items within the tree.
+   */
+  double GetSum(unsigned int count) const;
+
+  /**
+   * @brief Adds an item of @a extent at the end of the tree.
+   */
+  void Append(float extent);
+
+private:
+  std::vector<float>  mExtents; ///< The extents of the items in the tree, negative if not set.
+  std::vector<double> mTree;    ///< The Fenwick tree of the extents of the items, 1-based.
+  float               mDefaultExtent;
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_ITEM_EXTENT_INDEX_H
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/scrollable/item-view/item-layout-updater.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+ItemLayoutUpdater::ItemLayoutUpdater(Actor itemViewActor, Actor layoutPositionActor)
+: mMutex(),
+  mItems(),
+  mItemIndices(),
+  mFunction(),
+  mItemViewId(itemViewActor.GetProperty<int>(Actor::Property::ID)),
+  mLayoutPositionId(layoutPositionActor.GetProperty<int>(Actor::Property::ID))
+{
+}
+
+void ItemLayoutUpdater::SetFunction(FunctionPtr function)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mFunction = std::move(function);
+}
+
+void ItemLayoutUpdater::SetItem(Actor actor, unsigned int itemId)
+{
+  const uint32_t actorId = actor.GetProperty<int>(Actor::Property::ID);
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto                        iter = mItemIndices.find(actorId);
+  if(iter != mItemIndices.end())
+  {
+    mItems[iter->second].itemId = itemId;
+  }
+  else
+  {
+    mItemIndices.emplace(actorId, static_cast<uint32_t>(mItems.size()));
+    mItems.push_back(Item{actorId, itemId});
+  }
+}
+
+void ItemLayoutUpdater::RemoveItem(Actor actor)
+{
+  const uint32_t actorId = actor.GetProperty<int>(Actor::Property::ID);
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto                        iter = mItemIndices.find(actorId);
+  if(iter != mItemIndices.end())
+  {
+    // Move the last item into the place of the removed one, to keep the items contiguous.
+    const uint32_t index = iter->second;
+    mItemIndices.erase(iter);
+    if(index + 1u < mItems.size())
+    {
+      mItems[index]                       = mItems.back();
+      mItemIndices[mItems[index].actorId] = index;
+    }
+    mItems.pop_back();
+  }
+}
+
+void ItemLayoutUpdater::Clear()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mItems.clear();
+  mItemIndices.clear();
+}
+
+std::size_t ItemLayoutUpdater::GetItemCount() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mItems.size();
+}
+
+void ItemLayoutUpdater::Update(Dali::UpdateProxy& updateProxy, float /* elapsedSeconds */)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  if(!mFunction || mItems.empty())
+  {
+    return;
+  }
+
+  Vector3 layoutPosition;
+  Vector3 layoutSize;
+  if(updateProxy.GetPosition(mLayoutPositionId, layoutPosition) && updateProxy.GetSize(mItemViewId, layoutSize))
+  {
+    mFunction->Update(updateProxy, layoutPosition.x, layoutSize, mItems);
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,181 @@
+#ifndef DALI_TOOLKIT_INTERNAL_ITEM_LAYOUT_UPDATER_H
+#define DALI_TOOLKIT_INTERNAL_ITEM_LAYOUT_UPDATER_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <dali/devel-api/update/update-proxy.h>
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/math/vector3.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+/**
+ * @brief Updates the properties of all the items of an ItemView in one loop, in the update thread,
+ * instead of the constraints which a layout applies to each item.
+ *
+ * The items are kept in a contiguous array, which the function of the layout goes through each frame
+ * with the current layout position and size of the ItemView.
+ *
+ * The layout position is read from the position of a source actor, the only actor with a constraint.
+ * The items are added and removed in the event thread.
+ */
+class ItemLayoutUpdater : public FrameCallbackInterface
+{
+public:
+  /**
+   * @brief An item updated by the layout.
+   */
+  struct Item
+  {
+    uint32_t     actorId; ///< The ID of the actor of the item
+    unsigned int itemId;  ///< The ID of the item in the ItemView
+  };
+
+  typedef std::vector<Item> ItemContainer;
+
+  /**
+   * @brief The calculation of the item properties of a layout.
+   *
+   * It's created in the event thread, with the parameters of the layout, and called in the update thread.
+   */
+  class Function
+  {
+  public:
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~Function() = default;
+
+    /**
+     * @brief Update the properties of the items.
+     *
+     * @param[in] updateProxy Used to set the properties of the items
+     * @param[in] layoutPosition The layout position of the ItemView
+     * @param[in] layoutSize The size of the ItemView
+     * @param[in] items The items to update
+     */
+    virtual void Update(UpdateProxy& updateProxy, float layoutPosition, const Vector3& layoutSize, const ItemContainer& items) = 0;
+  };
+
+  typedef std::unique_ptr<Function> FunctionPtr;
+
+  /**
+   * @brief Create an updater.
+   *
+   * @param[in] itemViewActor The ItemView, which must be the root actor of the frame callback
+   * @param[in] layoutPositionActor The child of the ItemView whose x position is its layout position
+   */
+  ItemLayoutUpdater(Actor itemViewActor, Actor layoutPositionActor);
+
+  /**
+   * @brief Set the function of the active layout, or nullptr to stop updating the items.
+   *
+   * @param[in] function The function
+   */
+  void SetFunction(FunctionPtr function);
+
+  /**
+   * @brief Add an item, or change the item ID of an actor already added.
+   *
+   * @param[in] actor The actor of the item
+   * @param[in] itemId The ID of the item
+   */
+  void SetItem(Actor actor, unsigned int itemId);
+
+  /**
+   * @brief Remove the item of an actor, if it's added.
+   *
+   * @param[in] actor The actor of the item
+   */
+  void RemoveItem(Actor actor);
+
+  /**
+   * @brief Remove all the items.
+   */
+  void Clear();
+
+  /**
+   * @brief Get the number of items.
+   * @return The number of items
+   */
+  std::size_t GetItemCount() const;
+
+private: // From FrameCallbackInterface
+  /**
+   * @copydoc FrameCallbackInterface::Update()
+   */
+  void Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds) override;
+
+private:
+  mutable std::mutex                     mMutex;            ///< Guards the members below, used in both threads
+  ItemContainer                          mItems;            ///< The items, in no particular order
+  std::unordered_map<uint32_t, uint32_t> mItemIndices;      ///< The index of each item in mItems, by actor ID
+  FunctionPtr                            mFunction;         ///< The function of the active layout
+  const uint32_t                         mItemViewId;       ///< The ID of the ItemView
+  const uint32_t                         mLayoutPositionId; ///< The ID of the actor whose x position is the layout position
+};
+
+/**
+ * @brief The interface of a layout whose items can be updated by an ItemLayoutUpdater.
+ */
+class BatchedItemLayout
+{
+public:
+  /**
+   * @brief Create the function updating the items of the layout in a batch.
+   *
+   * @param[in] layoutSize The target size of the layout
+   * @return The function
+   */
+  virtual ItemLayoutUpdater::FunctionPtr CreateUpdateFunction(const Vector3& layoutSize) const = 0;
+
+  /**
+   * @brief Set the properties of an item which don't depend on the layout position,
+   * instead of applying its constraints.
+   *
+   * @param[in] actor The actor of the item
+   * @param[in] itemId The ID of the item
+   * @param[in] layoutSize The target size of the layout
+   */
+  virtual void SetBatchedItemProperties(Actor& actor, const int itemId, const Vector3& layoutSize) = 0;
+
+protected:
+  /**
+   * @brief Protected destructor; the layouts are owned through ItemLayout.
+   */
+  virtual ~BatchedItemLayout() = default;
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_ITEM_LAYOUT_UPDATER_H
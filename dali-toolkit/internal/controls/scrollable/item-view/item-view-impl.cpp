@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/devel-api/common/stage-devel.h>
 #include <dali/devel-api/common/stage.h>
 #include <dali/devel-api/object/property-helper-devel.h>
 #include <dali/public-api/actors/layer.h>
@@ -34,6 +35,8 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/scroll-bar/scroll-bar.h>
+#include <dali-toolkit/devel-api/controls/scrollable/item-view/item-factory-extension.h>
+#include <dali-toolkit/devel-api/controls/scrollable/item-view/variable-size-list-layout.h>
 #include <dali-toolkit/internal/controls/scrollable/bouncing-effect-actor.h>
 #include <dali-toolkit/internal/controls/scrollable/item-view/depth-layout.h>
 #include <dali-toolkit/internal/controls/scrollable/item-view/grid-layout.h>
@@ -80,6 +83,15 @@ float CalculateScrollDistance(Vector2 panDistance, Toolkit::ItemLayout& layout)
   return panDistance.x * sinTheta + panDistance.y * cosTheta;
 }
 
+/**
+ * Local helper to get the layout positions of an item, which is 1 but for the layouts in pixels
+ */
+float GetLayoutPositionsPerItem(const Toolkit::ItemLayout& layout)
+{
+  const Toolkit::VariableSizeListLayout* listLayout = dynamic_cast<const Toolkit::VariableSizeListLayout*>(&layout);
+  return listLayout ? listLayout->GetDefaultItemExtent() : 1.0f;
+}
+
 // Overshoot overlay constraints
 struct OvershootOverlaySizeConstraint
 {
@@ -226,6 +238,14 @@ void OvershootOverlayVisibilityConstraint(bool& current, const PropertyInputCont
   current = inputs[0]->GetBoolean();
 }
 
+/**
+ * Moves the actor read by the layout updater to the layout position of the ItemView along the x axis.
+ */
+void LayoutPositionConstraint(Vector3& current, const PropertyInputContainer& inputs)
+{
+  current.x = inputs[0]->GetFloat();
+}
+
 } // unnamed namespace
 
 namespace Dali
@@ -343,7 +363,8 @@ ItemView::ItemView(ItemFactory& factory)
   mAddingItems(false),
   mRefreshEnabled(true),
   mRefreshNotificationEnabled(true),
-  mInAnimation(false)
+  mInAnimation(false),
+  mDefaultRefreshInterval(true)
 {
 }
 
@@ -362,7 +383,7 @@ void ItemView::OnInitialize()
   mWheelEventFinishedTimer = Timer::New(WHEEL_EVENT_FINISHED_TIME_OUT);
   mWheelEventFinishedTimer.TickSignal().Connect(this, &ItemView::OnWheelEventFinished);
 
-  SetRefreshInterval(DEFAULT_REFRESH_INTERVAL_LAYOUT_POSITIONS);
+  SetRefreshNotificationInterval(DEFAULT_REFRESH_INTERVAL_LAYOUT_POSITIONS);
 
   // Connect wheel event
   self.WheelEventSignal().Connect(this, &ItemView::OnWheelEvent);
@@ -377,6 +398,10 @@ DevelControl::ControlAccessible* ItemView::CreateAccessibleObject()
 
 ItemView::~ItemView()
 {
+  if(mLayoutUpdater && Stage::IsInstalled())
+  {
+    DevelStage::RemoveFrameCallback(Stage::GetCurrent(), *mLayoutUpdater);
+  }
 }
 
 unsigned int ItemView::GetLayoutCount() const
@@ -431,6 +456,14 @@ void ItemView::ActivateLayout(unsigned int layoutIndex, const Vector3& targetSiz
   // Switch to the new layout
   mActiveLayout = mLayouts[layoutIndex].Get();
 
+  // The default refresh interval is a number of items, so it is scaled for the layouts in pixels.
+  if(mDefaultRefreshInterval)
+  {
+    SetRefreshNotificationInterval(DEFAULT_REFRESH_INTERVAL_LAYOUT_POSITIONS * GetLayoutPositionsPerItem(*mActiveLayout));
+  }
+
+  UpdateBatchedLayoutFunction(targetSize);
+
   // Move the items to the new layout positions...
 
   for(ConstItemIter iter = mItemPool.begin(); iter != mItemPool.end(); ++iter)
@@ -439,9 +472,9 @@ void ItemView::ActivateLayout(unsigned int layoutIndex, const Vector3& targetSiz
     Actor        actor  = iter->second;
 
     // Remove constraints from previous layout
-    actor.RemoveConstraints();
+    RemoveItemConstraints(actor);
 
-    mActiveLayout->ApplyConstraints(actor, itemId, targetSize, Self());
+    ApplyItemConstraints(actor, itemId, targetSize);
 
     Vector3 size;
     mActiveLayout->GetItemSize(itemId, targetSize, size);
@@ -503,7 +536,12 @@ void ItemView::DeactivateCurrentLayout()
     for(ConstItemIter iter = mItemPool.begin(); iter != mItemPool.end(); ++iter)
     {
       Actor actor = iter->second;
-      actor.RemoveConstraints();
+      RemoveItemConstraints(actor);
+    }
+
+    if(mLayoutUpdater)
+    {
+      mLayoutUpdater->SetFunction(nullptr);
     }
 
     mActiveLayout = NULL;
@@ -599,6 +637,12 @@ float ItemView::GetAnchoringDuration() const
 }
 
 void ItemView::SetRefreshInterval(float intervalLayoutPositions)
+{
+  mDefaultRefreshInterval = false;
+  SetRefreshNotificationInterval(intervalLayoutPositions);
+}
+
+void ItemView::SetRefreshNotificationInterval(float intervalLayoutPositions)
 {
   if(!Equals(mRefreshIntervalLayoutPositions, intervalLayoutPositions))
   {
@@ -698,8 +742,8 @@ void ItemView::InsertItem(Item newItem, float durationSeconds)
       iter->second   = displacedActor;
       displacedActor = temp;
 
-      iter->second.RemoveConstraints();
-      mActiveLayout->ApplyConstraints(iter->second, iter->first, layoutSize, Self());
+      RemoveItemConstraints(iter->second);
+      ApplyItemConstraints(iter->second, iter->first, layoutSize);
     }
 
     // Create last item
@@ -710,8 +754,8 @@ void ItemView::InsertItem(Item newItem, float durationSeconds)
       Item   lastItem(lastId + 1, displacedActor);
       InsertToItemContainer(mItemPool, lastItem);
 
-      lastItem.second.RemoveConstraints();
-      mActiveLayout->ApplyConstraints(lastItem.second, lastItem.first, layoutSize, Self());
+      RemoveItemConstraints(lastItem.second);
+      ApplyItemConstraints(lastItem.second, lastItem.first, layoutSize);
     }
   }
 
@@ -768,8 +812,8 @@ void ItemView::InsertItems(const ItemContainer& newItems, float durationSeconds)
     }
     else
     {
-      iter->second.RemoveConstraints();
-      mActiveLayout->ApplyConstraints(iter->second, iter->first, layoutSize, Self());
+      RemoveItemConstraints(iter->second);
+      ApplyItemConstraints(iter->second, iter->first, layoutSize);
     }
   }
 
@@ -946,7 +990,7 @@ void ItemView::AddNewActor(unsigned int itemId, const Vector3& layoutSize)
 
   if(mItemPool.end() == FindItemById(mItemPool, itemId))
   {
-    Actor actor = mItemFactory.NewItem(itemId);
+    Actor actor = NewItemActor(itemId);
 
     if(actor)
     {
@@ -962,6 +1006,39 @@ void ItemView::AddNewActor(unsigned int itemId, const Vector3& layoutSize)
   mAddingItems = false;
 }
 
+Actor ItemView::NewItemActor(ItemId itemId)
+{
+  ItemFactory::Extension* extension = mItemFactory.GetExtension();
+  if(!extension)
+  {
+    return mItemFactory.NewItem(itemId);
+  }
+
+  const unsigned int viewType = extension->GetItemViewType(itemId);
+
+  Actor actor;
+
+  auto recycledActors = mRecycledActors.find(viewType);
+  if(recycledActors != mRecycledActors.end() && !recycledActors->second.empty())
+  {
+    actor = recycledActors->second.back();
+    recycledActors->second.pop_back();
+
+    extension->BindItem(itemId, actor);
+  }
+  else
+  {
+    actor = mItemFactory.NewItem(itemId);
+  }
+
+  // The view type is kept while the actor is used by an item, the recycled actors are kept by view type.
+  if(actor)
+  {
+    mItemViewTypes[actor.GetProperty<int>(Actor::Property::ID)] = viewType;
+  }
+  return actor;
+}
+
 void ItemView::SetupActor(Item item, const Vector3& layoutSize)
 {
   item.second.SetProperty(Actor::Property::PARENT_ORIGIN, mItemsParentOrigin);
@@ -973,7 +1050,7 @@ void ItemView::SetupActor(Item item, const Vector3& layoutSize)
     mActiveLayout->GetItemSize(item.first, mActiveLayoutTargetSize, size);
     item.second.SetProperty(Actor::Property::SIZE, size.GetVectorXY());
 
-    mActiveLayout->ApplyConstraints(item.second, item.first, layoutSize, Self());
+    ApplyItemConstraints(item.second, item.first, layoutSize);
   }
 }
 
@@ -981,6 +1058,71 @@ void ItemView::ReleaseActor(ItemId item, Actor actor)
 {
   Self().Remove(actor);
   mItemFactory.ItemReleased(item, actor);
+
+  if(mLayoutUpdater)
+  {
+    mLayoutUpdater->RemoveItem(actor);
+  }
+
+  auto viewType = mItemViewTypes.find(actor.GetProperty<int>(Actor::Property::ID));
+  if(viewType != mItemViewTypes.end())
+  {
+    std::vector<Actor>& recycledActors = mRecycledActors[viewType->second];
+    mItemViewTypes.erase(viewType);
+
+    // Keep the actor for the next item of its view type, without the constraints of its layout.
+    // The actors beyond the number of items displayed and reserved for scrolling are dropped.
+    if(recycledActors.size() < GetMaxRecycledActorCount())
+    {
+      actor.RemoveConstraints();
+      recycledActors.push_back(actor);
+    }
+  }
+}
+
+unsigned int ItemView::GetMaxRecycledActorCount() const
+{
+  if(!mActiveLayout)
+  {
+    return 0u;
+  }
+
+  // All the items of the area may be released at once on refresh, then added again.
+  const ItemRange range = mActiveLayout->GetItemsWithinArea(GetCurrentLayoutPosition(0), mActiveLayoutTargetSize);
+  return range.end - range.begin + 2u * mActiveLayout->GetReserveItemCount(mActiveLayoutTargetSize);
+}
+
+void ItemView::ApplyItemConstraints(Actor& actor, ItemId itemId, const Vector3& layoutSize)
+{
+  BatchedItemLayout* batchedLayout = mLayoutUpdater ? dynamic_cast<BatchedItemLayout*>(mActiveLayout) : nullptr;
+  if(batchedLayout)
+  {
+    batchedLayout->SetBatchedItemProperties(actor, itemId, layoutSize);
+    mLayoutUpdater->SetItem(actor, itemId);
+  }
+  else
+  {
+    mActiveLayout->ApplyConstraints(actor, itemId, layoutSize, Self());
+  }
+}
+
+void ItemView::RemoveItemConstraints(Actor& actor)
+{
+  actor.RemoveConstraints();
+
+  if(mLayoutUpdater)
+  {
+    mLayoutUpdater->RemoveItem(actor);
+  }
+}
+
+void ItemView::UpdateBatchedLayoutFunction(const Vector3& layoutSize)
+{
+  if(mLayoutUpdater)
+  {
+    BatchedItemLayout* batchedLayout = dynamic_cast<BatchedItemLayout*>(mActiveLayout);
+    mLayoutUpdater->SetFunction(batchedLayout ? batchedLayout->CreateUpdateFunction(layoutSize) : nullptr);
+  }
 }
 
 ItemRange ItemView::GetItemRange(ItemLayout& layout, const Vector3& layoutSize, float layoutPosition, bool reserveExtra)
@@ -1076,13 +1218,15 @@ void ItemView::ReapplyAllConstraints()
 {
   Vector3 layoutSize = Self().GetCurrentProperty<Vector3>(Actor::Property::SIZE);
 
+  UpdateBatchedLayoutFunction(layoutSize);
+
   for(ConstItemIter iter = mItemPool.begin(); iter != mItemPool.end(); ++iter)
   {
     unsigned int id    = iter->first;
     Actor        actor = iter->second;
 
-    actor.RemoveConstraints();
-    mActiveLayout->ApplyConstraints(actor, id, layoutSize, Self());
+    RemoveItemConstraints(actor);
+    ApplyItemConstraints(actor, id, layoutSize);
   }
 }
 
@@ -1107,7 +1251,8 @@ float ItemView::ClampFirstItemPosition(float targetPosition, const Vector3& targ
 
   if(updateOvershoot)
   {
-    mScrollOvershoot = targetPosition - clamppedPosition;
+    // The overshoot is in items, whatever the unit of the layout positions.
+    mScrollOvershoot = (targetPosition - clamppedPosition) / GetLayoutPositionsPerItem(layout);
   }
 
   return clamppedPosition;
@@ -1632,7 +1777,9 @@ float ItemView::CalculateScrollOvershoot()
     float minLayoutPosition = mActiveLayout->GetMinimumLayoutPosition(mItemFactory.GetNumberOfItems(), Self().GetCurrentProperty<Vector3>(Actor::Property::SIZE));
     self.SetProperty(Toolkit::Scrollable::Property::SCROLL_POSITION_MAX, Vector2(0.0f, -minLayoutPosition));
     float clamppedPosition = std::min(0.0f, std::max(minLayoutPosition, positionDelta));
-    overshoot              = positionDelta - clamppedPosition;
+
+    // The overshoot is in items, whatever the unit of the layout positions, so one item overshot shows it fully.
+    overshoot = (positionDelta - clamppedPosition) / GetLayoutPositionsPerItem(*mActiveLayout);
   }
 
   return overshoot > 0.0f ? std::min(overshoot, 1.0f) : std::max(overshoot, -1.0f);
@@ -1726,6 +1873,64 @@ void ItemView::GetItemsRange(ItemRange& range)
   }
 }
 
+void ItemView::SetBatchedLayoutEnabled(bool enabled)
+{
+  if(enabled == IsBatchedLayoutEnabled())
+  {
+    return;
+  }
+
+  // Take the items from the constraints of the active layout, or from the layout updater.
+  for(ConstItemIter iter = mItemPool.begin(); iter != mItemPool.end(); ++iter)
+  {
+    Actor actor = iter->second;
+    RemoveItemConstraints(actor);
+  }
+
+  Actor self = Self();
+  if(enabled)
+  {
+    // The layout updater can't read the layout position property, so an actor follows it with its position instead.
+    mLayoutPositionActor = Actor::New();
+    mLayoutPositionActor.SetProperty(Actor::Property::SENSITIVE, false);
+
+    Constraint constraint = Constraint::New<Vector3>(mLayoutPositionActor, Actor::Property::POSITION, LayoutPositionConstraint);
+    constraint.AddSource(Source(self, Toolkit::ItemView::Property::LAYOUT_POSITION));
+    constraint.Apply();
+
+    self.Add(mLayoutPositionActor);
+
+    mLayoutUpdater.reset(new ItemLayoutUpdater(self, mLayoutPositionActor));
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), *mLayoutUpdater, self);
+  }
+  else
+  {
+    DevelStage::RemoveFrameCallback(Stage::GetCurrent(), *mLayoutUpdater);
+    mLayoutUpdater.reset();
+
+    self.Remove(mLayoutPositionActor);
+    mLayoutPositionActor.Reset();
+  }
+
+  if(mActiveLayout)
+  {
+    Vector3 layoutSize = self.GetCurrentProperty<Vector3>(Actor::Property::SIZE);
+
+    UpdateBatchedLayoutFunction(layoutSize);
+
+    for(ConstItemIter iter = mItemPool.begin(); iter != mItemPool.end(); ++iter)
+    {
+      Actor actor = iter->second;
+      ApplyItemConstraints(actor, iter->first, layoutSize);
+    }
+  }
+}
+
+bool ItemView::IsBatchedLayoutEnabled() const
+{
+  return mLayoutUpdater != nullptr;
+}
+
 bool ItemView::DoConnectSignal(BaseObject* object, ConnectionTrackerInterface* tracker, const std::string& signalName, FunctorDelegate* functor)
 {
   Dali::BaseHandle handle(object);
@@ -24,8 +24,11 @@
 #include <dali/public-api/object/property-array.h>
 #include <dali/public-api/object/property-map.h>
 #include <dali/public-api/object/property-notification.h>
+#include <memory>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/controls/scrollable/item-view/item-layout-updater.h>
 #include <dali-toolkit/internal/controls/scrollable/scrollable-impl.h>
 #include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/public-api/controls/image-view/image-view.h>
@@ -162,6 +165,12 @@ public:
    */
   void SetRefreshInterval(float intervalLayoutPositions);
 
+  /**
+   * Set the refresh interval without marking it as set by the application.
+   * @param[in] intervalLayoutPositions The refresh interval in layout positions.
+   */
+  void SetRefreshNotificationInterval(float intervalLayoutPositions);
+
   /**
    * @copydoc Toolkit::ItemView::GetRefreshInterval
    */
@@ -286,6 +295,16 @@ public:
    */
   void GetItemsRange(ItemRange& range);
 
+  /**
+   * @copydoc Toolkit::DevelItemView::SetBatchedLayoutEnabled
+   */
+  void SetBatchedLayoutEnabled(bool enabled);
+
+  /**
+   * @copydoc Toolkit::DevelItemView::IsBatchedLayoutEnabled
+   */
+  bool IsBatchedLayoutEnabled() const;
+
   /**
    * @copydoc Toolkit::ItemView::LayoutActivatedSignal()
    */
@@ -383,6 +402,14 @@ private:
    */
   void AddNewActor(ItemId item, const Vector3& layoutSize);
 
+  /**
+   * Get an Actor for an item, from the recycled actors of its view type if the ItemFactory has an extension,
+   * or else from the ItemFactory.
+   * @param[in] itemId The ID of the item.
+   * @return The actor, or an uninitialized handle if the ID is out of range.
+   */
+  Actor NewItemActor(ItemId itemId);
+
   /**
    * Apply the constraints etc. that are required for ItemView children.
    * @param[in] item The item to setup.
@@ -397,6 +424,33 @@ private:
    */
   void ReleaseActor(ItemId item, Actor actor);
 
+  /**
+   * Get the maximum number of actors kept for reuse for each view type.
+   * @return The number of items within the area of the active layout, plus the reserve items on either side.
+   */
+  unsigned int GetMaxRecycledActorCount() const;
+
+  /**
+   * Make the active layout position an item, either by its constraints or, if the batched layout is enabled
+   * and supported by the layout, by the layout updater.
+   * @param[in] actor The actor of the item.
+   * @param[in] itemId The ID of the item.
+   * @param[in] layoutSize The layout-size.
+   */
+  void ApplyItemConstraints(Actor& actor, ItemId itemId, const Vector3& layoutSize);
+
+  /**
+   * Stop the layout positioning an item, removing its constraints and its entry in the layout updater.
+   * @param[in] actor The actor of the item.
+   */
+  void RemoveItemConstraints(Actor& actor);
+
+  /**
+   * Give the layout updater the update function of the active layout, if it's a batched layout.
+   * @param[in] layoutSize The layout-size.
+   */
+  void UpdateBatchedLayoutFunction(const Vector3& layoutSize);
+
 private: // From CustomActorImpl
   /**
    * From CustomActorImpl; called after a child has been added to the owning actor.
@@ -631,6 +685,12 @@ private:
   Vector2                    mTotalPanDisplacement;
   ItemLayout*                mActiveLayout;
 
+  std::unordered_map<int, unsigned int>                mItemViewTypes;  ///< The view types of the actors used by items, by actor ID, if the ItemFactory has an extension.
+  std::unordered_map<unsigned int, std::vector<Actor>> mRecycledActors; ///< The released actors to reuse, by view type, at most GetMaxRecycledActorCount() of each.
+
+  std::unique_ptr<ItemLayoutUpdater> mLayoutUpdater;       ///< Updates the items of a batched layout, if the batched layout is enabled.
+  Actor                              mLayoutPositionActor; ///< The child whose x position follows the layout position, for the layout updater.
+
   float mAnchoringDuration;
   float mRefreshIntervalLayoutPositions; ///< Refresh item view when the layout position changes by this interval in both positive and negative directions.
   float mMinimumSwipeSpeed;
@@ -650,6 +710,7 @@ private:
   bool         mRefreshEnabled : 1;             ///< Whether to refresh the cache automatically
   bool         mRefreshNotificationEnabled : 1; ///< Whether to disable refresh notifications or not.
   bool         mInAnimation : 1;                ///< Keeps track of whether an animation is controlling the overshoot property.
+  bool         mDefaultRefreshInterval : 1;     ///< Whether the refresh interval is the default one, which is scaled for the layouts in pixels.
 };
 
 } // namespace Internal
@@ -141,6 +141,8 @@ DALI_DEVEL_PROPERTY_REGISTRATION(Toolkit,           TextLabel, "ellipsisPosition
 DALI_DEVEL_PROPERTY_REGISTRATION(Toolkit,           TextLabel, "strikethrough",                MAP,     STRIKETHROUGH                  )
 DALI_DEVEL_PROPERTY_REGISTRATION(Toolkit,           TextLabel, "characterSpacing",             FLOAT,   CHARACTER_SPACING              )
 DALI_DEVEL_PROPERTY_REGISTRATION(Toolkit,           TextLabel, "relativeLineSize",             FLOAT,   RELATIVE_LINE_SIZE             )
+DALI_DEVEL_PROPERTY_REGISTRATION(Toolkit,           TextLabel, "enableAsyncRendering",         BOOLEAN, ENABLE_ASYNC_RENDERING         )
+DALI_DEVEL_PROPERTY_REGISTRATION(Toolkit,           TextLabel, "visibleArea",                  VECTOR4, VISIBLE_AREA                   )
 
 DALI_ANIMATABLE_PROPERTY_REGISTRATION_WITH_DEFAULT(Toolkit, TextLabel, "textColor",      Color::BLACK,     TEXT_COLOR   )
 DALI_ANIMATABLE_PROPERTY_COMPONENT_REGISTRATION(Toolkit,    TextLabel, "textColorRed",   TEXT_COLOR_RED,   TEXT_COLOR, 0)
@@ -550,6 +552,24 @@ void TextLabel::SetProperty(BaseObject* object, Property::Index index, const Pro
         impl.mController->SetRelativeLineSize(relativeLineSize);
         break;
       }
+      case Toolkit::DevelTextLabel::Property::ENABLE_ASYNC_RENDERING:
+      {
+        const bool enableAsyncRendering = value.Get<bool>();
+        DALI_LOG_INFO(gLogFilter, Debug::Verbose, "TextLabel %p ENABLE_ASYNC_RENDERING %d\n", impl.mController.Get(), enableAsyncRendering);
+
+        TextVisual::SetAsyncRendering(impl.mVisual, enableAsyncRendering);
+        break;
+      }
+      case Toolkit::DevelTextLabel::Property::VISIBLE_AREA:
+      {
+        const Vector4 visibleArea = value.Get<Vector4>();
+        DALI_LOG_INFO(gLogFilter, Debug::Verbose, "TextLabel %p VISIBLE_AREA %f,%f %fx%f\n", impl.mController.Get(), visibleArea.x, visibleArea.y, visibleArea.z, visibleArea.w);
+
+        // Only the tiles of the text which became visible or invisible are updated, on the next relayout.
+        TextVisual::SetVisibleArea(impl.mVisual, visibleArea);
+        impl.RequestTextRelayout();
+        break;
+      }
     }
 
     // Request relayout when text update is needed. It's necessary to call it
@@ -813,6 +833,16 @@ Property::Value TextLabel::GetProperty(BaseObject* object, Property::Index index
         value = impl.mController->GetRelativeLineSize();
         break;
       }
+      case Toolkit::DevelTextLabel::Property::ENABLE_ASYNC_RENDERING:
+      {
+        value = TextVisual::IsAsyncRendering(impl.mVisual);
+        break;
+      }
+      case Toolkit::DevelTextLabel::Property::VISIBLE_AREA:
+      {
+        value = TextVisual::GetVisibleArea(impl.mVisual);
+        break;
+      }
     }
   }
 
@@ -1078,6 +1108,11 @@ void TextLabel::OnRelayout(const Vector2& size, RelayoutContainer& container)
 
     mTextUpdateNeeded = false;
   }
+  else if(TextVisual::IsVisibleAreaChanged(mVisual))
+  {
+    // The text is the same, only the tiles of the visual are updated for the new visible area.
+    TextVisual::UpdateRenderer(mVisual);
+  }
 
   if(mController->IsTextFitChanged())
   {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,9 +27,9 @@ namespace Toolkit
 {
 namespace Internal
 {
-AsyncImageLoader::AsyncImageLoader()
+AsyncImageLoader::AsyncImageLoader(uint32_t numberOfWorkers)
 : mLoadedSignal(),
-  mLoadThread(new EventThreadCallback(MakeCallback(this, &AsyncImageLoader::ProcessLoadedImage))),
+  mLoadThread(new EventThreadCallback(MakeCallback(this, &AsyncImageLoader::ProcessLoadedImage)), numberOfWorkers),
   mLoadTaskId(0u),
   mIsLoadThreadStarted(false)
 {
@@ -42,7 +42,12 @@ AsyncImageLoader::~AsyncImageLoader()
 
 IntrusivePtr<AsyncImageLoader> AsyncImageLoader::New()
 {
-  IntrusivePtr<AsyncImageLoader> internal = new AsyncImageLoader();
+  return New(1u);
+}
+
+IntrusivePtr<AsyncImageLoader> AsyncImageLoader::New(uint32_t numberOfWorkers)
+{
+  IntrusivePtr<AsyncImageLoader> internal = new AsyncImageLoader(numberOfWorkers);
   return internal;
 }
 
@@ -130,6 +135,11 @@ void AsyncImageLoader::CancelAll()
   mLoadThread.CancelAll();
 }
 
+bool AsyncImageLoader::SetTaskPriority(uint32_t loadingTaskId, int32_t priority)
+{
+  return mLoadThread.SetTaskPriority(loadingTaskId, priority);
+}
+
 void AsyncImageLoader::ProcessLoadedImage()
 {
   while(LoadingTask* next = mLoadThread.NextCompletedTask())
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_ASYNC_IMAGE_LOADER_IMPL_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -37,14 +37,23 @@ class AsyncImageLoader : public BaseObject
 public:
   /**
    * Constructor
+   * @param[in] numberOfWorkers The number of worker threads which load images concurrently
    */
-  AsyncImageLoader();
+  explicit AsyncImageLoader(uint32_t numberOfWorkers);
 
   /**
    * @copydoc Toolkit::AsyncImageLoader::New()
    */
   static IntrusivePtr<AsyncImageLoader> New();
 
+  /**
+   * @brief Create a new loader which loads images by several worker threads.
+   * Tasks are shared by the workers, so a task is processed as soon as any worker is idle.
+   * @param[in] numberOfWorkers The number of worker threads which load images concurrently
+   * @return The new loader
+   */
+  static IntrusivePtr<AsyncImageLoader> New(uint32_t numberOfWorkers);
+
   /**
    * @copydoc Toolkit::AsyncImageLoader::LoadAnimatedImage( Dali::AnimatedImageLoading animatedImageLoading, uint32_t frameIndex, DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad)
    */
@@ -114,6 +123,15 @@ public:
    */
   void CancelAll();
 
+  /**
+   * @brief Change the priority of a loading task which is not started yet.
+   * Task with higher priority is processed first. The default priority is 0.
+   * @param[in] loadingTaskId The id of the loading task
+   * @param[in] priority The new priority
+   * @return True if the task was waiting to be processed
+   */
+  bool SetTaskPriority(uint32_t loadingTaskId, int32_t priority);
+
   /**
    * Process the completed loading task from the worker thread.
    */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 #include <dali/devel-api/adaptor-framework/thread-settings.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
+#include <algorithm>
 
 namespace Dali
 {
@@ -46,7 +47,8 @@ LoadingTask::LoadingTask(uint32_t id, Dali::AnimatedImageLoading animatedImageLo
   contentScale(1.0f),
   cropToMask(false),
   animatedImageLoading(animatedImageLoading),
-  frameIndex(frameIndex)
+  frameIndex(frameIndex),
+  priority(0)
 {
 }
 
@@ -65,7 +67,8 @@ LoadingTask::LoadingTask(uint32_t id, const VisualUrl& url, ImageDimensions dime
   contentScale(1.0f),
   cropToMask(false),
   animatedImageLoading(),
-  frameIndex(0u)
+  frameIndex(0u),
+  priority(0)
 {
 }
 
@@ -84,7 +87,8 @@ LoadingTask::LoadingTask(uint32_t id, const EncodedImageBuffer& encodedImageBuff
   contentScale(1.0f),
   cropToMask(false),
   animatedImageLoading(),
-  frameIndex(0u)
+  frameIndex(0u),
+  priority(0)
 {
 }
 
@@ -103,7 +107,8 @@ LoadingTask::LoadingTask(uint32_t id, Devel::PixelBuffer pixelBuffer, Devel::Pix
   contentScale(contentScale),
   cropToMask(cropToMask),
   animatedImageLoading(),
-  frameIndex(0u)
+  frameIndex(0u),
+  priority(0)
 {
 }
 
@@ -148,18 +153,51 @@ void LoadingTask::MultiplyAlpha()
   }
 }
 
-ImageLoadThread::ImageLoadThread(EventThreadCallback* trigger)
-: mTrigger(trigger),
-  mLogFactory(Dali::Adaptor::Get().GetLogFactory())
+ImageLoadThread::Worker::Worker(ImageLoadThread& owner)
+: mOwner(owner)
 {
 }
 
+void ImageLoadThread::Worker::Run()
+{
+  SetThreadName("ImageLoadThread");
+  mOwner.RunWorker();
+}
+
+ImageLoadThread::ImageLoadThread(EventThreadCallback* trigger, uint32_t numberOfWorkers)
+: mWorkers(),
+  mTrigger(trigger),
+  mLogFactory(Dali::Adaptor::Get().GetLogFactory()),
+  mIsStarted(false),
+  mDestroying(false)
+{
+  DALI_ASSERT_DEBUG(numberOfWorkers > 0u);
+
+  mWorkers.reserve(numberOfWorkers);
+  for(uint32_t i = 0u; i < std::max(numberOfWorkers, 1u); ++i)
+  {
+    mWorkers.push_back(std::unique_ptr<Worker>(new Worker(*this)));
+  }
+}
+
 ImageLoadThread::~ImageLoadThread()
 {
-  // add an empty task would stop the thread from conditional wait.
-  AddTask(NULL);
-  // stop the thread
-  Join();
+  {
+    // Lock while marking destruction, so that no worker misses the notification.
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    mDestroying = true;
+  }
+  // wake up all the worker threads from conditional wait.
+  mConditionalWait.Notify();
+
+  // stop the threads
+  if(mIsStarted)
+  {
+    for(auto&& worker : mWorkers)
+    {
+      worker->Join();
+    }
+  }
 
   delete mTrigger;
 
@@ -176,9 +214,20 @@ ImageLoadThread::~ImageLoadThread()
   mCompleteQueue.Clear();
 }
 
-void ImageLoadThread::Run()
+void ImageLoadThread::Start()
+{
+  if(!mIsStarted)
+  {
+    for(auto&& worker : mWorkers)
+    {
+      worker->Start();
+    }
+    mIsStarted = true;
+  }
+}
+
+void ImageLoadThread::RunWorker()
 {
-  SetThreadName("ImageLoadThread");
   mLogFactory.InstallLogFunction();
 
   while(LoadingTask* task = NextTaskToProcess())
@@ -199,19 +248,14 @@ void ImageLoadThread::Run()
 
 void ImageLoadThread::AddTask(LoadingTask* task)
 {
-  bool wasEmpty = false;
   {
     // Lock while adding task to the queue
     ConditionalWait::ScopedLock lock(mConditionalWait);
-    wasEmpty = mLoadQueue.Empty();
     mLoadQueue.PushBack(task);
   }
 
-  if(wasEmpty)
-  {
-    // wake up the image loading thread
-    mConditionalWait.Notify();
-  }
+  // wake up the image loading threads
+  mConditionalWait.Notify();
 }
 
 LoadingTask* ImageLoadThread::NextCompletedTask()
@@ -261,18 +305,49 @@ void ImageLoadThread::CancelAll()
   mLoadQueue.Clear();
 }
 
+bool ImageLoadThread::SetTaskPriority(uint32_t loadingTaskId, int32_t priority)
+{
+  // Lock while changing the task in the queue
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+
+  for(auto&& task : mLoadQueue)
+  {
+    if(task->id == loadingTaskId)
+    {
+      task->priority = priority;
+      return true;
+    }
+  }
+
+  return false;
+}
+
 LoadingTask* ImageLoadThread::NextTaskToProcess()
 {
   // Lock while popping task out from the queue
   ConditionalWait::ScopedLock lock(mConditionalWait);
 
-  while(mLoadQueue.Empty())
+  while(mLoadQueue.Empty() && !mDestroying)
   {
     mConditionalWait.Wait(lock);
   }
 
-  Vector<LoadingTask*>::Iterator next     = mLoadQueue.Begin();
-  LoadingTask*                   nextTask = *next;
+  if(mDestroying)
+  {
+    return NULL;
+  }
+
+  // Find the first task which has the highest priority.
+  Vector<LoadingTask*>::Iterator next = mLoadQueue.Begin();
+  for(Vector<LoadingTask*>::Iterator iter = mLoadQueue.Begin() + 1, endIter = mLoadQueue.End(); iter != endIter; ++iter)
+  {
+    if((*iter)->priority > (*next)->priority)
+    {
+      next = iter;
+    }
+  }
+
+  LoadingTask* nextTask = *next;
   mLoadQueue.Erase(next);
 
   return nextTask;
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_IMAGE_LOAD_THREAD_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -30,6 +30,8 @@
 #include <dali/public-api/images/image-operations.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
+#include <memory>
+#include <vector>
 
 namespace Dali
 {
@@ -146,25 +148,35 @@ public:
   bool                       cropToMask;      ///< Whether to crop the content to the mask size
   Dali::AnimatedImageLoading animatedImageLoading;
   uint32_t                   frameIndex;
+  int32_t                    priority;        ///< The priority of this task. Task with higher priority is processed first.
 };
 
 /**
- * The worker thread for image loading.
+ * The worker threads for image loading.
+ *
+ * All worker threads share one loading queue, so a task is processed by the first idle worker.
+ * Tasks with higher priority are processed first. Tasks with the same priority are processed in the order they were added.
  */
-class ImageLoadThread : public Thread
+class ImageLoadThread
 {
 public:
   /**
    * Constructor.
    *
    * @param[in] mTrigger The trigger to wake up the main thread.
+   * @param[in] numberOfWorkers The number of worker threads. It should be bigger than 0.
    */
-  ImageLoadThread(EventThreadCallback* mTrigger);
+  ImageLoadThread(EventThreadCallback* mTrigger, uint32_t numberOfWorkers = 1u);
 
   /**
    * Destructor.
    */
-  ~ImageLoadThread() override;
+  ~ImageLoadThread();
+
+  /**
+   * Start the worker threads.
+   */
+  void Start();
 
   /**
    * Add a task in to the loading queue
@@ -192,11 +204,43 @@ public:
    */
   void CancelAll();
 
+  /**
+   * Change the priority of the loading task in the waiting queue.
+   *
+   * @param[in] loadingTaskId The id of the task.
+   * @param[in] priority The new priority of the task.
+   * @return True if the task is still waiting in the queue.
+   */
+  bool SetTaskPriority(uint32_t loadingTaskId, int32_t priority);
+
 private:
+  /**
+   * The worker thread which processes the tasks of the owner ImageLoadThread.
+   */
+  class Worker : public Thread
+  {
+  public:
+    /**
+     * Constructor.
+     *
+     * @param[in] owner The ImageLoadThread which has the loading queue.
+     */
+    Worker(ImageLoadThread& owner);
+
+  protected:
+    /**
+     * The entry function of the worker thread.
+     */
+    void Run() override;
+
+  private:
+    ImageLoadThread& mOwner;
+  };
+
   /**
    * Pop the next loading task out from the queue to process.
    *
-   * @return The next task to be processed.
+   * @return The next task to be processed, or NULL if the workers should be stopped.
    */
   LoadingTask* NextTaskToProcess();
 
@@ -207,12 +251,11 @@ private:
    */
   void AddCompletedTask(LoadingTask* task);
 
-protected:
   /**
-   * The entry function of the worker thread.
    * It fetches loading task from the loadQueue, loads the image and adds to the completeQueue.
+   * Called by each worker thread.
    */
-  void Run() override;
+  void RunWorker();
 
 private:
   // Undefined
@@ -222,13 +265,16 @@ private:
   ImageLoadThread& operator=(const ImageLoadThread& thread);
 
 private:
-  Vector<LoadingTask*>             mLoadQueue;     ///<The task queue with images for loading.
-  Vector<LoadingTask*>             mCompleteQueue; ///<The task queue with images loaded.
-  EventThreadCallback*             mTrigger;
-  const Dali::LogFactoryInterface& mLogFactory; ///< The log factory
+  Vector<LoadingTask*>                 mLoadQueue;     ///<The task queue with images for loading.
+  Vector<LoadingTask*>                 mCompleteQueue; ///<The task queue with images loaded.
+  std::vector<std::unique_ptr<Worker>> mWorkers;       ///<The worker threads which share mLoadQueue.
+  EventThreadCallback*                 mTrigger;
+  const Dali::LogFactoryInterface&     mLogFactory; ///< The log factory
 
   ConditionalWait mConditionalWait;
   Dali::Mutex     mMutex;
+  bool            mIsStarted;  ///< Whether the worker threads are started.
+  bool            mDestroying; ///< Whether the worker threads should be stopped.
 };
 
 } // namespace Internal
@@ -370,6 +370,7 @@ bool StyleManager::LoadJSON(Toolkit::Builder builder, const std::string& jsonFil
   std::string fileString;
   if(LoadFile(jsonFilePath, fileString))
   {
+    // The file is either a json source or a binary tree precompiled by JsonParser::WriteBinary(), which isn't parsed.
     builder.LoadFromString(fileString);
     return true;
   }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
+#include <map>
 
 namespace
 {
@@ -60,36 +61,9 @@ void AtlasGlyphManager::Add(const Text::GlyphInfo&                        glyph,
     mAtlasManager.SetTextures(slot.mAtlasId, textureSet);
   }
 
-  GlyphRecordEntry record;
-  record.mIndex        = glyph.index;
-  record.mImageId      = slot.mImageId;
-  record.mCount        = 1;
-  record.mOutlineWidth = style.outline;
-  record.isItalic      = style.isItalic;
-  record.isBold        = style.isBold;
-
-  // Have glyph records been created for this fontId ?
-  bool foundGlyph = false;
-  for(std::vector<FontGlyphRecord>::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-      fontGlyphRecordIt != mFontGlyphRecords.end();
-      ++fontGlyphRecordIt)
-  {
-    if(fontGlyphRecordIt->mFontId == glyph.fontId)
-    {
-      fontGlyphRecordIt->mGlyphRecords.PushBack(record);
-      foundGlyph = true;
-      break;
-    }
-  }
-
-  if(!foundGlyph)
-  {
-    // We need to add a new font entry
-    FontGlyphRecord fontGlyphRecord;
-    fontGlyphRecord.mFontId = glyph.fontId;
-    fontGlyphRecord.mGlyphRecords.PushBack(record);
-    mFontGlyphRecords.push_back(fontGlyphRecord);
-  }
+  GlyphRecordEntry& record = mGlyphRecords[GlyphRecordKey(glyph.fontId, glyph.index, style)];
+  record.mImageId          = slot.mImageId;
+  record.mCount            = 1;
 }
 
 void AtlasGlyphManager::GenerateMeshData(uint32_t                       imageId,
@@ -105,27 +79,12 @@ bool AtlasGlyphManager::IsCached(Text::FontId                                  f
                                  const Toolkit::AtlasGlyphManager::GlyphStyle& style,
                                  Dali::Toolkit::AtlasManager::AtlasSlot&       slot)
 {
-  for(std::vector<FontGlyphRecord>::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-      fontGlyphRecordIt != mFontGlyphRecords.end();
-      ++fontGlyphRecordIt)
+  const auto iter = mGlyphRecords.find(GlyphRecordKey(fontId, index, style));
+  if(iter != mGlyphRecords.end())
   {
-    if(fontGlyphRecordIt->mFontId == fontId)
-    {
-      for(Vector<GlyphRecordEntry>::Iterator glyphRecordIt = fontGlyphRecordIt->mGlyphRecords.Begin();
-          glyphRecordIt != fontGlyphRecordIt->mGlyphRecords.End();
-          ++glyphRecordIt)
-      {
-        if((glyphRecordIt->mIndex == index) &&
-           (glyphRecordIt->mOutlineWidth == style.outline) &&
-           (glyphRecordIt->isItalic == style.isItalic) &&
-           (glyphRecordIt->isBold == style.isBold))
-        {
-          slot.mImageId = glyphRecordIt->mImageId;
-          slot.mAtlasId = mAtlasManager.GetAtlas(slot.mImageId);
-          return true;
-        }
-      }
-    }
+    slot.mImageId = iter->second.mImageId;
+    slot.mAtlasId = mAtlasManager.GetAtlas(slot.mImageId);
+    return true;
   }
   slot.mImageId = 0;
   return false;
@@ -156,21 +115,17 @@ const Toolkit::AtlasGlyphManager::Metrics& AtlasGlyphManager::GetMetrics()
 {
   std::ostringstream verboseMetrics;
 
-  mMetrics.mGlyphCount = 0u;
-  for(std::vector<FontGlyphRecord>::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-      fontGlyphRecordIt != mFontGlyphRecords.end();
-      ++fontGlyphRecordIt)
-  {
-    mMetrics.mGlyphCount += fontGlyphRecordIt->mGlyphRecords.Size();
+  mMetrics.mGlyphCount = static_cast<uint32_t>(mGlyphRecords.size());
 
-    verboseMetrics << "[FontId " << fontGlyphRecordIt->mFontId << " Glyph ";
-    for(Vector<GlyphRecordEntry>::Iterator glyphRecordEntryIt = fontGlyphRecordIt->mGlyphRecords.Begin();
-        glyphRecordEntryIt != fontGlyphRecordIt->mGlyphRecords.End();
-        ++glyphRecordEntryIt)
-    {
-      verboseMetrics << glyphRecordEntryIt->mIndex << "(" << glyphRecordEntryIt->mCount << ") ";
-    }
-    verboseMetrics << "] ";
+  // Group the glyphs by font.
+  std::map<Text::FontId, std::ostringstream> fontGlyphCounts;
+  for(const auto& glyphRecord : mGlyphRecords)
+  {
+    fontGlyphCounts[glyphRecord.first.mFontId] << glyphRecord.first.mIndex << "(" << glyphRecord.second.mCount << ") ";
+  }
+  for(const auto& fontGlyphCount : fontGlyphCounts)
+  {
+    verboseMetrics << "[FontId " << fontGlyphCount.first << " Glyph " << fontGlyphCount.second.str() << "] ";
   }
   mMetrics.mVerboseGlyphCounts = verboseMetrics.str();
 
@@ -185,33 +140,18 @@ void AtlasGlyphManager::AdjustReferenceCount(Text::FontId fontId, Text::GlyphInd
   {
     DALI_LOG_INFO(gLogFilter, Debug::General, "AdjustReferenceCount %d, font: %d index: %d\n", delta, fontId, index);
 
-    for(std::vector<FontGlyphRecord>::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-        fontGlyphRecordIt != mFontGlyphRecords.end();
-        ++fontGlyphRecordIt)
+    auto iter = mGlyphRecords.find(GlyphRecordKey(fontId, index, style));
+    if(iter != mGlyphRecords.end())
     {
-      if(fontGlyphRecordIt->mFontId == fontId)
+      iter->second.mCount += delta;
+      DALI_ASSERT_DEBUG(iter->second.mCount >= 0 && "Glyph ref-count should not be negative");
+
+      if(!iter->second.mCount)
       {
-        for(Vector<GlyphRecordEntry>::Iterator glyphRecordIt = fontGlyphRecordIt->mGlyphRecords.Begin();
-            glyphRecordIt != fontGlyphRecordIt->mGlyphRecords.End();
-            ++glyphRecordIt)
-        {
-          if((glyphRecordIt->mIndex == index) &&
-             (glyphRecordIt->mOutlineWidth == style.outline) &&
-             (glyphRecordIt->isItalic == style.isItalic) &&
-             (glyphRecordIt->isBold == style.isBold))
-          {
-            glyphRecordIt->mCount += delta;
-            DALI_ASSERT_DEBUG(glyphRecordIt->mCount >= 0 && "Glyph ref-count should not be negative");
-
-            if(!glyphRecordIt->mCount)
-            {
-              mAtlasManager.Remove(glyphRecordIt->mImageId);
-              fontGlyphRecordIt->mGlyphRecords.Remove(glyphRecordIt);
-            }
-            return;
-          }
-        }
+        mAtlasManager.Remove(iter->second.mImageId);
+        mGlyphRecords.erase(iter);
       }
+      return;
     }
 
     // Should not arrive here
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_ATLAS_GLYPH_MANAGER_IMPL_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,8 +18,9 @@
  */
 
 // EXTERNAL INCLUDES
-#include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/base-object.h>
+#include <cstddef>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-glyph-manager.h>
@@ -42,22 +43,62 @@ typedef IntrusivePtr<AtlasGlyphManager> AtlasGlyphManagerPtr;
 class AtlasGlyphManager : public Dali::BaseObject
 {
 public:
-  struct GlyphRecordEntry
+  /**
+   * @brief Identifies a cached glyph image.
+   */
+  struct GlyphRecordKey
   {
+    GlyphRecordKey(Text::FontId fontId, Text::GlyphIndex index, const Toolkit::AtlasGlyphManager::GlyphStyle& style)
+    : mFontId(fontId),
+      mIndex(index),
+      mOutlineWidth(style.outline),
+      isItalic(style.isItalic),
+      isBold(style.isBold)
+    {
+    }
+
+    bool operator==(const GlyphRecordKey& rhs) const
+    {
+      return mFontId == rhs.mFontId &&
+             mIndex == rhs.mIndex &&
+             mOutlineWidth == rhs.mOutlineWidth &&
+             isItalic == rhs.isItalic &&
+             isBold == rhs.isBold;
+    }
+
+    Text::FontId     mFontId;
     Text::GlyphIndex mIndex;
-    uint32_t         mImageId;
-    int32_t          mCount;
     uint16_t         mOutlineWidth;
     bool             isItalic : 1;
     bool             isBold : 1;
   };
 
-  struct FontGlyphRecord
+  /**
+   * @brief Hash function of GlyphRecordKey.
+   */
+  struct GlyphRecordKeyHash
+  {
+    std::size_t operator()(const GlyphRecordKey& key) const
+    {
+      uint64_t hash = (static_cast<uint64_t>(key.mFontId) << 32u) | static_cast<uint64_t>(key.mIndex);
+      hash ^= (static_cast<uint64_t>(key.mOutlineWidth) << 2u) | (static_cast<uint64_t>(key.isItalic) << 1u) | static_cast<uint64_t>(key.isBold);
+
+      // Mix the bits, as std::hash of an integer may be the identity.
+      hash ^= hash >> 33u;
+      hash *= 0xff51afd7ed558ccdull;
+      hash ^= hash >> 33u;
+      return static_cast<std::size_t>(hash);
+    }
+  };
+
+  struct GlyphRecordEntry
   {
-    Text::FontId             mFontId;
-    Vector<GlyphRecordEntry> mGlyphRecords;
+    uint32_t mImageId;
+    int32_t  mCount;
   };
 
+  using GlyphRecordContainer = std::unordered_map<GlyphRecordKey, GlyphRecordEntry, GlyphRecordKeyHash>;
+
   /**
    * @brief Constructor
    */
@@ -124,7 +165,7 @@ protected:
 
 private:
   Dali::Toolkit::AtlasManager         mAtlasManager; ///> Atlas Manager created by GlyphManager
-  std::vector<FontGlyphRecord>        mFontGlyphRecords;
+  GlyphRecordContainer                mGlyphRecords; ///> Cached glyph images, looked up per glyph of every rendered text
   Toolkit::AtlasGlyphManager::Metrics mMetrics; ///> Metrics to pass back on GlyphManager status
   Sampler                             mSampler;
 };
@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/text/rendering/model-snapshot.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <memory.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace
+{
+/**
+ * @brief Copies @p count items of the given buffer into the vector.
+ *
+ * @param[out] destination The vector where the items are copied.
+ * @param[in] source Pointer to the first item. It may be NULL.
+ * @param[in] count The number of items to copy.
+ */
+template<typename T>
+void CopyBuffer(Vector<T>& destination, const T* const source, Length count)
+{
+  if((nullptr != source) && (0u != count))
+  {
+    destination.Resize(count);
+    memcpy(destination.Begin(), source, count * sizeof(T));
+  }
+}
+
+/**
+ * @brief Retrieves the number of colors referenced by the given color indices.
+ *
+ * The index zero means the default color. Any other index is the position of the color in the palette plus one.
+ *
+ * @param[in] colorIndices The color indices.
+ *
+ * @return The number of colors of the palette.
+ */
+Length GetNumberOfColors(const Vector<ColorIndex>& colorIndices)
+{
+  ColorIndex numberOfColors = 0u;
+  for(Length index = 0u, count = colorIndices.Count(); index < count; ++index)
+  {
+    numberOfColors = std::max(numberOfColors, colorIndices[index]);
+  }
+  return static_cast<Length>(numberOfColors);
+}
+
+} // namespace
+
+ModelSnapshot::ModelSnapshot(const ModelInterface& model)
+: mControlSize(model.GetControlSize()),
+  mLayoutSize(model.GetLayoutSize()),
+  mScrollPosition(model.GetScrollPosition()),
+  mHorizontalAlignment(model.GetHorizontalAlignment()),
+  mVerticalAlignment(model.GetVerticalAlignment()),
+  mVerticalLineAlignment(model.GetVerticalLineAlignment()),
+  mEllipsisPosition(model.GetEllipsisPosition()),
+  mLines(),
+  mScriptRuns(),
+  mGlyphs(),
+  mLayout(),
+  mStartIndexOfElidedGlyphs(model.GetStartIndexOfElidedGlyphs()),
+  mEndIndexOfElidedGlyphs(model.GetEndIndexOfElidedGlyphs()),
+  mFirstMiddleIndexOfElidedGlyphs(model.GetFirstMiddleIndexOfElidedGlyphs()),
+  mSecondMiddleIndexOfElidedGlyphs(model.GetSecondMiddleIndexOfElidedGlyphs()),
+  mColors(),
+  mColorIndices(),
+  mBackgroundColors(),
+  mBackgroundColorIndices(),
+  mDefaultColor(model.GetDefaultColor()),
+  mShadowOffset(model.GetShadowOffset()),
+  mShadowColor(model.GetShadowColor()),
+  mShadowBlurRadius(model.GetShadowBlurRadius()),
+  mUnderlineColor(model.GetUnderlineColor()),
+  mUnderlineHeight(model.GetUnderlineHeight()),
+  mUnderlineType(model.GetUnderlineType()),
+  mDashedUnderlineWidth(model.GetDashedUnderlineWidth()),
+  mDashedUnderlineGap(model.GetDashedUnderlineGap()),
+  mUnderlineRuns(),
+  mOutlineColor(model.GetOutlineColor()),
+  mOutlineWidth(model.GetOutlineWidth()),
+  mBackgroundColor(model.GetBackgroundColor()),
+  mHyphens(),
+  mHyphenIndices(),
+  mStrikethroughColor(model.GetStrikethroughColor()),
+  mStrikethroughHeight(model.GetStrikethroughHeight()),
+  mStrikethroughRuns(),
+  mBoundedParagraphRuns(model.GetBoundedParagraphRuns()),
+  mCharacterSpacingGlyphRuns(model.GetCharacterSpacingGlyphRuns()),
+  mCharacterSpacing(model.GetCharacterSpacing()),
+  mText(),
+  mGlyphsToCharacters(model.GetGlyphsToCharacters()),
+  mMarkupBackgroundColorSet(model.IsMarkupBackgroundColorSet()),
+  mUnderlineEnabled(model.IsUnderlineEnabled()),
+  mBackgroundEnabled(model.IsBackgroundEnabled()),
+  mMarkupProcessorEnabled(model.IsMarkupProcessorEnabled()),
+  mStrikethroughEnabled(model.IsStrikethroughEnabled())
+{
+  CopyBuffer(mLines, model.GetLines(), model.GetNumberOfLines());
+  CopyBuffer(mScriptRuns, model.GetScriptRuns(), model.GetNumberOfScripts());
+
+  // The glyphs and their positions. These are the elided ones if the text has been elided.
+  const Length numberOfGlyphs = model.GetNumberOfGlyphs();
+  CopyBuffer(mGlyphs, model.GetGlyphs(), numberOfGlyphs);
+  CopyBuffer(mLayout, model.GetLayout(), numberOfGlyphs);
+
+  // The color indices are set for every glyph of the text, not only for the elided ones.
+  const Length totalNumberOfGlyphs = mGlyphsToCharacters.Count();
+  CopyBuffer(mColorIndices, model.GetColorIndices(), totalNumberOfGlyphs);
+  CopyBuffer(mColors, model.GetColors(), GetNumberOfColors(mColorIndices));
+  CopyBuffer(mBackgroundColorIndices, model.GetBackgroundColorIndices(), totalNumberOfGlyphs);
+  CopyBuffer(mBackgroundColors, model.GetBackgroundColors(), GetNumberOfColors(mBackgroundColorIndices));
+
+  const Length numberOfHyphens = model.GetHyphensCount();
+  CopyBuffer(mHyphens, model.GetHyphens(), numberOfHyphens);
+  CopyBuffer(mHyphenIndices, model.GetHyphenIndices(), numberOfHyphens);
+
+  const Length numberOfUnderlineRuns = model.GetNumberOfUnderlineRuns();
+  if(0u != numberOfUnderlineRuns)
+  {
+    mUnderlineRuns.Resize(numberOfUnderlineRuns);
+    model.GetUnderlineRuns(mUnderlineRuns.Begin(), 0u, numberOfUnderlineRuns);
+  }
+
+  const Length numberOfStrikethroughRuns = model.GetNumberOfStrikethroughRuns();
+  if(0u != numberOfStrikethroughRuns)
+  {
+    mStrikethroughRuns.Resize(numberOfStrikethroughRuns);
+    model.GetStrikethroughRuns(mStrikethroughRuns.Begin(), 0u, numberOfStrikethroughRuns);
+  }
+
+  // Only the characters mapped to a glyph are read when the text is rendered.
+  Length numberOfCharacters = 0u;
+  for(Length index = 0u, count = mGlyphsToCharacters.Count(); index < count; ++index)
+  {
+    numberOfCharacters = std::max(numberOfCharacters, mGlyphsToCharacters[index] + 1u);
+  }
+  CopyBuffer(mText, model.GetTextBuffer(), numberOfCharacters);
+}
+
+ModelSnapshot::~ModelSnapshot()
+{
+}
+
+const Size& ModelSnapshot::GetControlSize() const
+{
+  return mControlSize;
+}
+
+const Size& ModelSnapshot::GetLayoutSize() const
+{
+  return mLayoutSize;
+}
+
+const Vector2& ModelSnapshot::GetScrollPosition() const
+{
+  return mScrollPosition;
+}
+
+HorizontalAlignment::Type ModelSnapshot::GetHorizontalAlignment() const
+{
+  return mHorizontalAlignment;
+}
+
+VerticalAlignment::Type ModelSnapshot::GetVerticalAlignment() const
+{
+  return mVerticalAlignment;
+}
+
+DevelText::VerticalLineAlignment::Type ModelSnapshot::GetVerticalLineAlignment() const
+{
+  return mVerticalLineAlignment;
+}
+
+DevelText::EllipsisPosition::Type ModelSnapshot::GetEllipsisPosition() const
+{
+  return mEllipsisPosition;
+}
+
+bool ModelSnapshot::IsTextElideEnabled() const
+{
+  // The glyphs are already elided.
+  return false;
+}
+
+Length ModelSnapshot::GetNumberOfLines() const
+{
+  return mLines.Count();
+}
+
+const LineRun* const ModelSnapshot::GetLines() const
+{
+  return mLines.Begin();
+}
+
+Length ModelSnapshot::GetNumberOfScripts() const
+{
+  return mScriptRuns.Count();
+}
+
+const ScriptRun* const ModelSnapshot::GetScriptRuns() const
+{
+  return mScriptRuns.Begin();
+}
+
+Length ModelSnapshot::GetNumberOfGlyphs() const
+{
+  return mGlyphs.Count();
+}
+
+GlyphIndex ModelSnapshot::GetStartIndexOfElidedGlyphs() const
+{
+  return mStartIndexOfElidedGlyphs;
+}
+
+GlyphIndex ModelSnapshot::GetEndIndexOfElidedGlyphs() const
+{
+  return mEndIndexOfElidedGlyphs;
+}
+
+GlyphIndex ModelSnapshot::GetFirstMiddleIndexOfElidedGlyphs() const
+{
+  return mFirstMiddleIndexOfElidedGlyphs;
+}
+
+GlyphIndex ModelSnapshot::GetSecondMiddleIndexOfElidedGlyphs() const
+{
+  return mSecondMiddleIndexOfElidedGlyphs;
+}
+
+const GlyphInfo* const ModelSnapshot::GetGlyphs() const
+{
+  return mGlyphs.Begin();
+}
+
+const Vector2* const ModelSnapshot::GetLayout() const
+{
+  return mLayout.Begin();
+}
+
+const Vector4* const ModelSnapshot::GetColors() const
+{
+  return mColors.Begin();
+}
+
+const ColorIndex* const ModelSnapshot::GetColorIndices() const
+{
+  return mColorIndices.Begin();
+}
+
+const Vector4* const ModelSnapshot::GetBackgroundColors() const
+{
+  return mBackgroundColors.Begin();
+}
+
+const ColorIndex* const ModelSnapshot::GetBackgroundColorIndices() const
+{
+  return mBackgroundColorIndices.Begin();
+}
+
+bool const ModelSnapshot::IsMarkupBackgroundColorSet() const
+{
+  return mMarkupBackgroundColorSet;
+}
+
+const Vector4& ModelSnapshot::GetDefaultColor() const
+{
+  return mDefaultColor;
+}
+
+const Vector2& ModelSnapshot::GetShadowOffset() const
+{
+  return mShadowOffset;
+}
+
+const Vector4& ModelSnapshot::GetShadowColor() const
+{
+  return mShadowColor;
+}
+
+const float& ModelSnapshot::GetShadowBlurRadius() const
+{
+  return mShadowBlurRadius;
+}
+
+const Vector4& ModelSnapshot::GetUnderlineColor() const
+{
+  return mUnderlineColor;
+}
+
+bool ModelSnapshot::IsUnderlineEnabled() const
+{
+  return mUnderlineEnabled;
+}
+
+float ModelSnapshot::GetUnderlineHeight() const
+{
+  return mUnderlineHeight;
+}
+
+Text::Underline::Type ModelSnapshot::GetUnderlineType() const
+{
+  return mUnderlineType;
+}
+
+float ModelSnapshot::GetDashedUnderlineWidth() const
+{
+  return mDashedUnderlineWidth;
+}
+
+float ModelSnapshot::GetDashedUnderlineGap() const
+{
+  return mDashedUnderlineGap;
+}
+
+Length ModelSnapshot::GetNumberOfUnderlineRuns() const
+{
+  return mUnderlineRuns.Count();
+}
+
+void ModelSnapshot::GetUnderlineRuns(UnderlinedGlyphRun* underlineRuns, UnderlineRunIndex index, Length numberOfRuns) const
+{
+  memcpy(underlineRuns, mUnderlineRuns.Begin() + index, numberOfRuns * sizeof(UnderlinedGlyphRun));
+}
+
+const Vector4& ModelSnapshot::GetOutlineColor() const
+{
+  return mOutlineColor;
+}
+
+uint16_t ModelSnapshot::GetOutlineWidth() const
+{
+  return mOutlineWidth;
+}
+
+const Vector4& ModelSnapshot::GetBackgroundColor() const
+{
+  return mBackgroundColor;
+}
+
+bool ModelSnapshot::IsBackgroundEnabled() const
+{
+  return mBackgroundEnabled;
+}
+
+bool ModelSnapshot::IsMarkupProcessorEnabled() const
+{
+  return mMarkupProcessorEnabled;
+}
+
+const GlyphInfo* ModelSnapshot::GetHyphens() const
+{
+  return mHyphens.Begin();
+}
+
+const Length* ModelSnapshot::GetHyphenIndices() const
+{
+  return mHyphenIndices.Begin();
+}
+
+Length ModelSnapshot::GetHyphensCount() const
+{
+  return mHyphens.Count();
+}
+
+const float ModelSnapshot::GetCharacterSpacing() const
+{
+  return mCharacterSpacing;
+}
+
+const Character* ModelSnapshot::GetTextBuffer() const
+{
+  return mText.Begin();
+}
+
+const Vector<CharacterIndex>& ModelSnapshot::GetGlyphsToCharacters() const
+{
+  return mGlyphsToCharacters;
+}
+
+float ModelSnapshot::GetStrikethroughHeight() const
+{
+  return mStrikethroughHeight;
+}
+
+const Vector4& ModelSnapshot::GetStrikethroughColor() const
+{
+  return mStrikethroughColor;
+}
+
+bool ModelSnapshot::IsStrikethroughEnabled() const
+{
+  return mStrikethroughEnabled;
+}
+
+Length ModelSnapshot::GetNumberOfStrikethroughRuns() const
+{
+  return mStrikethroughRuns.Count();
+}
+
+Length ModelSnapshot::GetNumberOfBoundedParagraphRuns() const
+{
+  return mBoundedParagraphRuns.Count();
+}
+
+const Vector<BoundedParagraphRun>& ModelSnapshot::GetBoundedParagraphRuns() const
+{
+  return mBoundedParagraphRuns;
+}
+
+void ModelSnapshot::GetStrikethroughRuns(StrikethroughGlyphRun* strikethroughRuns, StrikethroughRunIndex index, Length numberOfRuns) const
+{
+  memcpy(strikethroughRuns, mStrikethroughRuns.Begin() + index, numberOfRuns * sizeof(StrikethroughGlyphRun));
+}
+
+Length ModelSnapshot::GetNumberOfCharacterSpacingGlyphRuns() const
+{
+  return mCharacterSpacingGlyphRuns.Count();
+}
+
+const Vector<CharacterSpacingGlyphRun>& ModelSnapshot::GetCharacterSpacingGlyphRuns() const
+{
+  return mCharacterSpacingGlyphRuns;
+}
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
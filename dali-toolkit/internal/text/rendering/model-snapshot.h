@@ -0,0 +1,405 @@
+#ifndef DALI_TOOLKIT_TEXT_MODEL_SNAPSHOT_H
+#define DALI_TOOLKIT_TEXT_MODEL_SNAPSHOT_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/math/vector4.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/text-model-interface.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief Copy of everything the typesetter reads from a text's model.
+ *
+ * The text's model is modified by the event thread whenever a property of the text changes.
+ * A snapshot owns its data, so the text can be rendered from it in a worker thread.
+ *
+ * The snapshot stores the glyphs as they are after the elide.
+ * It reports the elide as disabled, so a ViewModel created on top of it doesn't elide them again.
+ */
+class ModelSnapshot : public ModelInterface
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * Copies the data of the given model.
+   *
+   * @param[in] model The text's model interface. i.e. the view model of a typesetter with the glyphs already elided.
+   */
+  ModelSnapshot(const ModelInterface& model);
+
+  /**
+   * @brief Virtual destructor.
+   *
+   * It's a default destructor.
+   */
+  virtual ~ModelSnapshot();
+
+  /**
+   * @copydoc ModelInterface::GetControlSize()
+   */
+  const Size& GetControlSize() const override;
+
+  /**
+   * @copydoc ModelInterface::GetLayoutSize()
+   */
+  const Size& GetLayoutSize() const override;
+
+  /**
+   * @copydoc ModelInterface::GetScrollPosition()
+   */
+  const Vector2& GetScrollPosition() const override;
+
+  /**
+   * @copydoc ModelInterface::GetHorizontalAlignment()
+   */
+  Text::HorizontalAlignment::Type GetHorizontalAlignment() const override;
+
+  /**
+   * @copydoc ModelInterface::GetVerticalAlignment()
+   */
+  Text::VerticalAlignment::Type GetVerticalAlignment() const override;
+
+  /**
+   * @copydoc ModelInterface::GetVerticalLineAlignment()
+   */
+  DevelText::VerticalLineAlignment::Type GetVerticalLineAlignment() const override;
+
+  /**
+   * @copydoc ModelInterface::GetEllipsisPosition()
+   */
+  DevelText::EllipsisPosition::Type GetEllipsisPosition() const override;
+
+  /**
+   * @copydoc ModelInterface::IsTextElideEnabled()
+   */
+  bool IsTextElideEnabled() const override;
+
+  /**
+   * @copydoc ModelInterface::GetNumberOfLines()
+   */
+  Length GetNumberOfLines() const override;
+
+  /**
+   * @copydoc ModelInterface::GetLines()
+   */
+  const LineRun* const GetLines() const override;
+
+  /**
+   * @copydoc ModelInterface::GetNumberOfScripts()
+   */
+  Length GetNumberOfScripts() const override;
+
+  /**
+   * @copydoc ModelInterface::GetScriptRuns()
+   */
+  const ScriptRun* const GetScriptRuns() const override;
+
+  /**
+   * @copydoc ModelInterface::GetNumberOfGlyphs()
+   */
+  Length GetNumberOfGlyphs() const override;
+
+  /**
+   * @copydoc ModelInterface::GetStartIndexOfElidedGlyphs()
+   */
+  GlyphIndex GetStartIndexOfElidedGlyphs() const override;
+
+  /**
+   * @copydoc ModelInterface::GetEndIndexOfElidedGlyphs()
+   */
+  GlyphIndex GetEndIndexOfElidedGlyphs() const override;
+
+  /**
+   * @copydoc ModelInterface::GetFirstMiddleIndexOfElidedGlyphs()
+   */
+  GlyphIndex GetFirstMiddleIndexOfElidedGlyphs() const override;
+
+  /**
+   * @copydoc ModelInterface::GetSecondMiddleIndexOfElidedGlyphs()
+   */
+  GlyphIndex GetSecondMiddleIndexOfElidedGlyphs() const override;
+
+  /**
+   * @copydoc ModelInterface::GetGlyphs()
+   */
+  const GlyphInfo* const GetGlyphs() const override;
+
+  /**
+   * @copydoc ModelInterface::GetLayout()
+   */
+  const Vector2* const GetLayout() const override;
+
+  /**
+   * @copydoc ModelInterface::GetColors()
+   */
+  const Vector4* const GetColors() const override;
+
+  /**
+   * @copydoc ModelInterface::GetColorIndices()
+   */
+  const ColorIndex* const GetColorIndices() const override;
+
+  /**
+   * @copydoc ModelInterface::GetBackgroundColors()
+   */
+  const Vector4* const GetBackgroundColors() const override;
+
+  /**
+   * @copydoc ModelInterface::GetBackgroundColorIndices()
+   */
+  const ColorIndex* const GetBackgroundColorIndices() const override;
+
+  /**
+   * @copydoc ModelInterface::IsMarkupBackgroundColorSet()
+   */
+  bool const IsMarkupBackgroundColorSet() const override;
+
+  /**
+   * @copydoc ModelInterface::GetDefaultColor()
+   */
+  const Vector4& GetDefaultColor() const override;
+
+  /**
+   * @copydoc ModelInterface::GetShadowOffset()
+   */
+  const Vector2& GetShadowOffset() const override;
+
+  /**
+   * @copydoc ModelInterface::GetShadowColor()
+   */
+  const Vector4& GetShadowColor() const override;
+
+  /**
+   * @copydoc ModelInterface::GetShadowBlurRadius()
+   */
+  const float& GetShadowBlurRadius() const override;
+
+  /**
+   * @copydoc ModelInterface::GetUnderlineColor()
+   */
+  const Vector4& GetUnderlineColor() const override;
+
+  /**
+   * @copydoc ModelInterface::IsUnderlineEnabled()
+   */
+  bool IsUnderlineEnabled() const override;
+
+  /**
+   * @copydoc ModelInterface::GetUnderlineHeight()
+   */
+  float GetUnderlineHeight() const override;
+
+  /**
+   * @copydoc ModelInterface::GetUnderlineType()
+   */
+  Text::Underline::Type GetUnderlineType() const override;
+
+  /**
+   * @copydoc ModelInterface::GetDashedUnderlineWidth()
+   */
+  float GetDashedUnderlineWidth() const override;
+
+  /**
+   * @copydoc ModelInterface::GetDashedUnderlineGap()
+   */
+  float GetDashedUnderlineGap() const override;
+
+  /**
+   * @copydoc ModelInterface::GetNumberOfUnderlineRuns()
+   */
+  Length GetNumberOfUnderlineRuns() const override;
+
+  /**
+   * @copydoc ModelInterface::GetUnderlineRuns()
+   */
+  void GetUnderlineRuns(UnderlinedGlyphRun* underlineRuns, UnderlineRunIndex index, Length numberOfRuns) const override;
+
+  /**
+   * @copydoc ModelInterface::GetOutlineColor()
+   */
+  const Vector4& GetOutlineColor() const override;
+
+  /**
+   * @copydoc ModelInterface::GetOutlineWidth()
+   */
+  uint16_t GetOutlineWidth() const override;
+
+  /**
+   * @copydoc ModelInterface::GetBackgroundColor()
+   */
+  const Vector4& GetBackgroundColor() const override;
+
+  /**
+   * @copydoc ModelInterface::IsBackgroundEnabled()
+   */
+  bool IsBackgroundEnabled() const override;
+
+  /**
+   * @copydoc ModelInterface::IsMarkupProcessorEnabled()
+   */
+  bool IsMarkupProcessorEnabled() const override;
+
+  /**
+   * @copydoc ModelInterface::GetHyphens()
+   */
+  const GlyphInfo* GetHyphens() const override;
+
+  /**
+   * @copydoc ModelInterface::GetHyphenIndices()
+   */
+  const Length* GetHyphenIndices() const override;
+
+  /**
+   * @copydoc ModelInterface::GetHyphensCount()
+   */
+  Length GetHyphensCount() const override;
+
+  /**
+   * @copydoc ModelInterface::GetCharacterSpacing()
+   */
+  const float GetCharacterSpacing() const override;
+
+  /**
+   * @copydoc ModelInterface::GetTextBuffer()
+   */
+  const Character* GetTextBuffer() const override;
+
+  /**
+   * @copydoc ModelInterface::GetGlyphsToCharacters()
+   */
+  const Vector<CharacterIndex>& GetGlyphsToCharacters() const override;
+
+  /**
+   * @copydoc ModelInterface::GetStrikethroughHeight()
+   */
+  float GetStrikethroughHeight() const override;
+
+  /**
+   * @copydoc ModelInterface::GetStrikethroughColor()
+   */
+  const Vector4& GetStrikethroughColor() const override;
+
+  /**
+   * @copydoc ModelInterface::IsStrikethroughEnabled()
+   */
+  bool IsStrikethroughEnabled() const override;
+
+  /**
+   * @copydoc ModelInterface::GetNumberOfStrikethroughRuns()
+   */
+  Length GetNumberOfStrikethroughRuns() const override;
+
+  /**
+   * @copydoc ModelInterface::GetNumberOfBoundedParagraphRuns()
+   */
+  Length GetNumberOfBoundedParagraphRuns() const override;
+
+  /**
+   * @copydoc ModelInterface::GetBoundedParagraphRuns()
+   */
+  const Vector<BoundedParagraphRun>& GetBoundedParagraphRuns() const override;
+
+  /**
+   * @copydoc ModelInterface::GetStrikethroughRuns()
+   */
+  void GetStrikethroughRuns(StrikethroughGlyphRun* strikethroughRuns, StrikethroughRunIndex index, Length numberOfRuns) const override;
+
+  /**
+   * @copydoc ModelInterface::GetNumberOfCharacterSpacingGlyphRuns()
+   */
+  Length GetNumberOfCharacterSpacingGlyphRuns() const override;
+
+  /**
+   * @copydoc ModelInterface::GetCharacterSpacingGlyphRuns()
+   */
+  const Vector<CharacterSpacingGlyphRun>& GetCharacterSpacingGlyphRuns() const override;
+
+private:
+  // Undefined
+  ModelSnapshot(const ModelSnapshot& snapshot) = delete;
+
+  // Undefined
+  ModelSnapshot& operator=(const ModelSnapshot& snapshot) = delete;
+
+private:
+  Size                                   mControlSize;
+  Size                                   mLayoutSize;
+  Vector2                                mScrollPosition;
+  HorizontalAlignment::Type              mHorizontalAlignment;
+  VerticalAlignment::Type                mVerticalAlignment;
+  DevelText::VerticalLineAlignment::Type mVerticalLineAlignment;
+  DevelText::EllipsisPosition::Type      mEllipsisPosition;
+  Vector<LineRun>                        mLines;
+  Vector<ScriptRun>                      mScriptRuns;
+  Vector<GlyphInfo>                      mGlyphs;
+  Vector<Vector2>                        mLayout;
+  GlyphIndex                             mStartIndexOfElidedGlyphs;
+  GlyphIndex                             mEndIndexOfElidedGlyphs;
+  GlyphIndex                             mFirstMiddleIndexOfElidedGlyphs;
+  GlyphIndex                             mSecondMiddleIndexOfElidedGlyphs;
+  Vector<Vector4>                        mColors;
+  Vector<ColorIndex>                     mColorIndices;
+  Vector<Vector4>                        mBackgroundColors;
+  Vector<ColorIndex>                     mBackgroundColorIndices;
+  Vector4                                mDefaultColor;
+  Vector2                                mShadowOffset;
+  Vector4                                mShadowColor;
+  float                                  mShadowBlurRadius;
+  Vector4                                mUnderlineColor;
+  float                                  mUnderlineHeight;
+  Text::Underline::Type                  mUnderlineType;
+  float                                  mDashedUnderlineWidth;
+  float                                  mDashedUnderlineGap;
+  Vector<UnderlinedGlyphRun>             mUnderlineRuns;
+  Vector4                                mOutlineColor;
+  uint16_t                               mOutlineWidth;
+  Vector4                                mBackgroundColor;
+  Vector<GlyphInfo>                      mHyphens;
+  Vector<Length>                         mHyphenIndices;
+  Vector4                                mStrikethroughColor;
+  float                                  mStrikethroughHeight;
+  Vector<StrikethroughGlyphRun>          mStrikethroughRuns;
+  Vector<BoundedParagraphRun>            mBoundedParagraphRuns;
+  Vector<CharacterSpacingGlyphRun>       mCharacterSpacingGlyphRuns;
+  float                                  mCharacterSpacing;
+  Vector<Character>                      mText;
+  Vector<CharacterIndex>                 mGlyphsToCharacters;
+  bool                                   mMarkupBackgroundColorSet : 1;
+  bool                                   mUnderlineEnabled : 1;
+  bool                                   mBackgroundEnabled : 1;
+  bool                                   mMarkupProcessorEnabled : 1;
+  bool                                   mStrikethroughEnabled : 1;
+};
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_MODEL_SNAPSHOT_H
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/text/rendering/pixel-blending.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <memory.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DALI_TEXT_PIXEL_BLENDING_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define DALI_TEXT_PIXEL_BLENDING_SSE2
+#endif
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+namespace
+{
+/**
+ * The vectorized functions compute MultiplyAndNormalizeColor() with 16 bits lanes.
+ *
+ * With xy = x * y, ((xy << 15) + (xy << 7) + xy) >> 23 is equal to
+ * (xy + ((xy + (xy >> 7)) >> 8)) >> 8, where no intermediate value exceeds 16 bits.
+ * Both give the same result, so the vectorized and the scalar functions produce the same pixels.
+ */
+
+#if defined(DALI_TEXT_PIXEL_BLENDING_SSE2)
+
+/**
+ * @brief Multiplies the 16 bytes of two vectors and divides them by 255.
+ */
+inline __m128i MultiplyAndNormalizeColors(__m128i x, __m128i y)
+{
+  const __m128i zero = _mm_setzero_si128();
+
+  __m128i low  = _mm_mullo_epi16(_mm_unpacklo_epi8(x, zero), _mm_unpacklo_epi8(y, zero));
+  __m128i high = _mm_mullo_epi16(_mm_unpackhi_epi8(x, zero), _mm_unpackhi_epi8(y, zero));
+
+  low  = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 7)), 8)), 8);
+  high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 7)), 8)), 8);
+
+  return _mm_packus_epi16(low, high);
+}
+
+/**
+ * @brief Copies the value of each 32 bits lane, between [0..255], into its four bytes.
+ */
+inline __m128i BroadcastAlpha(__m128i alpha)
+{
+  alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+  return _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+}
+
+/**
+ * @brief Selects the lanes of @p a where @p mask is set, and the lanes of @p b otherwise.
+ */
+inline __m128i Select(__m128i mask, __m128i a, __m128i b)
+{
+  return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+#elif defined(DALI_TEXT_PIXEL_BLENDING_NEON)
+
+/**
+ * @brief Multiplies the 16 bytes of two vectors and divides them by 255.
+ */
+inline uint8x16_t MultiplyAndNormalizeColors(uint8x16_t x, uint8x16_t y)
+{
+  uint16x8_t low  = vmull_u8(vget_low_u8(x), vget_low_u8(y));
+  uint16x8_t high = vmull_u8(vget_high_u8(x), vget_high_u8(y));
+
+  low  = vaddq_u16(low, vshrq_n_u16(vsraq_n_u16(low, low, 7), 8));
+  high = vaddq_u16(high, vshrq_n_u16(vsraq_n_u16(high, high, 7), 8));
+
+  return vcombine_u8(vshrn_n_u16(low, 8), vshrn_n_u16(high, 8));
+}
+
+/**
+ * @brief Copies the value of each 32 bits lane, between [0..255], into its four bytes.
+ */
+inline uint32x4_t BroadcastAlpha(uint32x4_t alpha)
+{
+  return vmulq_n_u32(alpha, 0x01010101u);
+}
+
+#endif
+
+} // unnamed namespace
+
+bool IsPixelBlendingVectorized()
+{
+#if defined(DALI_TEXT_PIXEL_BLENDING_SSE2) || defined(DALI_TEXT_PIXEL_BLENDING_NEON)
+  return true;
+#else
+  return false;
+#endif
+}
+
+void FillPixels(uint32_t* pixelBuffer, uint32_t numberOfPixels, uint32_t packedColor)
+{
+  uint32_t index = 0u;
+
+#if defined(DALI_TEXT_PIXEL_BLENDING_SSE2)
+  const __m128i color = _mm_set1_epi32(static_cast<int>(packedColor));
+  for(; index + 4u <= numberOfPixels; index += 4u)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pixelBuffer + index), color);
+  }
+#elif defined(DALI_TEXT_PIXEL_BLENDING_NEON)
+  const uint32x4_t color = vdupq_n_u32(packedColor);
+  for(; index + 4u <= numberOfPixels; index += 4u)
+  {
+    vst1q_u32(pixelBuffer + index, color);
+  }
+#endif
+
+  Scalar::FillPixels(pixelBuffer + index, numberOfPixels - index, packedColor);
+}
+
+void BlendGlyphColor(uint32_t* pixelBuffer, const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t numberOfPixels, uint32_t packedColor)
+{
+  uint32_t index = 0u;
+
+  // Only the glyphs with one byte per pixel (i.e. the alpha) are vectorized.
+  if(1u == glyphPixelSize)
+  {
+#if defined(DALI_TEXT_PIXEL_BLENDING_SSE2)
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i color = _mm_set1_epi32(static_cast<int>(packedColor));
+    for(; index + 4u <= numberOfPixels; index += 4u)
+    {
+      int32_t glyphAlphas;
+      memcpy(&glyphAlphas, glyphAlphaBuffer + index, sizeof(int32_t));
+
+      const __m128i glyphAlpha   = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(glyphAlphas), zero), zero);
+      const __m128i currentColor = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixelBuffer + index));
+
+      // Both alphas are between [0..255], so the 16 bits max gives the 32 bits one.
+      const __m128i maxAlpha     = _mm_max_epi16(glyphAlpha, _mm_srli_epi32(currentColor, 24));
+      const __m128i blended      = MultiplyAndNormalizeColors(color, BroadcastAlpha(maxAlpha));
+      const __m128i isGlyphPixel = _mm_cmpgt_epi32(glyphAlpha, zero);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pixelBuffer + index), Select(isGlyphPixel, blended, currentColor));
+    }
+#elif defined(DALI_TEXT_PIXEL_BLENDING_NEON)
+    const uint8x16_t color = vreinterpretq_u8_u32(vdupq_n_u32(packedColor));
+    for(; index + 4u <= numberOfPixels; index += 4u)
+    {
+      uint32_t glyphAlphas;
+      memcpy(&glyphAlphas, glyphAlphaBuffer + index, sizeof(uint32_t));
+
+      const uint32x4_t glyphAlpha   = vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(glyphAlphas)))));
+      const uint32x4_t currentColor = vld1q_u32(pixelBuffer + index);
+
+      const uint32x4_t maxAlpha     = vmaxq_u32(glyphAlpha, vshrq_n_u32(currentColor, 24));
+      const uint32x4_t blended      = vreinterpretq_u32_u8(MultiplyAndNormalizeColors(color, vreinterpretq_u8_u32(BroadcastAlpha(maxAlpha))));
+      const uint32x4_t isGlyphPixel = vcgtq_u32(glyphAlpha, vdupq_n_u32(0u));
+
+      vst1q_u32(pixelBuffer + index, vbslq_u32(isGlyphPixel, blended, currentColor));
+    }
+#endif
+  }
+
+  Scalar::BlendGlyphColor(pixelBuffer + index, glyphAlphaBuffer + index * glyphPixelSize, glyphPixelSize, numberOfPixels - index, packedColor);
+}
+
+void BlendGlyphAlpha(uint8_t* pixelBuffer, const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t numberOfPixels)
+{
+  uint32_t index = 0u;
+
+  // Only the glyphs with one byte per pixel (i.e. the alpha) are vectorized.
+  if(1u == glyphPixelSize)
+  {
+#if defined(DALI_TEXT_PIXEL_BLENDING_SSE2)
+    for(; index + 16u <= numberOfPixels; index += 16u)
+    {
+      const __m128i glyphAlpha   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(glyphAlphaBuffer + index));
+      const __m128i currentAlpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixelBuffer + index));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pixelBuffer + index), _mm_max_epu8(glyphAlpha, currentAlpha));
+    }
+#elif defined(DALI_TEXT_PIXEL_BLENDING_NEON)
+    for(; index + 16u <= numberOfPixels; index += 16u)
+    {
+      vst1q_u8(pixelBuffer + index, vmaxq_u8(vld1q_u8(glyphAlphaBuffer + index), vld1q_u8(pixelBuffer + index)));
+    }
+#endif
+  }
+
+  Scalar::BlendGlyphAlpha(pixelBuffer + index, glyphAlphaBuffer + index * glyphPixelSize, glyphPixelSize, numberOfPixels - index);
+}
+
+void BlendPixelsOver(const uint32_t* topBuffer, const uint32_t* bottomBuffer, uint32_t* combinedBuffer, uint32_t numberOfPixels)
+{
+  uint32_t index = 0u;
+
+#if defined(DALI_TEXT_PIXEL_BLENDING_SSE2)
+  const __m128i zero   = _mm_setzero_si128();
+  const __m128i opaque = _mm_set1_epi32(255);
+  for(; index + 4u <= numberOfPixels; index += 4u)
+  {
+    const __m128i top    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(topBuffer + index));
+    const __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottomBuffer + index));
+
+    const __m128i topAlpha = _mm_srli_epi32(top, 24);
+    const __m128i blended  = _mm_add_epi32(top, MultiplyAndNormalizeColors(bottom, BroadcastAlpha(_mm_sub_epi32(opaque, topAlpha))));
+
+    // Copy the bottom pixel if the top one is transparent, the top pixel if it's opaque.
+    __m128i combined = Select(_mm_cmpeq_epi32(topAlpha, opaque), top, blended);
+    combined         = Select(_mm_cmpeq_epi32(topAlpha, zero), bottom, combined);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(combinedBuffer + index), combined);
+  }
+#elif defined(DALI_TEXT_PIXEL_BLENDING_NEON)
+  const uint32x4_t zero   = vdupq_n_u32(0u);
+  const uint32x4_t opaque = vdupq_n_u32(255u);
+  for(; index + 4u <= numberOfPixels; index += 4u)
+  {
+    const uint32x4_t top    = vld1q_u32(topBuffer + index);
+    const uint32x4_t bottom = vld1q_u32(bottomBuffer + index);
+
+    const uint32x4_t topAlpha = vshrq_n_u32(top, 24);
+    const uint32x4_t blended  = vaddq_u32(top, vreinterpretq_u32_u8(MultiplyAndNormalizeColors(vreinterpretq_u8_u32(bottom), vreinterpretq_u8_u32(BroadcastAlpha(vsubq_u32(opaque, topAlpha))))));
+
+    // Copy the bottom pixel if the top one is transparent, the top pixel if it's opaque.
+    uint32x4_t combined = vbslq_u32(vceqq_u32(topAlpha, opaque), top, blended);
+    combined            = vbslq_u32(vceqq_u32(topAlpha, zero), bottom, combined);
+
+    vst1q_u32(combinedBuffer + index, combined);
+  }
+#endif
+
+  Scalar::BlendPixelsOver(topBuffer + index, bottomBuffer + index, combinedBuffer + index, numberOfPixels - index);
+}
+
+namespace Scalar
+{
+void FillPixels(uint32_t* pixelBuffer, uint32_t numberOfPixels, uint32_t packedColor)
+{
+  std::fill(pixelBuffer, pixelBuffer + numberOfPixels, packedColor);
+}
+
+void BlendGlyphColor(uint32_t* pixelBuffer, const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t numberOfPixels, uint32_t packedColor)
+{
+  const uint8_t* packedInputColorBuffer = reinterpret_cast<const uint8_t*>(&packedColor);
+
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    const uint8_t alpha = *(glyphAlphaBuffer + index * glyphPixelSize);
+
+    // Copy non-transparent pixels only
+    if(alpha > 0u)
+    {
+      // Check alpha of overlapped pixels
+      uint32_t& currentColor             = *(pixelBuffer + index);
+      uint8_t*  packedCurrentColorBuffer = reinterpret_cast<uint8_t*>(&currentColor);
+
+      // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
+      // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
+      // semi-transparent gaps between joint glyphs with overlapped pixels, which could
+      // happen, for example, in the RTL text when we copy glyphs from right to left).
+      uint8_t currentAlpha = *(packedCurrentColorBuffer + 3u);
+      currentAlpha         = std::max(currentAlpha, alpha);
+      if(currentAlpha == 255)
+      {
+        // Fast-cut to avoid float type operation.
+        currentColor = packedColor;
+      }
+      else
+      {
+        // Pack the given color into a 32bit buffer. The alpha channel will be updated later for each pixel.
+        // The format is RGBA8888.
+        uint32_t packedBlendedColor       = 0u;
+        uint8_t* packedBlendedColorBuffer = reinterpret_cast<uint8_t*>(&packedBlendedColor);
+
+        // Color is pre-muliplied with its alpha.
+        *(packedBlendedColorBuffer + 3u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 3u), currentAlpha);
+        *(packedBlendedColorBuffer + 2u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 2u), currentAlpha);
+        *(packedBlendedColorBuffer + 1u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 1u), currentAlpha);
+        *(packedBlendedColorBuffer)      = MultiplyAndNormalizeColor(*packedInputColorBuffer, currentAlpha);
+
+        // Set the color into the final pixel buffer.
+        currentColor = packedBlendedColor;
+      }
+    }
+  }
+}
+
+void BlendGlyphAlpha(uint8_t* pixelBuffer, const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t numberOfPixels)
+{
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    const uint8_t alpha = *(glyphAlphaBuffer + index * glyphPixelSize);
+
+    // Copy non-transparent pixels only
+    if(alpha > 0u)
+    {
+      // Check alpha of overlapped pixels
+      uint8_t& currentAlpha = *(pixelBuffer + index);
+
+      // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
+      // overwrite a previous bigger alpha with a smaller alpha.
+      currentAlpha = std::max(currentAlpha, alpha);
+    }
+  }
+}
+
+void BlendPixelsOver(const uint32_t* topBuffer, const uint32_t* bottomBuffer, uint32_t* combinedBuffer, uint32_t numberOfPixels)
+{
+  for(uint32_t index = 0u; index < numberOfPixels; ++index)
+  {
+    // If the alpha of the pixel in either buffer is not fully opaque, blend the two pixels.
+    // Otherwise, copy pixel from topBuffer to combinedBuffer.
+    // Note : Be careful when we read & write into combinedBuffer. It can be write into same pointer.
+    const uint32_t topColor = *(topBuffer + index);
+    const uint8_t  topAlpha = static_cast<uint8_t>(topColor >> 24);
+
+    if(topAlpha == 0)
+    {
+      // Copy the pixel from bottomBuffer to combinedBuffer
+      *(combinedBuffer + index) = *(bottomBuffer + index);
+    }
+    else if(topAlpha == 255)
+    {
+      // Copy the pixel from topBuffer to combinedBuffer
+      *(combinedBuffer + index) = topColor;
+    }
+    else
+    {
+      // At least one pixel is not fully opaque
+      // "Over" blend the the pixel from topBuffer with the pixel in bottomBuffer
+      uint32_t blendedBottomBufferColor       = *(bottomBuffer + index);
+      uint8_t* blendedBottomBufferColorBuffer = reinterpret_cast<uint8_t*>(&blendedBottomBufferColor);
+
+      blendedBottomBufferColorBuffer[0] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[0], 255 - topAlpha);
+      blendedBottomBufferColorBuffer[1] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[1], 255 - topAlpha);
+      blendedBottomBufferColorBuffer[2] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[2], 255 - topAlpha);
+      blendedBottomBufferColorBuffer[3] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[3], 255 - topAlpha);
+
+      *(combinedBuffer + index) = topColor + blendedBottomBufferColor;
+    }
+  }
+}
+
+} // namespace Scalar
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,136 @@
+#ifndef DALI_TOOLKIT_TEXT_RENDERING_PIXEL_BLENDING_H
+#define DALI_TOOLKIT_TEXT_RENDERING_PIXEL_BLENDING_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Text
+{
+/**
+ * @brief Fast multiply & divide by 255. It wiil be useful when we applying alpha value in color
+ *
+ * @param x The value between [0..255]
+ * @param y The value between [0..255]
+ * @return (x*y)/255
+ */
+inline uint8_t MultiplyAndNormalizeColor(const uint8_t& x, const uint8_t& y) noexcept
+{
+  const uint32_t xy = static_cast<const uint32_t>(x) * y;
+  return ((xy << 15) + (xy << 7) + xy) >> 23;
+}
+
+/**
+ * @brief Whether the pixel blending functions use SIMD instructions (SSE2 or NEON).
+ *
+ * If not, they run the scalar version of the functions.
+ *
+ * @return true if the functions are vectorized.
+ */
+bool IsPixelBlendingVectorized();
+
+/**
+ * @brief Fills a run of RGBA8888 pixels with the given color.
+ *
+ * @param[out] pixelBuffer The pixels to fill.
+ * @param[in] numberOfPixels The number of pixels to fill.
+ * @param[in] packedColor The color packed in a 32 bits value.
+ */
+void FillPixels(uint32_t* pixelBuffer, uint32_t numberOfPixels, uint32_t packedColor);
+
+/**
+ * @brief Sets the glyph's color into a run of RGBA8888 pixels.
+ *
+ * The color is pre-multiplied by the maximum of the glyph's alpha and the pixel's alpha
+ * in order to avoid semi-transparent gaps between overlapped glyphs.
+ * The pixels where the glyph is transparent are not modified.
+ *
+ * @param[in,out] pixelBuffer The pixels of the final bitmap.
+ * @param[in] glyphAlphaBuffer Pointer to the alpha value of the first glyph's pixel.
+ * @param[in] glyphPixelSize The number of bytes per pixel of the glyph's bitmap.
+ * @param[in] numberOfPixels The number of pixels to blend.
+ * @param[in] packedColor The glyph's color packed in a 32 bits value.
+ */
+void BlendGlyphColor(uint32_t* pixelBuffer, const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t numberOfPixels, uint32_t packedColor);
+
+/**
+ * @brief Sets the glyph's alpha into a run of L8 pixels.
+ *
+ * Keeps the maximum of the glyph's alpha and the pixel's alpha.
+ *
+ * @param[in,out] pixelBuffer The pixels of the final bitmap.
+ * @param[in] glyphAlphaBuffer Pointer to the alpha value of the first glyph's pixel.
+ * @param[in] glyphPixelSize The number of bytes per pixel of the glyph's bitmap.
+ * @param[in] numberOfPixels The number of pixels to blend.
+ */
+void BlendGlyphAlpha(uint8_t* pixelBuffer, const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t numberOfPixels);
+
+/**
+ * @brief "Over" blends a run of pre-multiplied RGBA8888 pixels over another one.
+ *
+ * The combined buffer can be the same as the top or the bottom buffer.
+ *
+ * @param[in] topBuffer The pixels of the top layer.
+ * @param[in] bottomBuffer The pixels of the bottom layer.
+ * @param[out] combinedBuffer The blended pixels.
+ * @param[in] numberOfPixels The number of pixels to blend.
+ */
+void BlendPixelsOver(const uint32_t* topBuffer, const uint32_t* bottomBuffer, uint32_t* combinedBuffer, uint32_t numberOfPixels);
+
+/**
+ * @brief The scalar versions of the pixel blending functions.
+ *
+ * They are used to process the pixels left over by the vectorized functions,
+ * and they are the reference the vectorized functions are tested and measured against.
+ */
+namespace Scalar
+{
+/**
+ * @copydoc Dali::Toolkit::Text::FillPixels()
+ */
+void FillPixels(uint32_t* pixelBuffer, uint32_t numberOfPixels, uint32_t packedColor);
+
+/**
+ * @copydoc Dali::Toolkit::Text::BlendGlyphColor()
+ */
+void BlendGlyphColor(uint32_t* pixelBuffer, const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t numberOfPixels, uint32_t packedColor);
+
+/**
+ * @copydoc Dali::Toolkit::Text::BlendGlyphAlpha()
+ */
+void BlendGlyphAlpha(uint8_t* pixelBuffer, const uint8_t* glyphAlphaBuffer, uint32_t glyphPixelSize, uint32_t numberOfPixels);
+
+/**
+ * @copydoc Dali::Toolkit::Text::BlendPixelsOver()
+ */
+void BlendPixelsOver(const uint32_t* topBuffer, const uint32_t* bottomBuffer, uint32_t* combinedBuffer, uint32_t numberOfPixels);
+
+} // namespace Scalar
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_RENDERING_PIXEL_BLENDING_H
@@ -21,12 +21,15 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/text-abstraction/font-client.h>
 #include <dali/public-api/common/constants.h>
+#include <algorithm>
 #include <memory.h>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/text-controls/text-label-devel.h>
 #include <dali-toolkit/internal/text/glyph-metrics-helper.h>
 #include <dali-toolkit/internal/text/line-helper-functions.h>
+#include <dali-toolkit/internal/text/rendering/pixel-blending.h>
 #include <dali-toolkit/internal/text/rendering/styles/character-spacing-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/strikethrough-helper-functions.h>
 #include <dali-toolkit/internal/text/rendering/styles/underline-helper-functions.h>
@@ -43,19 +46,6 @@ namespace
 const float HALF(0.5f);
 const float ONE_AND_A_HALF(1.5f);
 
-/**
- * @brief Fast multiply & divide by 255. It wiil be useful when we applying alpha value in color
- *
- * @param x The value between [0..255]
- * @param y The value between [0..255]
- * @return (x*y)/255
- */
-inline uint8_t MultiplyAndNormalizeColor(const uint8_t& x, const uint8_t& y) noexcept
-{
-  const uint32_t xy = static_cast<const uint32_t>(x) * y;
-  return ((xy << 15) + (xy << 7) + xy) >> 23;
-}
-
 /**
  * @brief Data struct used to set the buffer of the glyph's bitmap into the final bitmap's buffer.
  */
@@ -202,49 +192,13 @@ void TypesetGlyph(GlyphData&           data,
     {
       for(int32_t lineIndex = lineIndexRangeMin; lineIndex < lineIndexRangeMax; ++lineIndex)
       {
-        for(int32_t index = indexRangeMin; index < indexRangeMax; ++index)
-        {
-          // Update the alpha channel.
-          const uint8_t alpha = *(glyphBuffer + index * glyphPixelSize + glyphAlphaIndex);
+        // Copy non-transparent pixels only, pre-multiplied by the glyph's alpha.
+        BlendGlyphColor(bitmapBuffer + xOffset + indexRangeMin,
+                        glyphBuffer + indexRangeMin * glyphPixelSize + glyphAlphaIndex,
+                        glyphPixelSize,
+                        indexRangeMax - indexRangeMin,
+                        packedInputColor);
 
-          // Copy non-transparent pixels only
-          if(alpha > 0u)
-          {
-            const int32_t xOffsetIndex = xOffset + index;
-
-            // Check alpha of overlapped pixels
-            uint32_t& currentColor             = *(bitmapBuffer + xOffsetIndex);
-            uint8_t*  packedCurrentColorBuffer = reinterpret_cast<uint8_t*>(&currentColor);
-
-            // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
-            // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
-            // semi-transparent gaps between joint glyphs with overlapped pixels, which could
-            // happen, for example, in the RTL text when we copy glyphs from right to left).
-            uint8_t currentAlpha = *(packedCurrentColorBuffer + 3u);
-            currentAlpha         = std::max(currentAlpha, alpha);
-            if(currentAlpha == 255)
-            {
-              // Fast-cut to avoid float type operation.
-              currentColor = packedInputColor;
-            }
-            else
-            {
-              // Pack the given color into a 32bit buffer. The alpha channel will be updated later for each pixel.
-              // The format is RGBA8888.
-              uint32_t packedColor       = 0u;
-              uint8_t* packedColorBuffer = reinterpret_cast<uint8_t*>(&packedColor);
-
-              // Color is pre-muliplied with its alpha.
-              *(packedColorBuffer + 3u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 3u), currentAlpha);
-              *(packedColorBuffer + 2u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 2u), currentAlpha);
-              *(packedColorBuffer + 1u) = MultiplyAndNormalizeColor(*(packedInputColorBuffer + 1u), currentAlpha);
-              *(packedColorBuffer)      = MultiplyAndNormalizeColor(*packedInputColorBuffer, currentAlpha);
-
-              // Set the color into the final pixel buffer.
-              currentColor = packedColor;
-            }
-          }
-        }
         bitmapBuffer += data.width;
         glyphBuffer += data.glyphBitmap.width * glyphPixelSize;
       }
@@ -265,26 +219,11 @@ void TypesetGlyph(GlyphData&           data,
       // Traverse the pixels of the glyph line per line.
       for(int32_t lineIndex = lineIndexRangeMin; lineIndex < lineIndexRangeMax; ++lineIndex)
       {
-        for(int32_t index = indexRangeMin; index < indexRangeMax; ++index)
-        {
-          const int32_t xOffsetIndex = xOffset + index;
-
-          // Update the alpha channel.
-          const uint8_t alpha = *(glyphBuffer + index * glyphPixelSize + glyphAlphaIndex);
-
-          // Copy non-transparent pixels only
-          if(alpha > 0u)
-          {
-            // Check alpha of overlapped pixels
-            uint8_t& currentAlpha = *(bitmapBuffer + xOffsetIndex);
-
-            // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
-            // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
-            // semi-transparent gaps between joint glyphs with overlapped pixels, which could
-            // happen, for example, in the RTL text when we copy glyphs from right to left).
-            currentAlpha = std::max(currentAlpha, alpha);
-          }
-        }
+        // Keep the bigger alpha of overlapped pixels.
+        BlendGlyphAlpha(bitmapBuffer + xOffset + indexRangeMin,
+                        glyphBuffer + indexRangeMin * glyphPixelSize + glyphAlphaIndex,
+                        glyphPixelSize,
+                        indexRangeMax - indexRangeMin);
 
         bitmapBuffer += data.width;
         glyphBuffer += data.glyphBitmap.width * glyphPixelSize;
@@ -314,8 +253,8 @@ void DrawUnderline(
 
   int32_t underlineYOffset = glyphData.verticalOffset + baseline + currentUnderlinePosition;
 
-  const uint32_t yRangeMin = underlineYOffset;
-  const uint32_t yRangeMax = std::min(bufferHeight, underlineYOffset + static_cast<uint32_t>(maxUnderlineHeight));
+  const uint32_t yRangeMin = static_cast<uint32_t>(std::max(0, underlineYOffset));
+  const uint32_t yRangeMax = static_cast<uint32_t>(std::max(0, std::min(static_cast<int32_t>(bufferHeight), underlineYOffset + static_cast<int32_t>(maxUnderlineHeight))));
   const uint32_t xRangeMin = static_cast<uint32_t>(glyphData.horizontalOffset + lineExtentLeft);
   const uint32_t xRangeMax = std::min(bufferWidth, static_cast<uint32_t>(glyphData.horizontalOffset + lineExtentRight + 1)); // Due to include last point, we add 1 here
 
@@ -399,11 +338,8 @@ void DrawUnderline(
       }
       else
       {
-        for(uint32_t x = xRangeMin; x < xRangeMax; x++)
-        {
-          // Note : this is same logic as bitmap[y][x] = underlineColor;
-          *(bitmapBuffer + x) = packedUnderlineColor;
-        }
+        // Note : this is same logic as bitmap[y][x] = underlineColor;
+        FillPixels(bitmapBuffer + xRangeMin, xRangeMax - xRangeMin, packedUnderlineColor);
       }
       bitmapBuffer += glyphData.width;
     }
@@ -418,11 +354,8 @@ void DrawUnderline(
 
       for(uint32_t y = secondYRangeMin; y < secondYRangeMax; y++)
       {
-        for(uint32_t x = xRangeMin; x < xRangeMax; x++)
-        {
-          // Note : this is same logic as bitmap[y][x] = underlineColor;
-          *(bitmapBuffer + x) = packedUnderlineColor;
-        }
+        // Note : this is same logic as bitmap[y][x] = underlineColor;
+        FillPixels(bitmapBuffer + xRangeMin, xRangeMax - xRangeMin, packedUnderlineColor);
         bitmapBuffer += glyphData.width;
       }
     }
@@ -481,11 +414,8 @@ void DrawBackgroundColor(
 
     for(int32_t y = yRangeMin; y < yRangeMax; y++)
     {
-      for(int32_t x = xRangeMin; x < xRangeMax; x++)
-      {
-        // Note : this is same logic as bitmap[y][x] = backgroundColor;
-        *(bitmapBuffer + x) = packedBackgroundColor;
-      }
+      // Note : this is same logic as bitmap[y][x] = backgroundColor;
+      FillPixels(bitmapBuffer + xRangeMin, xRangeMax - xRangeMin, packedBackgroundColor);
       bitmapBuffer += glyphData.width;
     }
   }
@@ -612,8 +542,8 @@ void DrawStrikethrough(const uint32_t&                     bufferWidth,
 {
   const Vector4& strikethroughColor = currentStrikethroughProperties.colorDefined ? currentStrikethroughProperties.color : commonStrikethroughProperties.color;
 
-  const uint32_t yRangeMin = static_cast<uint32_t>(strikethroughStartingYPosition);
-  const uint32_t yRangeMax = std::min(bufferHeight, static_cast<uint32_t>(strikethroughStartingYPosition + maxStrikethroughHeight));
+  const uint32_t yRangeMin = static_cast<uint32_t>(std::max(0, static_cast<int32_t>(strikethroughStartingYPosition)));
+  const uint32_t yRangeMax = static_cast<uint32_t>(std::max(0, std::min(static_cast<int32_t>(bufferHeight), static_cast<int32_t>(strikethroughStartingYPosition + maxStrikethroughHeight))));
   const uint32_t xRangeMin = static_cast<uint32_t>(glyphData.horizontalOffset + lineExtentLeft);
   const uint32_t xRangeMax = std::min(bufferWidth, static_cast<uint32_t>(glyphData.horizontalOffset + lineExtentRight + 1)); // Due to include last point, we add 1 here
 
@@ -653,11 +583,8 @@ void DrawStrikethrough(const uint32_t&                     bufferWidth,
 
     for(uint32_t y = yRangeMin; y < yRangeMax; y++)
     {
-      for(uint32_t x = xRangeMin; x < xRangeMax; x++)
-      {
-        // Note : this is same logic as bitmap[y][x] = strikethroughColor;
-        *(bitmapBuffer + x) = packedStrikethroughColor;
-      }
+      // Note : this is same logic as bitmap[y][x] = strikethroughColor;
+      FillPixels(bitmapBuffer + xRangeMin, xRangeMax - xRangeMin, packedStrikethroughColor);
       bitmapBuffer += glyphData.width;
     }
   }
@@ -749,57 +676,180 @@ void CombineImageBuffer(Devel::PixelBuffer& topPixelBuffer, Devel::PixelBuffer&
 
   const uint32_t bufferSizeInt = bufferWidth * bufferHeight;
 
-  uint32_t* combinedBuffer        = storeResultIntoTop ? topBuffer : bottomBuffer;
-  uint8_t*  topAlphaBufferPointer = reinterpret_cast<uint8_t*>(topBuffer) + 3;
+  uint32_t* combinedBuffer = storeResultIntoTop ? topBuffer : bottomBuffer;
 
-  for(uint32_t pixelIndex = 0; pixelIndex < bufferSizeInt; ++pixelIndex)
+  // If the alpha of the pixel in either buffer is not fully opaque, blend the two pixels.
+  // Otherwise, copy pixel from topBuffer to combinedBuffer.
+  BlendPixelsOver(topBuffer, bottomBuffer, combinedBuffer, bufferSizeInt);
+}
+
+} // namespace
+
+/**
+ * @brief The bitmaps of the glyphs and the metrics of the fonts retrieved by Typesetter::PrepareGlyphs().
+ */
+struct Typesetter::PreparedGlyphs
+{
+  /**
+   * @brief The parameters a glyph's bitmap is created with.
+   */
+  struct Key
   {
-    // If the alpha of the pixel in either buffer is not fully opaque, blend the two pixels.
-    // Otherwise, copy pixel from topBuffer to combinedBuffer.
-    // Note : Be careful when we read & write into combinedBuffer. It can be write into same pointer.
+    FontId     fontId;
+    GlyphIndex index;
+    uint32_t   width;
+    uint32_t   height;
+    int32_t    outlineWidth;
+    bool       isItalic;
+    bool       isBold;
+
+    Key(const GlyphInfo& glyphInfo, int32_t outlineWidth)
+    : fontId(glyphInfo.fontId),
+      index(glyphInfo.index),
+      width(static_cast<uint32_t>(glyphInfo.width)),
+      height(static_cast<uint32_t>(glyphInfo.height)),
+      outlineWidth(outlineWidth),
+      isItalic(glyphInfo.isItalicRequired),
+      isBold(glyphInfo.isBoldRequired)
+    {
+    }
 
-    uint8_t topAlpha = *topAlphaBufferPointer;
+    bool operator==(const Key& rhs) const
+    {
+      return (fontId == rhs.fontId) && (index == rhs.index) && (width == rhs.width) && (height == rhs.height) &&
+             (outlineWidth == rhs.outlineWidth) && (isItalic == rhs.isItalic) && (isBold == rhs.isBold);
+    }
+  };
 
-    if(topAlpha == 0)
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const noexcept
     {
-      // Copy the pixel from bottomBuffer to combinedBuffer
-      if(storeResultIntoTop)
-      {
-        *(combinedBuffer) = *(bottomBuffer);
-      }
+      std::size_t hash = std::hash<uint64_t>()((static_cast<uint64_t>(key.fontId) << 32u) | key.index);
+      hash ^= std::hash<uint64_t>()((static_cast<uint64_t>(key.width) << 32u) | key.height) + 0x9e3779b9 + (hash << 6u) + (hash >> 2u);
+      hash ^= std::hash<int32_t>()((key.outlineWidth << 2u) | (key.isItalic << 1u) | key.isBold) + 0x9e3779b9 + (hash << 6u) + (hash >> 2u);
+      return hash;
     }
-    else if(topAlpha == 255)
+  };
+
+  /**
+   * @brief The glyph's bitmap as returned by the font client.
+   */
+  struct Bitmap
+  {
+    unsigned char* buffer;
+    unsigned int   width;
+    unsigned int   height;
+    int            outlineOffsetX;
+    int            outlineOffsetY;
+    Pixel::Format  format;
+    bool           isColorEmoji;
+    bool           isColorBitmap;
+  };
+
+  ~PreparedGlyphs()
+  {
+    for(auto& item : bitmaps)
     {
-      // Copy the pixel from topBuffer to combinedBuffer
-      if(!storeResultIntoTop)
-      {
-        *(combinedBuffer) = *(topBuffer);
-      }
+      free(item.second.buffer);
     }
-    else
+  }
+
+  /**
+   * @brief Creates the bitmap of the glyph with the given outline and retrieves the metrics of its font, if not done yet.
+   *
+   * @param[in] fontClient The font client.
+   * @param[in] glyphInfo The glyph.
+   * @param[in] outlineWidth The width of the outline.
+   */
+  void Prepare(TextAbstraction::FontClient& fontClient, const GlyphInfo& glyphInfo, int32_t outlineWidth)
+  {
+    if((glyphInfo.width < Math::MACHINE_EPSILON_1000) ||
+       (glyphInfo.height < Math::MACHINE_EPSILON_1000))
     {
-      // At least one pixel is not fully opaque
-      // "Over" blend the the pixel from topBuffer with the pixel in bottomBuffer
-      uint32_t blendedBottomBufferColor       = *(bottomBuffer);
-      uint8_t* blendedBottomBufferColorBuffer = reinterpret_cast<uint8_t*>(&blendedBottomBufferColor);
+      // The glyph is not rendered.
+      return;
+    }
 
-      blendedBottomBufferColorBuffer[0] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[0], 255 - topAlpha);
-      blendedBottomBufferColorBuffer[1] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[1], 255 - topAlpha);
-      blendedBottomBufferColorBuffer[2] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[2], 255 - topAlpha);
-      blendedBottomBufferColorBuffer[3] = MultiplyAndNormalizeColor(blendedBottomBufferColorBuffer[3], 255 - topAlpha);
+    const Key key(glyphInfo, outlineWidth);
+    if(bitmaps.find(key) == bitmaps.end())
+    {
+      TextAbstraction::FontClient::GlyphBufferData glyphBitmap;
+      glyphBitmap.buffer = NULL;
+      glyphBitmap.width  = key.width; // Desired width and height.
+      glyphBitmap.height = key.height;
+
+      fontClient.CreateBitmap(glyphInfo.fontId,
+                              glyphInfo.index,
+                              glyphInfo.isItalicRequired,
+                              glyphInfo.isBoldRequired,
+                              glyphBitmap,
+                              outlineWidth);
+
+      Bitmap& bitmap        = bitmaps[key];
+      bitmap.buffer         = glyphBitmap.buffer;
+      bitmap.width          = glyphBitmap.width;
+      bitmap.height         = glyphBitmap.height;
+      bitmap.outlineOffsetX = glyphBitmap.outlineOffsetX;
+      bitmap.outlineOffsetY = glyphBitmap.outlineOffsetY;
+      bitmap.format         = glyphBitmap.format;
+      bitmap.isColorEmoji   = glyphBitmap.isColorEmoji;
+      bitmap.isColorBitmap  = glyphBitmap.isColorBitmap;
+
+      // The buffer is owned by the prepared glyphs now.
+      glyphBitmap.buffer = NULL;
+    }
 
-      *(combinedBuffer) = *(topBuffer) + blendedBottomBufferColor;
+    if(fontMetrics.find(glyphInfo.fontId) == fontMetrics.end())
+    {
+      fontClient.GetFontMetrics(glyphInfo.fontId, fontMetrics[glyphInfo.fontId]);
+    }
+  }
+
+  /**
+   * @brief Retrieves the prepared bitmap of the glyph.
+   *
+   * The buffer is still owned by the prepared glyphs, so it must not be freed.
+   *
+   * @param[in] glyphInfo The glyph.
+   * @param[in] outlineWidth The width of the outline.
+   * @param[out] glyphBitmap The glyph's bitmap. The buffer is NULL if the glyph has not been prepared.
+   */
+  void GetBitmap(const GlyphInfo& glyphInfo, int32_t outlineWidth, TextAbstraction::FontClient::GlyphBufferData& glyphBitmap) const
+  {
+    const auto it = bitmaps.find(Key(glyphInfo, outlineWidth));
+    if(it == bitmaps.end())
+    {
+      glyphBitmap.buffer = NULL;
+      return;
     }
 
-    // Increase each buffer's pointer.
-    ++combinedBuffer;
-    ++topBuffer;
-    ++bottomBuffer;
-    topAlphaBufferPointer += sizeof(uint32_t) / sizeof(uint8_t);
+    const Bitmap& bitmap       = it->second;
+    glyphBitmap.buffer         = bitmap.buffer;
+    glyphBitmap.width          = bitmap.width;
+    glyphBitmap.height         = bitmap.height;
+    glyphBitmap.outlineOffsetX = bitmap.outlineOffsetX;
+    glyphBitmap.outlineOffsetY = bitmap.outlineOffsetY;
+    glyphBitmap.format         = bitmap.format;
+    glyphBitmap.isColorEmoji   = bitmap.isColorEmoji;
+    glyphBitmap.isColorBitmap  = bitmap.isColorBitmap;
   }
-}
 
-} // namespace
+  /**
+   * @brief Retrieves the prepared metrics of the font.
+   *
+   * @param[in] fontId The font's id.
+   * @param[out] metrics The font's metrics. Zeroed if the font has not been prepared.
+   */
+  void GetFontMetrics(FontId fontId, FontMetrics& metrics) const
+  {
+    const auto it = fontMetrics.find(fontId);
+    metrics       = (it != fontMetrics.end()) ? it->second : FontMetrics();
+  }
+
+  std::unordered_map<Key, Bitmap, KeyHash> bitmaps;     ///< The glyphs' bitmaps.
+  std::unordered_map<FontId, FontMetrics>  fontMetrics; ///< The fonts' metrics.
+};
 
 TypesetterPtr Typesetter::New(const ModelInterface* const model)
 {
@@ -811,13 +861,55 @@ ViewModel* Typesetter::GetViewModel()
   return mModel;
 }
 
-PixelData Typesetter::Render(const Vector2& size, Toolkit::DevelText::TextDirection::Type textDirection, RenderBehaviour behaviour, bool ignoreHorizontalAlignment, Pixel::Format pixelFormat)
+void Typesetter::PrepareBands()
 {
-  // @todo. This initial implementation for a TextLabel has only one visible page.
-
   // Elides the text if needed.
   mModel->ElideGlyphs();
 
+  // Measures the vertical offset of the lines, the way CreateImageBuffer() moves down from line to line.
+  const Length                                 numberOfLines = mModel->GetNumberOfLines();
+  const LineRun* const                         linesBuffer   = mModel->GetLines();
+  const DevelText::VerticalLineAlignment::Type verLineAlign  = mModel->GetVerticalLineAlignment();
+
+  mLineOffsets.Resize(numberOfLines + 1u);
+
+  int32_t lineOffset    = 0;
+  float   maxLineHeight = 0.f;
+  for(LineIndex lineIndex = 0u; lineIndex < numberOfLines; ++lineIndex)
+  {
+    const LineRun& line = *(linesBuffer + lineIndex);
+
+    mLineOffsets[lineIndex] = lineOffset;
+
+    const int32_t lineAdvance = static_cast<int32_t>(line.ascender + GetPreOffsetVerticalLineAlignment(line, verLineAlign)) +
+                                static_cast<int32_t>(-line.descender + GetPostOffsetVerticalLineAlignment(line, verLineAlign));
+    if(lineAdvance < 0)
+    {
+      // The lines aren't sorted vertically, so none of them is skipped without being traversed.
+      mLineOffsets.Clear();
+      return;
+    }
+
+    lineOffset += lineAdvance;
+    maxLineHeight = std::max(maxLineHeight, line.ascender - line.descender);
+  }
+  mLineOffsets[numberOfLines] = lineOffset;
+
+  // The margin covers the glyphs exceeding the line, the outline and the shadow.
+  mLineMargin = static_cast<int32_t>(maxLineHeight + mModel->GetOutlineWidth() * 2.0f + fabsf(mModel->GetShadowOffset().y));
+}
+
+PixelData Typesetter::Render(const Vector2& size, Toolkit::DevelText::TextDirection::Type textDirection, RenderBehaviour behaviour, bool ignoreHorizontalAlignment, Pixel::Format pixelFormat)
+{
+  PrepareBands();
+
+  return RenderBand(size, textDirection, behaviour, ignoreHorizontalAlignment, pixelFormat, 0u, static_cast<uint32_t>(size.height));
+}
+
+PixelData Typesetter::RenderBand(const Vector2& size, Toolkit::DevelText::TextDirection::Type textDirection, RenderBehaviour behaviour, bool ignoreHorizontalAlignment, Pixel::Format pixelFormat, uint32_t bandOffset, uint32_t bandHeight)
+{
+  // @todo. This initial implementation for a TextLabel has only one visible page.
+
   // Retrieves the layout size.
   const Size& layoutSize = mModel->GetLayoutSize();
 
@@ -868,13 +960,16 @@ PixelData Typesetter::Render(const Vector2& size, Toolkit::DevelText::TextDirect
     }
   }
 
+  // Move the text up to the band.
+  penY -= static_cast<int32_t>(bandOffset);
+
   // Generate the image buffers of the text for each different style first,
   // then combine all of them together as one final image buffer. We try to
   // do all of these in CPU only, so that once the final texture is generated,
   // no calculation is needed in GPU during each frame.
 
   const uint32_t bufferWidth  = static_cast<uint32_t>(size.width);
-  const uint32_t bufferHeight = static_cast<uint32_t>(size.height);
+  const uint32_t bufferHeight = bandHeight;
 
   const uint32_t bufferSizeInt  = bufferWidth * bufferHeight;
   const uint32_t bufferSizeChar = sizeof(uint32_t) * bufferSizeInt;
@@ -1026,9 +1121,13 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t& bufferWidth, co
   glyphData.bitmapBuffer     = CreateTransparentImageBuffer(bufferWidth, bufferHeight, pixelFormat);
   glyphData.horizontalOffset = 0;
 
-  // Get a handle of the font client. Used to retrieve the bitmaps of the glyphs.
-  TextAbstraction::FontClient fontClient  = TextAbstraction::FontClient::Get();
-  Length                      hyphenIndex = 0;
+  // Get a handle of the font client. Used to retrieve the bitmaps of the glyphs if they are not prepared.
+  TextAbstraction::FontClient fontClient;
+  if(!mPreparedGlyphs)
+  {
+    fontClient = TextAbstraction::FontClient::Get();
+  }
+  Length hyphenIndex = 0;
 
   const Character*              textBuffer                = mModel->GetTextBuffer();
   float                         calculatedAdvance         = 0.f;
@@ -1037,9 +1136,32 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t& bufferWidth, co
 
   const DevelText::VerticalLineAlignment::Type verLineAlign = mModel->GetVerticalLineAlignment();
 
+  // Finds the lines which may intersect the buffer, e.g. the lines of a band of a tiled text, if they have been measured.
+  LineIndex firstLineIndex = 0u;
+  LineIndex endLineIndex   = modelNumberOfLines;
+  if(mLineOffsets.Count() == modelNumberOfLines + 1u)
+  {
+    const int32_t* const lineOffsets = mLineOffsets.Begin();
+
+    // The first line which ends after the top of the buffer, and the first one which begins after its bottom.
+    firstLineIndex = static_cast<LineIndex>(std::upper_bound(lineOffsets + 1u, lineOffsets + modelNumberOfLines + 1u, -verticalOffset - mLineMargin) - (lineOffsets + 1u));
+    endLineIndex   = static_cast<LineIndex>(std::lower_bound(lineOffsets, lineOffsets + modelNumberOfLines, static_cast<int32_t>(bufferHeight) - verticalOffset + mLineMargin) - lineOffsets);
+  }
+
   // Traverses the lines of the text.
-  for(LineIndex lineIndex = 0u; lineIndex < modelNumberOfLines; ++lineIndex)
+  for(LineIndex lineIndex = 0u; lineIndex < endLineIndex; ++lineIndex)
   {
+    // Jumps over the lines before the buffer. The first line is always traversed, as it adds the offset of the outline and the shadow.
+    if((1u == lineIndex) && (firstLineIndex > 1u))
+    {
+      if(firstLineIndex >= endLineIndex)
+      {
+        break;
+      }
+      glyphData.verticalOffset += mLineOffsets[firstLineIndex] - mLineOffsets[1u];
+      lineIndex = firstLineIndex;
+    }
+
     const LineRun& line = *(modelLinesBuffer + lineIndex);
 
     // Sets the horizontal offset of the line.
@@ -1073,6 +1195,16 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t& bufferWidth, co
       }
     }
 
+    // Skip the lines out of the buffer, e.g. the lines of the other bands of a tiled text.
+    // The margin covers the glyphs exceeding the line, the outline and the shadow.
+    const int32_t lineMargin = static_cast<int32_t>(line.ascender - line.descender + outlineWidth * 2.0f + fabsf(mModel->GetShadowOffset().y));
+    if((glyphData.verticalOffset - static_cast<int32_t>(line.ascender) - lineMargin >= static_cast<int32_t>(bufferHeight)) ||
+       (glyphData.verticalOffset - static_cast<int32_t>(line.descender) + lineMargin < 0))
+    {
+      glyphData.verticalOffset += static_cast<int32_t>(-line.descender + GetPostOffsetVerticalLineAlignment(line, verLineAlign));
+      continue;
+    }
+
     const bool  underlineEnabled      = mModel->IsUnderlineEnabled();
     const bool  strikethroughEnabled  = mModel->IsStrikethroughEnabled();
     const float modelCharacterSpacing = mModel->GetCharacterSpacing();
@@ -1193,7 +1325,14 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t& bufferWidth, co
       {
         // We need to fetch fresh font underline metrics
         FontMetrics fontMetrics;
-        fontClient.GetFontMetrics(glyphInfo->fontId, fontMetrics);
+        if(mPreparedGlyphs)
+        {
+          mPreparedGlyphs->GetFontMetrics(glyphInfo->fontId, fontMetrics);
+        }
+        else
+        {
+          fontClient.GetFontMetrics(glyphInfo->fontId, fontMetrics);
+        }
 
         //The currentUnderlinePosition will be used for both Underline and/or Strikethrough
         currentUnderlinePosition = FetchUnderlinePositionFromFontMetrics(fontMetrics);
@@ -1275,12 +1414,19 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t& bufferWidth, co
 
       if(style != Typesetter::STYLE_UNDERLINE && style != Typesetter::STYLE_STRIKETHROUGH)
       {
-        fontClient.CreateBitmap(glyphInfo->fontId,
-                                glyphInfo->index,
-                                glyphInfo->isItalicRequired,
-                                glyphInfo->isBoldRequired,
-                                glyphData.glyphBitmap,
-                                static_cast<int32_t>(outlineWidth));
+        if(mPreparedGlyphs)
+        {
+          mPreparedGlyphs->GetBitmap(*glyphInfo, static_cast<int32_t>(outlineWidth), glyphData.glyphBitmap);
+        }
+        else
+        {
+          fontClient.CreateBitmap(glyphInfo->fontId,
+                                  glyphInfo->index,
+                                  glyphInfo->isItalicRequired,
+                                  glyphInfo->isBoldRequired,
+                                  glyphData.glyphBitmap,
+                                  static_cast<int32_t>(outlineWidth));
+        }
       }
 
       // Sets the glyph's bitmap into the bitmap of the whole text.
@@ -1308,7 +1454,11 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer(const uint32_t& bufferWidth, co
         }
 
         // free the glyphBitmap.buffer as it is now copied into glyphData.bitmapBuffer
-        free(glyphData.glyphBitmap.buffer);
+        // A prepared bitmap is owned by mPreparedGlyphs and used again by the next passes.
+        if(!mPreparedGlyphs)
+        {
+          free(glyphData.glyphBitmap.buffer);
+        }
         glyphData.glyphBitmap.buffer = NULL;
       }
 
@@ -1432,8 +1582,43 @@ Devel::PixelBuffer Typesetter::ApplyMarkupProcessorOnPixelBuffer(Devel::PixelBuf
   return topPixelBuffer;
 }
 
+void Typesetter::PrepareGlyphs()
+{
+  mPreparedGlyphs.reset(new PreparedGlyphs());
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  // The outline and the shadow are rendered with the outline width, any other style without it.
+  const int32_t outlineWidth = static_cast<int32_t>(mModel->GetOutlineWidth());
+
+  const GlyphInfo* const glyphsBuffer   = mModel->GetGlyphs();
+  const Length           numberOfGlyphs = mModel->GetNumberOfGlyphs();
+  for(Length index = 0u; index < numberOfGlyphs; ++index)
+  {
+    mPreparedGlyphs->Prepare(fontClient, *(glyphsBuffer + index), 0);
+    if(0 != outlineWidth)
+    {
+      mPreparedGlyphs->Prepare(fontClient, *(glyphsBuffer + index), outlineWidth);
+    }
+  }
+
+  const GlyphInfo* const hyphens      = mModel->GetHyphens();
+  const Length           hyphensCount = mModel->GetHyphensCount();
+  for(Length index = 0u; index < hyphensCount; ++index)
+  {
+    mPreparedGlyphs->Prepare(fontClient, *(hyphens + index), 0);
+    if(0 != outlineWidth)
+    {
+      mPreparedGlyphs->Prepare(fontClient, *(hyphens + index), outlineWidth);
+    }
+  }
+}
+
 Typesetter::Typesetter(const ModelInterface* const model)
-: mModel(new ViewModel(model))
+: mModel(new ViewModel(model)),
+  mPreparedGlyphs(),
+  mLineOffsets(),
+  mLineMargin(0)
 {
 }
 
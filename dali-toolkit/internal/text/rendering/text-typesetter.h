@@ -22,10 +22,12 @@
 #include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/images/pixel-data.h>
 #include <dali/public-api/images/pixel.h>
 #include <dali/public-api/object/ref-object.h>
+#include <memory>
 
 namespace Dali
 {
@@ -110,7 +112,49 @@ public:
    */
   PixelData Render(const Vector2& size, Toolkit::DevelText::TextDirection::Type textDirection, RenderBehaviour behaviour = RENDER_TEXT_AND_STYLES, bool ignoreHorizontalAlignment = false, Pixel::Format pixelFormat = Pixel::RGBA8888);
 
+  /**
+   * @brief Renders a horizontal band of the text.
+   *
+   * The band has the same pixels as the rows [bandOffset, bandOffset + bandHeight) of the text rendered by Render() with the given size.
+   * It's used to render a text higher than the maximum texture size band by band, without allocating the whole image.
+   * Only the lines which intersect the band are rasterized.
+   *
+   * @note A soft shadow is blurred within the band, so it may be cut at the borders of the band.
+   * @pre PrepareBands() has been called since the text was laid out.
+   *
+   * @param[in] size The renderer size.
+   * @param[in] textDirection The direction of the text.
+   * @param[in] behaviour The behaviour of how to render the text (i.e. whether to render the text only or the styles only or both).
+   * @param[in] ignoreHorizontalAlignment Whether to ignore the horizontal alignment (i.e. always render as if HORIZONTAL_ALIGN_BEGIN).
+   * @param[in] pixelFormat The format of the pixel in the image that the text is rendered as (i.e. either Pixel::BGRA8888 or Pixel::L8).
+   * @param[in] bandOffset The vertical position of the band within the renderer size.
+   * @param[in] bandHeight The height of the band.
+   *
+   * @return A pixel data with the band of the text rendered.
+   */
+  PixelData RenderBand(const Vector2& size, Toolkit::DevelText::TextDirection::Type textDirection, RenderBehaviour behaviour, bool ignoreHorizontalAlignment, Pixel::Format pixelFormat, uint32_t bandOffset, uint32_t bandHeight);
+
+  /**
+   * @brief Elides the text and measures the vertical offset of its lines.
+   *
+   * It's done once for all the bands of the text, so RenderBand() doesn't elide the text again and only traverses the lines of its band.
+   * It must be called again whenever the text is laid out again. Render() calls it before rendering the whole text.
+   */
+  void PrepareBands();
+
+  /**
+   * @brief Retrieves in advance the bitmaps of the glyphs and the metrics of the fonts needed to render the text.
+   *
+   * The font client is not thread safe. Once the glyphs are prepared the typesetter doesn't use it,
+   * so Render() and RenderBand() can be called from a worker thread.
+   *
+   * @note It must be called from the event thread, after the text has been elided.
+   */
+  void PrepareGlyphs();
+
 private:
+  struct PreparedGlyphs;
+
   /**
    * @brief Private constructor.
    *
@@ -212,7 +256,10 @@ protected:
   virtual ~Typesetter();
 
 private:
-  ViewModel* mModel;
+  ViewModel*                      mModel;
+  std::unique_ptr<PreparedGlyphs> mPreparedGlyphs; ///< The glyphs retrieved by PrepareGlyphs(), or nullptr if the font client is used.
+  Vector<int32_t>                 mLineOffsets;    ///< The vertical offset of each line, then of the end of the text, measured by PrepareBands(). Empty if not measured.
+  int32_t                         mLineMargin;     ///< The height the glyphs, the outline and the shadow of a line may exceed it by.
 };
 
 } // namespace Text
@@ -359,6 +359,7 @@ struct Controller::Impl
     mTextFitMinSize(DEFAULT_TEXTFIT_MIN),
     mTextFitMaxSize(DEFAULT_TEXTFIT_MAX),
     mTextFitStepSize(DEFAULT_TEXTFIT_STEP),
+    mTextFitLineBreakUpdates(0u),
     mFontSizeScale(DEFAULT_FONT_SIZE_SCALE),
     mDisabledColorOpacity(DEFAULT_DISABLED_COLOR_OPACITY),
     mFontSizeScaleEnabled(true),
@@ -1019,16 +1020,17 @@ public:
 
   Shader mShaderBackground; ///< The shader for text background.
 
-  float mTextFitMinSize;               ///< Minimum Font Size for text fit. Default 10
-  float mTextFitMaxSize;               ///< Maximum Font Size for text fit. Default 100
-  float mTextFitStepSize;              ///< Step Size for font intervalse. Default 1
-  float mFontSizeScale;                ///< Scale value for Font Size. Default 1.0
-  float mDisabledColorOpacity;         ///< Color opacity when disabled.
-  bool  mFontSizeScaleEnabled : 1;     ///< Whether the font size scale is enabled.
-  bool  mTextFitEnabled : 1;           ///< Whether the text's fit is enabled.
-  bool  mTextFitChanged : 1;           ///< Whether the text fit property has changed.
-  bool  mIsLayoutDirectionChanged : 1; ///< Whether the layout has changed.
-  bool  mIsUserInteractionEnabled : 1; ///< Whether the user interaction is enabled.
+  float    mTextFitMinSize;               ///< Minimum Font Size for text fit. Default 10
+  float    mTextFitMaxSize;               ///< Maximum Font Size for text fit. Default 100
+  float    mTextFitStepSize;              ///< Step Size for font intervalse. Default 1
+  uint32_t mTextFitLineBreakUpdates;      ///< The number of point sizes checked by the last text fit search which calculated the line breaks.
+  float    mFontSizeScale;                ///< Scale value for Font Size. Default 1.0
+  float    mDisabledColorOpacity;         ///< Color opacity when disabled.
+  bool     mFontSizeScaleEnabled : 1;     ///< Whether the font size scale is enabled.
+  bool     mTextFitEnabled : 1;           ///< Whether the text's fit is enabled.
+  bool     mTextFitChanged : 1;           ///< Whether the text fit property has changed.
+  bool     mIsLayoutDirectionChanged : 1; ///< Whether the layout has changed.
+  bool     mIsUserInteractionEnabled : 1; ///< Whether the user interaction is enabled.
 
 private:
   friend ControllerImplEventHandler;
@@ -219,7 +219,19 @@ bool Controller::Relayouter::CheckForTextFit(Controller& controller, float point
   textUpdateInfo.mRequestedNumberOfCharacters = impl.mModel->mLogicalModel->mText.Count();
 
   // Make sure the model is up-to-date before layouting
-  impl.UpdateModel(onlyOnceOperations);
+  const bool lineBreaksPending = NO_OPERATION != (GET_LINE_BREAKS & impl.mOperationsPending);
+  if(impl.UpdateModel(onlyOnceOperations))
+  {
+    if(lineBreaksPending)
+    {
+      ++impl.mTextFitLineBreakUpdates;
+    }
+
+    // The characters, the scripts and the line break info don't depend on the point size
+    // and they are now calculated for the whole text. Don't calculate them again for the next probes.
+    // Fonts, glyphs and the bidirectional info (for the mirrored text to shape) are still done for each point size.
+    impl.mOperationsPending = static_cast<OperationsMask>(impl.mOperationsPending & ~(CONVERT_TO_UTF32 | GET_SCRIPTS | GET_LINE_BREAKS));
+  }
 
   DoRelayout(impl,
              Size(layoutSize.width, MAX_FLOAT),
@@ -252,7 +264,8 @@ void Controller::Relayouter::FitPointSizeforLayout(Controller& controller, const
     float pointInterval       = impl.mTextFitStepSize;
     float currentFitPointSize = impl.mFontDefaults->mFitPointSize;
 
-    model->mElideEnabled = false;
+    model->mElideEnabled          = false;
+    impl.mTextFitLineBreakUpdates = 0u;
     Vector<float> pointSizeArray;
 
     // check zero value
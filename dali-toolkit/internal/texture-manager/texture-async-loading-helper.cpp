@@ -20,6 +20,7 @@
 
 // EXTERNAL HEADERS
 #include <dali/integration-api/debug.h>
+#include <algorithm>
 
 // INTERNAL HEADERS
 #include <dali-toolkit/internal/image-loader/async-image-loader-impl.h>
@@ -35,8 +36,8 @@ namespace Internal
 extern Debug::Filter* gTextureManagerLogFilter; ///< Define at texture-manager-impl.cpp
 #endif
 
-TextureAsyncLoadingHelper::TextureAsyncLoadingHelper(TextureManager& textureManager)
-: TextureAsyncLoadingHelper(Toolkit::AsyncImageLoader::New(), textureManager, AsyncLoadingInfoContainerType())
+TextureAsyncLoadingHelper::TextureAsyncLoadingHelper(TextureManager& textureManager, const std::uint32_t& numberOfWorkers)
+: TextureAsyncLoadingHelper(Toolkit::AsyncImageLoader(Internal::AsyncImageLoader::New(numberOfWorkers).Get()), textureManager, AsyncLoadingInfoContainerType())
 {
 }
 
@@ -83,6 +84,37 @@ void TextureAsyncLoadingHelper::ApplyMask(const TextureManager::TextureId&
   mLoadingInfoContainer.back().loadId = id;
 }
 
+bool TextureAsyncLoadingHelper::Cancel(const TextureManager::TextureId& textureId)
+{
+  bool cancelled = false;
+  for(auto iter = mLoadingInfoContainer.begin(); iter != mLoadingInfoContainer.end();)
+  {
+    if(iter->textureId == textureId && GetImplementation(mLoader).Cancel(iter->loadId))
+    {
+      DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureAsyncLoadingHelper::Cancel( textureId:%d loadId:%d )\n", textureId, iter->loadId);
+      iter      = mLoadingInfoContainer.erase(iter);
+      cancelled = true;
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+  return cancelled;
+}
+
+void TextureAsyncLoadingHelper::SetPriority(const TextureManager::TextureId& textureId, const std::int32_t& priority)
+{
+  for(const auto& loadingInfo : mLoadingInfoContainer)
+  {
+    if(loadingInfo.textureId == textureId)
+    {
+      // Fails silently if a worker has already taken the task.
+      GetImplementation(mLoader).SetTaskPriority(loadingInfo.loadId, priority);
+    }
+  }
+}
+
 TextureAsyncLoadingHelper::TextureAsyncLoadingHelper(TextureAsyncLoadingHelper&& rhs)
 : TextureAsyncLoadingHelper(rhs.mLoader, rhs.mTextureManager, std::move(rhs.mLoadingInfoContainer))
 {
@@ -104,18 +136,15 @@ void TextureAsyncLoadingHelper::AsyncLoadComplete(uint32_t           id,
                                                   Devel::PixelBuffer pixelBuffer)
 {
   DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureAsyncLoadingHelper::AsyncLoadComplete( loadId :%d )\n", id);
-  if(mLoadingInfoContainer.size() >= 1u)
+  // Several workers load textures concurrently, so tasks can be completed in a different order than they were requested.
+  auto iter = std::find_if(mLoadingInfoContainer.begin(), mLoadingInfoContainer.end(), [id](const AsyncLoadingInfo& loadingInfo) { return loadingInfo.loadId == id; });
+  if(iter != mLoadingInfoContainer.end())
   {
-    AsyncLoadingInfo loadingInfo = mLoadingInfoContainer.front();
-
-    // We can assume that First Loading task comes First.
-    if(loadingInfo.loadId == id)
-    {
-      // Call TextureManager::AsyncLoadComplete
-      mTextureManager.AsyncLoadComplete(loadingInfo.textureId, pixelBuffer);
-    }
+    AsyncLoadingInfo loadingInfo = *iter;
+    mLoadingInfoContainer.erase(iter);
 
-    mLoadingInfoContainer.pop_front();
+    // Call TextureManager::AsyncLoadComplete
+    mTextureManager.AsyncLoadComplete(loadingInfo.textureId, pixelBuffer);
   }
 }
 
@@ -55,9 +55,10 @@ class TextureAsyncLoadingHelper : public ConnectionTracker
 public:
   /**
    * @brief Create an TextureAsyncLoadingHelper.
-   * @param[in] textureManager Reference to the texture manager
+   * @param[in] textureManager  Reference to the texture manager
+   * @param[in] numberOfWorkers The number of worker threads which load textures concurrently
    */
-  TextureAsyncLoadingHelper(TextureManager& textureManager);
+  TextureAsyncLoadingHelper(TextureManager& textureManager, const std::uint32_t& numberOfWorkers);
 
   /**
    * @brief Load a new frame of animated image
@@ -107,6 +108,20 @@ public:
                  const bool&                                     cropToMask,
                  const DevelAsyncImageLoader::PreMultiplyOnLoad& preMultiplyOnLoad);
 
+  /**
+   * @brief Cancel the loads of the texture which have not been started by a worker yet.
+   * @param[in] textureId TextureId of the texture whose loads should be cancelled
+   * @return True if at least one queued load was removed. No completion will be notified for the removed loads.
+   */
+  bool Cancel(const TextureManager::TextureId& textureId);
+
+  /**
+   * @brief Change the priority of the loads of the texture which have not been started by a worker yet.
+   * @param[in] textureId TextureId of the texture
+   * @param[in] priority  The new priority. Loads with a higher priority are processed first.
+   */
+  void SetPriority(const TextureManager::TextureId& textureId, const std::int32_t& priority);
+
 public:
   TextureAsyncLoadingHelper(const TextureAsyncLoadingHelper&) = delete;
   TextureAsyncLoadingHelper& operator=(const TextureAsyncLoadingHelper&) = delete;
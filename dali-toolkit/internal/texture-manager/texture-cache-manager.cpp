@@ -605,6 +605,7 @@ TextureCacheManager::TextureCacheIndex TextureCacheManager::FindCachedTexture(
           if((preMultiplyOnLoad == MultiplyOnLoad::MULTIPLY_ON_LOAD && textureInfo.preMultiplyOnLoad) || (preMultiplyOnLoad == MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY && !textureInfo.preMultiplied))
           {
             // The found Texture is a match.
+            ++mCacheStatistics.hitCount;
             return cacheIndex;
           }
         }
@@ -612,6 +613,8 @@ TextureCacheManager::TextureCacheIndex TextureCacheManager::FindCachedTexture(
     }
   }
 
+  ++mCacheStatistics.missCount;
+
   // Default to an invalid ID, in case we do not find a match.
   return INVALID_CACHE_INDEX;
 }
@@ -666,11 +669,23 @@ void TextureCacheManager::RemoveCache(const TextureCacheManager::TextureId& text
       // If loaded, we can remove the TextureInfo and the Atlas (if atlased).
       if(textureInfo.loadState == LoadState::UPLOADED)
       {
-        if(textureInfo.atlas)
+        if(mUnusedTextureIterators.find(textureId) != mUnusedTextureIterators.end())
         {
-          textureInfo.atlas.Remove(textureInfo.atlasRect);
+          // Already kept in the unused texture cache. Nothing to do.
+        }
+        else if(IsUnusedTextureCacheable(textureInfo))
+        {
+          // Keep the texture as the most recently used one. It will be removed when the cache is over the budget.
+          mUnusedTextureList.push_front(textureId);
+          mUnusedTextureIterators[textureId] = mUnusedTextureList.begin();
+          mUnusedTextureMemorySize += textureInfo.textureMemorySize;
+
+          DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::Remove(textureId:%d) Keep unused texture. unused memory:%zu / %zu\n", textureId, mUnusedTextureMemorySize, mUnusedTextureCacheBudget);
+        }
+        else
+        {
+          removeTextureInfo = true;
         }
-        removeTextureInfo = true;
       }
       else if(textureInfo.loadState == LoadState::LOADING || textureInfo.loadState == LoadState::MASK_APPLYING)
       {
@@ -683,32 +698,117 @@ void TextureCacheManager::RemoveCache(const TextureCacheManager::TextureId& text
         // In other states, we are not waiting for a load so we are safe to remove the TextureInfo data.
         removeTextureInfo = true;
       }
+    }
+  }
 
-      // If the state allows us to remove the TextureInfo data, we do so.
-      if(removeTextureInfo)
-      {
-        // If url location is BUFFER, decrease reference count of EncodedImageBuffer.
-        if(textureInfo.url.IsBufferResource())
-        {
-          RemoveEncodedImageBuffer(textureInfo.url.GetUrl());
-        }
+  // Post removal process to avoid mTextureInfoContainer reference problems.
+  if(removeTextureInfo)
+  {
+    RemoveTextureInfo(textureId, textureInfoIndex);
+  }
+  else
+  {
+    EvictUnusedTextures();
+  }
+}
 
-        // Permanently remove the textureInfo struct.
+bool TextureCacheManager::ReviveUnusedTexture(const TextureCacheManager::TextureCacheIndex& textureCacheIndex)
+{
+  const TextureId textureId = mTextureInfoContainer[textureCacheIndex.GetIndex()].textureId;
 
-        // Step 1. remove current textureId information in mTextureHashContainer.
-        RemoveHashId(textureInfo.hash, textureId);
-        // Step 2. make textureId is not using anymore. After this job, we can reuse textureId.
-        mTextureIdConverter.Remove(textureId);
-      }
+  auto iter = mUnusedTextureIterators.find(textureId);
+  if(iter == mUnusedTextureIterators.end())
+  {
+    return false;
+  }
+
+  DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::ReviveUnusedTexture(textureId:%d) url:%s\n", textureId, mTextureInfoContainer[textureCacheIndex.GetIndex()].url.GetUrl().c_str());
+
+  mUnusedTextureMemorySize -= mTextureInfoContainer[textureCacheIndex.GetIndex()].textureMemorySize;
+  mUnusedTextureList.erase(iter->second);
+  mUnusedTextureIterators.erase(iter);
+
+  return true;
+}
+
+void TextureCacheManager::SetUnusedTextureCacheBudget(const std::size_t& budget)
+{
+  mUnusedTextureCacheBudget = budget;
+  EvictUnusedTextures();
+}
+
+std::size_t TextureCacheManager::GetUnusedTextureCacheBudget() const
+{
+  return mUnusedTextureCacheBudget;
+}
+
+TextureCacheManager::CacheStatistics TextureCacheManager::GetCacheStatistics() const
+{
+  CacheStatistics statistics         = mCacheStatistics;
+  statistics.unusedTextureCount      = static_cast<std::uint32_t>(mUnusedTextureList.size());
+  statistics.unusedTextureMemorySize = mUnusedTextureMemorySize;
+  return statistics;
+}
+
+bool TextureCacheManager::IsUnusedTextureCacheable(const TextureCacheManager::TextureInfo& textureInfo) const
+{
+  // Only keep the plain uploaded texture. Atlased texture should give its rect back to the atlas,
+  // and masked texture could be matched with other mask image after the mask's textureId is reused.
+  return textureInfo.storageType == StorageType::UPLOAD_TO_TEXTURE &&
+         textureInfo.useAtlas == UseAtlas::NO_ATLAS &&
+         textureInfo.maskTextureId == INVALID_TEXTURE_ID &&
+         !textureInfo.isAnimatedImageFormat &&
+         textureInfo.textureSet &&
+         textureInfo.textureMemorySize > 0u &&
+         textureInfo.textureMemorySize <= mUnusedTextureCacheBudget;
+}
+
+void TextureCacheManager::EvictUnusedTextures()
+{
+  while(mUnusedTextureMemorySize > mUnusedTextureCacheBudget && !mUnusedTextureList.empty())
+  {
+    // The back of list is the least recently used texture.
+    TextureId         textureId  = mUnusedTextureList.back();
+    TextureCacheIndex cacheIndex = GetCacheIndexFromId(textureId);
+
+    mUnusedTextureList.pop_back();
+    mUnusedTextureIterators.erase(textureId);
+
+    if(cacheIndex != INVALID_CACHE_INDEX)
+    {
+      DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureCacheManager::EvictUnusedTextures() textureId:%d url:%s\n", textureId, mTextureInfoContainer[cacheIndex.GetIndex()].url.GetUrl().c_str());
+
+      mUnusedTextureMemorySize -= mTextureInfoContainer[cacheIndex.GetIndex()].textureMemorySize;
+      ++mCacheStatistics.evictionCount;
+      RemoveTextureInfo(textureId, cacheIndex);
     }
   }
+}
 
-  // Post removal process to avoid mTextureInfoContainer reference problems.
-  if(removeTextureInfo)
+void TextureCacheManager::RemoveTextureInfo(const TextureCacheManager::TextureId& textureId, const TextureCacheManager::TextureCacheIndex& textureCacheIndex)
+{
+  TextureInfo& textureInfo(mTextureInfoContainer[textureCacheIndex.GetIndex()]);
+
+  if(textureInfo.loadState == LoadState::UPLOADED && textureInfo.atlas)
   {
-    // Step 3. swap last data of TextureInfoContainer, and pop_back.
-    RemoveTextureInfoByIndex(mTextureInfoContainer, textureInfoIndex);
+    textureInfo.atlas.Remove(textureInfo.atlasRect);
   }
+
+  // Permanently remove the textureInfo struct.
+
+  // Step 1. remove current textureId information in mTextureHashContainer.
+  RemoveHashId(textureInfo.hash, textureId);
+  // Step 2. make textureId is not using anymore. After this job, we can reuse textureId.
+  mTextureIdConverter.Remove(textureId);
+
+  // If url location is BUFFER, decrease reference count of EncodedImageBuffer.
+  if(textureInfo.url.IsBufferResource())
+  {
+    RemoveEncodedImageBuffer(textureInfo.url.GetUrl());
+  }
+
+  // Step 3. swap last data of TextureInfoContainer, and pop_back.
+  RemoveTextureInfoByIndex(mTextureInfoContainer, textureCacheIndex);
 }
 
 void TextureCacheManager::RemoveHashId(const TextureCacheManager::TextureHash& textureHash, const TextureCacheManager::TextureId& textureId)
@@ -20,6 +20,7 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/free-list.h>
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
+#include <list>
 #include <unordered_map>
 
 // INTERNAL INCLUDES
@@ -55,6 +56,11 @@ namespace Internal
  *                           This container will use TEXTURE_CACHE_INDEX_TYPE_BUFFER
  *                           The bufferId will be used for VisualUrl. ex) enbuf://1
  *                           Note that this bufferId is not equal with textureId in mTextureInfoContainer.
+ *
+ * If an unused texture cache budget is set, uploaded textures whose reference count drops to zero
+ * are not removed immediately. They stay in mTextureInfoContainer (so FindCachedTexture can still find them)
+ * and are listed in mUnusedTextureList in least recently used order. They are removed only when
+ * the total memory size of unused textures exceeds the budget.
  */
 class TextureCacheManager
 {
@@ -78,6 +84,18 @@ public:
   using MultiplyOnLoad = TextureManagerType::MultiplyOnLoad;
   using TextureInfo    = TextureManagerType::TextureInfo;
 
+  /**
+   * @brief Statistics of the texture cache.
+   */
+  struct CacheStatistics
+  {
+    std::uint32_t hitCount{0u};                ///< The number of lookups which found a cached texture, whether it is in use or kept in the unused texture cache.
+    std::uint32_t missCount{0u};               ///< The number of lookups which found no cached texture.
+    std::uint32_t evictionCount{0u};           ///< The number of unused textures removed due to the cache budget.
+    std::uint32_t unusedTextureCount{0u};      ///< The number of unused textures currently kept in the cache.
+    std::size_t   unusedTextureMemorySize{0u}; ///< The memory size of unused textures currently kept in the cache, in bytes.
+  };
+
 public:
   /**
    * Constructor.
@@ -273,6 +291,35 @@ public:
    */
   void RemoveCache(const TextureCacheManager::TextureId& textureId);
 
+  /**
+   * @brief Notify that a texture found by FindCachedTexture is requested again.
+   * If the texture was kept only by the unused texture cache, it is taken out of the LRU list.
+   * @note This API doesn't change the reference count of the texture.
+   *
+   * @param[in] textureCacheIndex Index of the cached texture.
+   * @return True if the texture was kept only by the unused texture cache.
+   */
+  bool ReviveUnusedTexture(const TextureCacheManager::TextureCacheIndex& textureCacheIndex);
+
+  /**
+   * @brief Set the maximum memory size of textures which are kept in the cache without any reference.
+   * If the unused textures already exceed the new budget, least recently used textures are removed.
+   * @param[in] budget The budget in bytes. 0 means unused textures are removed immediately.
+   */
+  void SetUnusedTextureCacheBudget(const std::size_t& budget);
+
+  /**
+   * @brief Get the maximum memory size of textures which are kept in the cache without any reference.
+   * @return The budget in bytes.
+   */
+  std::size_t GetUnusedTextureCacheBudget() const;
+
+  /**
+   * @brief Get the statistics of the unused texture cache.
+   * @return The statistics.
+   */
+  TextureCacheManager::CacheStatistics GetCacheStatistics() const;
+
 public:
   /**
    * @brief Get TextureInfo as TextureCacheIndex.
@@ -342,6 +389,9 @@ private:
   typedef std::vector<TextureCacheManager::ExternalTextureInfo>                                             ExternalTextureInfoContainerType;    ///< The container type used to manage the life-cycle and caching of ExternalTexture url
   typedef std::vector<TextureCacheManager::EncodedImageBufferInfo>                                          EncodedImageBufferInfoContainerType; ///< The container type used to manage the life-cycle and caching of EncodedImageBuffer url
 
+  typedef std::list<TextureCacheManager::TextureId>                                           UnusedTextureListType;        ///< The container type used to keep unused textures in least recently used order. The front is the most recently used.
+  typedef std::unordered_map<TextureCacheManager::TextureId, UnusedTextureListType::iterator> UnusedTextureIteratorMapType; ///< The container type used to fast-find the position of unused texture in UnusedTextureListType.
+
 private:
   // Private API: only used internally
 
@@ -375,6 +425,27 @@ private:
    */
   void RemoveHashId(const TextureCacheManager::TextureHash& hash, const TextureCacheManager::TextureId& id);
 
+  /**
+   * @brief Check whether the texture can be kept in the unused texture cache after its last reference is removed.
+   * @param[in] textureInfo The texture info to check.
+   * @return True if the texture can be kept.
+   */
+  bool IsUnusedTextureCacheable(const TextureCacheManager::TextureInfo& textureInfo) const;
+
+  /**
+   * @brief Remove least recently used textures until the unused textures fit the budget.
+   */
+  void EvictUnusedTextures();
+
+  /**
+   * @brief Permanently remove the texture info which has no reference.
+   * It also release the EncodedImageBuffer and the atlas rect that the texture uses.
+   * @note The reference of texture info in container is invalidated after this call.
+   * @param[in] textureId The Id of the Texture to remove.
+   * @param[in] textureCacheIndex Index of the texture info to remove.
+   */
+  void RemoveTextureInfo(const TextureCacheManager::TextureId& textureId, const TextureCacheManager::TextureCacheIndex& textureCacheIndex);
+
   /**
    * @brief Remove data from container by the TextureCacheIndex.
    * It also valiate the TextureIdConverter internally.
@@ -405,6 +476,12 @@ private:                                            // Member Variables:
   TextureInfoContainerType            mTextureInfoContainer{}; ///< Used to manage the life-cycle and caching of Textures
   ExternalTextureInfoContainerType    mExternalTextures{};     ///< Externally provided textures
   EncodedImageBufferInfoContainerType mEncodedImageBuffers{};  ///< Externally encoded image buffer
+
+  UnusedTextureListType        mUnusedTextureList{};          ///< Textures without reference, kept in least recently used order
+  UnusedTextureIteratorMapType mUnusedTextureIterators{};     ///< Position of each unused texture in mUnusedTextureList
+  std::size_t                  mUnusedTextureMemorySize{0u};  ///< The memory size of textures in mUnusedTextureList
+  std::size_t                  mUnusedTextureCacheBudget{0u}; ///< The maximum value of mUnusedTextureMemorySize
+  CacheStatistics              mCacheStatistics{};            ///< Hit / miss / eviction counters
 };
 
 } // namespace Internal
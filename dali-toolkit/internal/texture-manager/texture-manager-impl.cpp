@@ -23,7 +23,10 @@
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel.h>
 #include <dali/public-api/rendering/geometry.h>
+#include <algorithm>
+#include <thread>
 
 // INTERNAL HEADERS
 #include <dali-toolkit/internal/texture-manager/texture-async-loading-helper.h>
@@ -34,11 +37,12 @@
 namespace
 {
 constexpr auto INITIAL_HASH_NUMBER                     = size_t{0u};
-constexpr auto DEFAULT_NUMBER_OF_LOCAL_LOADER_THREADS  = size_t{4u};
+constexpr auto MIN_NUMBER_OF_LOCAL_LOADER_THREADS      = size_t{4u};
 constexpr auto DEFAULT_NUMBER_OF_REMOTE_LOADER_THREADS = size_t{8u};
 
 constexpr auto NUMBER_OF_LOCAL_LOADER_THREADS_ENV  = "DALI_TEXTURE_LOCAL_THREADS";
 constexpr auto NUMBER_OF_REMOTE_LOADER_THREADS_ENV = "DALI_TEXTURE_REMOTE_THREADS";
+constexpr auto UNUSED_TEXTURE_CACHE_BUDGET_ENV     = "DALI_TEXTURE_UNUSED_CACHE_BUDGET";
 
 size_t GetNumberOfThreads(const char* environmentVariable, size_t defaultValue)
 {
@@ -52,7 +56,9 @@ size_t GetNumberOfThreads(const char* environmentVariable, size_t defaultValue)
 
 size_t GetNumberOfLocalLoaderThreads()
 {
-  return GetNumberOfThreads(NUMBER_OF_LOCAL_LOADER_THREADS_ENV, DEFAULT_NUMBER_OF_LOCAL_LOADER_THREADS);
+  // Local loading is CPU bound. Use all the cores by default, but keep the previous minimum number of threads.
+  const size_t numberOfCores = std::thread::hardware_concurrency();
+  return GetNumberOfThreads(NUMBER_OF_LOCAL_LOADER_THREADS_ENV, std::max(numberOfCores, MIN_NUMBER_OF_LOCAL_LOADER_THREADS));
 }
 
 size_t GetNumberOfRemoteLoaderThreads()
@@ -60,6 +66,13 @@ size_t GetNumberOfRemoteLoaderThreads()
   return GetNumberOfThreads(NUMBER_OF_REMOTE_LOADER_THREADS_ENV, DEFAULT_NUMBER_OF_REMOTE_LOADER_THREADS);
 }
 
+size_t GetDefaultUnusedTextureCacheBudget()
+{
+  using Dali::EnvironmentVariable::GetEnvironmentVariable;
+  auto budgetString = GetEnvironmentVariable(UNUSED_TEXTURE_CACHE_BUDGET_ENV);
+  return budgetString ? std::strtoul(budgetString, nullptr, 10) : 0u;
+}
+
 } // namespace
 
 namespace Dali
@@ -121,8 +134,8 @@ TextureManager::MaskingData::MaskingData()
 
 TextureManager::TextureManager()
 : mTextureCacheManager(),
-  mAsyncLocalLoaders(GetNumberOfLocalLoaderThreads(), [&]() { return TextureAsyncLoadingHelper(*this); }),
-  mAsyncRemoteLoaders(GetNumberOfRemoteLoaderThreads(), [&]() { return TextureAsyncLoadingHelper(*this); }),
+  mAsyncLocalLoader(new TextureAsyncLoadingHelper(*this, GetNumberOfLocalLoaderThreads())),
+  mAsyncRemoteLoader(new TextureAsyncLoadingHelper(*this, GetNumberOfRemoteLoaderThreads())),
   mLifecycleObservers(),
   mLoadQueue(),
   mRemoveQueue(),
@@ -130,6 +143,9 @@ TextureManager::TextureManager()
 {
   // Initialize the AddOn
   RenderingAddOn::Get();
+
+  // Unused textures are removed immediately unless the budget is given.
+  mTextureCacheManager.SetUnusedTextureCacheBudget(GetDefaultUnusedTextureCacheBudget());
 }
 
 TextureManager::~TextureManager()
@@ -543,7 +559,9 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
   // Check if the requested Texture exists in the cache.
   if(cacheIndex != INVALID_CACHE_INDEX)
   {
-    if(TextureManager::ReloadPolicy::CACHED == reloadPolicy)
+    // A texture kept by the unused texture cache has no client resource. It should be referenced whatever the reload policy is.
+    const bool revived = mTextureCacheManager.ReviveUnusedTexture(cacheIndex);
+    if(TextureManager::ReloadPolicy::CACHED == reloadPolicy || revived)
     {
       // Mark this texture being used by another client resource. Forced reload would replace the current texture
       // without the need for incrementing the reference count.
@@ -720,7 +738,7 @@ void TextureManager::Remove(const TextureManager::TextureId& textureId, TextureU
     else
     {
       // Remove textureId in CacheManager.
-      mTextureCacheManager.RemoveCache(textureId);
+      RemoveTextureCache(textureId);
     }
 
     if(observer)
@@ -739,6 +757,25 @@ void TextureManager::Remove(const TextureManager::TextureId& textureId, TextureU
   }
 }
 
+void TextureManager::SetLoadPriority(const TextureManager::TextureId& textureId, const std::int32_t& priority)
+{
+  TextureCacheIndex cacheIndex = mTextureCacheManager.GetCacheIndexFromId(textureId);
+  if(cacheIndex != INVALID_CACHE_INDEX)
+  {
+    TextureInfo& textureInfo(mTextureCacheManager[cacheIndex]);
+    if(textureInfo.loadPriority != priority)
+    {
+      textureInfo.loadPriority = priority;
+      if(!textureInfo.loadSynchronously && (textureInfo.loadState == LoadState::LOADING || textureInfo.loadState == LoadState::MASK_APPLYING))
+      {
+        // Reorder the queued load.
+        auto& loadingHelper = (textureInfo.url.IsLocalResource() || textureInfo.url.IsBufferResource()) ? mAsyncLocalLoader : mAsyncRemoteLoader;
+        loadingHelper->SetPriority(textureId, priority);
+      }
+    }
+  }
+}
+
 Devel::PixelBuffer TextureManager::LoadImageSynchronously(
   const VisualUrl&                url,
   const Dali::ImageDimensions&    desiredSize,
@@ -843,17 +880,20 @@ void TextureManager::LoadTexture(TextureManager::TextureInfo& textureInfo, Textu
   textureInfo.loadState = LoadState::LOADING;
   if(!textureInfo.loadSynchronously)
   {
-    auto& loadersContainer  = (textureInfo.url.IsLocalResource() || textureInfo.url.IsBufferResource()) ? mAsyncLocalLoaders : mAsyncRemoteLoaders;
-    auto  loadingHelperIt   = loadersContainer.GetNext();
+    auto& loadingHelper     = (textureInfo.url.IsLocalResource() || textureInfo.url.IsBufferResource()) ? mAsyncLocalLoader : mAsyncRemoteLoader;
     auto  premultiplyOnLoad = (textureInfo.preMultiplyOnLoad && textureInfo.maskTextureId == INVALID_TEXTURE_ID) ? DevelAsyncImageLoader::PreMultiplyOnLoad::ON : DevelAsyncImageLoader::PreMultiplyOnLoad::OFF;
-    DALI_ASSERT_ALWAYS(loadingHelperIt != loadersContainer.End());
     if(textureInfo.animatedImageLoading)
     {
-      loadingHelperIt->LoadAnimatedImage(textureInfo.textureId, textureInfo.animatedImageLoading, textureInfo.frameIndex, premultiplyOnLoad);
+      loadingHelper->LoadAnimatedImage(textureInfo.textureId, textureInfo.animatedImageLoading, textureInfo.frameIndex, premultiplyOnLoad);
     }
     else
     {
-      loadingHelperIt->Load(textureInfo.textureId, textureInfo.url, textureInfo.desiredSize, textureInfo.fittingMode, textureInfo.samplingMode, textureInfo.orientationCorrection, premultiplyOnLoad);
+      loadingHelper->Load(textureInfo.textureId, textureInfo.url, textureInfo.desiredSize, textureInfo.fittingMode, textureInfo.samplingMode, textureInfo.orientationCorrection, premultiplyOnLoad);
+    }
+    if(textureInfo.loadPriority != 0)
+    {
+      // If a worker has already taken the task, it was idle and the priority doesn't matter.
+      loadingHelper->SetPriority(textureInfo.textureId, textureInfo.loadPriority);
     }
   }
   ObserveTexture(textureInfo, observer);
@@ -895,11 +935,35 @@ void TextureManager::ProcessRemoveQueue()
 {
   for(const auto& textureId : mRemoveQueue)
   {
-    mTextureCacheManager.RemoveCache(textureId);
+    RemoveTextureCache(textureId);
   }
   mRemoveQueue.Clear();
 }
 
+void TextureManager::RemoveTextureCache(const TextureManager::TextureId& textureId)
+{
+  mTextureCacheManager.RemoveCache(textureId);
+
+  // The texture is still loading, but no one uses it any more.
+  TextureCacheIndex cacheIndex = mTextureCacheManager.GetCacheIndexFromId(textureId);
+  if(cacheIndex != INVALID_CACHE_INDEX)
+  {
+    TextureInfo& textureInfo(mTextureCacheManager[cacheIndex]);
+    if(textureInfo.loadState == LoadState::CANCELLED && !textureInfo.loadSynchronously)
+    {
+      auto& loadingHelper = (textureInfo.url.IsLocalResource() || textureInfo.url.IsBufferResource()) ? mAsyncLocalLoader : mAsyncRemoteLoader;
+      if(loadingHelper->Cancel(textureId))
+      {
+        DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureManager::RemoveTextureCache(textureId:%d) Drop the load before decoding. url:%s\n", textureId, textureInfo.url.GetUrl().c_str());
+
+        // No load will be completed for this texture. Remove it now.
+        textureInfo.loadState = LoadState::NOT_STARTED;
+        mTextureCacheManager.RemoveCache(textureId);
+      }
+    }
+  }
+}
+
 void TextureManager::ObserveTexture(TextureManager::TextureInfo& textureInfo,
                                     TextureUploadObserver*       observer)
 {
@@ -1108,11 +1172,9 @@ void TextureManager::ApplyMask(TextureManager::TextureInfo& textureInfo, const T
     DALI_LOG_INFO(gTextureManagerLogFilter, Debug::Concise, "TextureManager::ApplyMask(): url:%s sync:%s\n", textureInfo.url.GetUrl().c_str(), textureInfo.loadSynchronously ? "T" : "F");
 
     textureInfo.loadState   = LoadState::MASK_APPLYING;
-    auto& loadersContainer  = (textureInfo.url.IsLocalResource() || textureInfo.url.IsBufferResource()) ? mAsyncLocalLoaders : mAsyncRemoteLoaders;
-    auto  loadingHelperIt   = loadersContainer.GetNext();
+    auto& loadingHelper     = (textureInfo.url.IsLocalResource() || textureInfo.url.IsBufferResource()) ? mAsyncLocalLoader : mAsyncRemoteLoader;
     auto  premultiplyOnLoad = textureInfo.preMultiplyOnLoad ? DevelAsyncImageLoader::PreMultiplyOnLoad::ON : DevelAsyncImageLoader::PreMultiplyOnLoad::OFF;
-    DALI_ASSERT_ALWAYS(loadingHelperIt != loadersContainer.End());
-    loadingHelperIt->ApplyMask(textureInfo.textureId, pixelBuffer, maskPixelBuffer, textureInfo.scaleFactor, textureInfo.cropToMask, premultiplyOnLoad);
+    loadingHelper->ApplyMask(textureInfo.textureId, pixelBuffer, maskPixelBuffer, textureInfo.scaleFactor, textureInfo.cropToMask, premultiplyOnLoad);
   }
 }
 
@@ -1133,6 +1195,9 @@ void TextureManager::UploadTexture(Devel::PixelBuffer& pixelBuffer, TextureManag
 
     Texture texture = Texture::New(Dali::TextureType::TEXTURE_2D, pixelBuffer.GetPixelFormat(), pixelBuffer.GetWidth(), pixelBuffer.GetHeight());
 
+    // Remember the uploaded size. It is used to decide whether the texture can be kept after its last reference is removed.
+    textureInfo.textureMemorySize = pixelBuffer.GetWidth() * pixelBuffer.GetHeight() * Pixel::GetBytesPerPixel(pixelBuffer.GetPixelFormat());
+
     PixelData pixelData = Devel::PixelBuffer::Convert(pixelBuffer);
     texture.Upload(pixelData);
     if(!textureInfo.textureSet)
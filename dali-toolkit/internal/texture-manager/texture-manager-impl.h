@@ -23,10 +23,10 @@
 #include <dali/public-api/adaptor-framework/encoded-image-buffer.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/rendering/geometry.h>
+#include <memory>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/image-loader/image-atlas.h>
-#include <dali-toolkit/internal/helpers/round-robin-container-view.h>
 #include <dali-toolkit/internal/texture-manager/texture-cache-manager.h>
 #include <dali-toolkit/internal/texture-manager/texture-manager-type.h>
 #include <dali-toolkit/internal/texture-manager/texture-upload-observer.h>
@@ -240,6 +240,19 @@ public:
    */
   void Remove(const TextureManager::TextureId& textureId, TextureUploadObserver* textureObserver);
 
+  /**
+   * @brief Set the priority used to schedule the load of a Texture.
+   *
+   * Loads which have not been started yet are processed in order of priority,
+   * so visible content can be decoded before content which is off-scene or far from the viewport.
+   * The priority is kept for later (re)loads of the Texture. As the Texture may be shared,
+   * the most recently set priority is used.
+   *
+   * @param[in] textureId The ID of the Texture
+   * @param[in] priority  The load priority. Loads with a higher priority are processed first. The default is 0.
+   */
+  void SetLoadPriority(const TextureManager::TextureId& textureId, const std::int32_t& priority);
+
   /**
    * Add an observer to the object.
    * @param[in] observer The observer to add.
@@ -329,6 +342,30 @@ public:
     return mTextureCacheManager.AddEncodedImageBuffer(encodedImageBuffer);
   }
 
+  /**
+   * @copydoc TextureCacheManager::SetUnusedTextureCacheBudget
+   */
+  inline void SetUnusedTextureCacheBudget(const std::size_t& budget)
+  {
+    mTextureCacheManager.SetUnusedTextureCacheBudget(budget);
+  }
+
+  /**
+   * @copydoc TextureCacheManager::GetUnusedTextureCacheBudget
+   */
+  inline std::size_t GetUnusedTextureCacheBudget() const
+  {
+    return mTextureCacheManager.GetUnusedTextureCacheBudget();
+  }
+
+  /**
+   * @copydoc TextureCacheManager::GetCacheStatistics
+   */
+  inline TextureCacheManager::CacheStatistics GetCacheStatistics() const
+  {
+    return mTextureCacheManager.GetCacheStatistics();
+  }
+
 public: // Load Request API
   /**
    * @brief Requests an image load of the given URL.
@@ -550,6 +587,14 @@ private:
    */
   void ProcessRemoveQueue();
 
+  /**
+   * @brief Decrease the reference count of the texture in the cache.
+   * If the texture is no longer used and its load has not been started by a worker yet,
+   * the load is dropped before decoding and the texture is removed immediately.
+   * @param[in] textureId The ID of the Texture to remove.
+   */
+  void RemoveTextureCache(const TextureManager::TextureId& textureId);
+
   /**
    * Add the observer to the observer list
    * @param[in] textureInfo The TextureInfo struct associated with the texture
@@ -633,8 +678,8 @@ private:
 private:                                    // Member Variables:
   TextureCacheManager mTextureCacheManager; ///< Manager the life-cycle and caching of Textures
 
-  RoundRobinContainerView<TextureAsyncLoadingHelper> mAsyncLocalLoaders;  ///< The Asynchronous image loaders used to provide all local async loads
-  RoundRobinContainerView<TextureAsyncLoadingHelper> mAsyncRemoteLoaders; ///< The Asynchronous image loaders used to provide all remote async loads
+  std::unique_ptr<TextureAsyncLoadingHelper> mAsyncLocalLoader;  ///< The Asynchronous image loader used to provide all local async loads. Its worker threads share one queue
+  std::unique_ptr<TextureAsyncLoadingHelper> mAsyncRemoteLoader; ///< The Asynchronous image loader used to provide all remote async loads. Its worker threads share one queue
 
   Dali::Vector<LifecycleObserver*>        mLifecycleObservers; ///< Lifecycle observers of texture manager
   Dali::Vector<LoadQueueElement>          mLoadQueue;          ///< Queue of textures to load after NotifyObservers
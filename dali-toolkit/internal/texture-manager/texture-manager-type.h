@@ -261,6 +261,8 @@ struct TextureInfo
     frameIndex(frameIndex),
     frameCount(0u),
     frameInterval(0u),
+    textureMemorySize(0u),
+    loadPriority(0),
     useAtlas(useAtlas),
     loadSynchronously(loadSynchronously),
     cropToMask(cropToMask),
@@ -297,6 +299,8 @@ struct TextureInfo
   uint32_t                   frameIndex;           ///< Frame index that be loaded, in case of animated image
   uint32_t                   frameCount;           ///< Total frame count of input animated image. If this variable is not 0, this textureInfo is for animated image file format.
   uint32_t                   frameInterval;        ///< Time interval between this frame and next frame of animated image.
+  uint32_t                   textureMemorySize;    ///< The number of bytes uploaded to the GPU for this Texture. 0 if not uploaded or unknown.
+  int32_t                    loadPriority;         ///< The priority of the asynchronous load. Loads with a higher priority are processed first.
   UseAtlas                   useAtlas;             ///< USE_ATLAS if an atlas was requested.
 
   bool loadSynchronously : 1;     ///< True if synchronous loading was requested
@@ -29,6 +29,7 @@
 #include <dali/public-api/actors/layer.h>
 #include <dali/public-api/rendering/decorated-visual-renderer.h>
 #include <cstring> // for strlen()
+#include <limits>
 
 // INTERNAL HEADERS
 #include <dali-toolkit/devel-api/visuals/image-visual-actions-devel.h>
@@ -102,6 +103,9 @@ const float PIXEL_ALIGN_OFF = 0.0f;
 
 constexpr uint32_t TEXTURE_COUNT_FOR_GPU_ALPHA_MASK = 2u;
 
+constexpr int32_t DEFAULT_LOAD_PRIORITY   = 0;
+constexpr int32_t OFF_SCENE_LOAD_PRIORITY = std::numeric_limits<int32_t>::min();
+
 Geometry CreateGeometry(VisualFactoryCache& factoryCache, ImageDimensions gridSize)
 {
   Geometry geometry;
@@ -170,6 +174,7 @@ ImageVisual::ImageVisual(VisualFactoryCache&       factoryCache,
   mAtlasRect(0.0f, 0.0f, 0.0f, 0.0f),
   mAtlasRectSize(0, 0),
   mLoadState(TextureManager::LoadState::NOT_STARTED),
+  mLoadPriority(DEFAULT_LOAD_PRIORITY),
   mAttemptAtlasing(false),
   mOrientationCorrection(true)
 {
@@ -718,6 +723,12 @@ void ImageVisual::DoSetOnScene(Actor& actor)
     return;
   }
 
+  if(mTextureId != TextureManager::INVALID_TEXTURE_ID)
+  {
+    // Restore the priority if the load was deferred while off scene.
+    mFactoryCache.GetTextureManager().SetLoadPriority(mTextureId, mLoadPriority);
+  }
+
   mPlacementActor = actor;
   // Search the Actor tree to find if Layer UI behaviour set.
   Layer layer = actor.GetLayer();
@@ -772,6 +783,11 @@ void ImageVisual::DoSetOffScene(Actor& actor)
 
     mLoadState = TextureManager::LoadState::NOT_STARTED;
   }
+  else if(mTextureId != TextureManager::INVALID_TEXTURE_ID && mLoadState != TextureManager::LoadState::LOAD_FINISHED)
+  {
+    // The texture is kept, but visible images should be loaded first.
+    mFactoryCache.GetTextureManager().SetLoadPriority(mTextureId, OFF_SCENE_LOAD_PRIORITY);
+  }
 
   mPlacementActor.Reset();
 }
@@ -835,6 +851,19 @@ void ImageVisual::OnDoAction(const Dali::Property::Index actionId, const Dali::P
       LoadTexture(attemptAtlasing, mAtlasRect, mTextures, mOrientationCorrection, TextureManager::ReloadPolicy::FORCED);
       break;
     }
+    case DevelImageVisual::Action::SET_LOAD_PRIORITY:
+    {
+      int32_t loadPriority;
+      if(attributes.Get(loadPriority))
+      {
+        mLoadPriority = loadPriority;
+        if(mTextureId != TextureManager::INVALID_TEXTURE_ID && IsOnScene())
+        {
+          mFactoryCache.GetTextureManager().SetLoadPriority(mTextureId, mLoadPriority);
+        }
+      }
+      break;
+    }
   }
 }
 
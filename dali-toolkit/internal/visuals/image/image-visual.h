@@ -344,6 +344,7 @@ private:
   Vector4                                         mAtlasRect;
   Dali::ImageDimensions                           mAtlasRectSize;
   TextureManager::LoadState                       mLoadState;             ///< The texture loading state
+  int32_t                                         mLoadPriority;          ///< The priority of the texture load while on scene
   bool                                            mAttemptAtlasing;       ///< If true will attempt atlasing, otherwise create unique texture
   bool                                            mOrientationCorrection; ///< true if the image will have it's orientation corrected.
 };
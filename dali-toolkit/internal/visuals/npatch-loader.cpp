@@ -22,8 +22,10 @@
 #include <dali-toolkit/internal/visuals/rendering-addon.h>
 
 // EXTERNAL HEADERS
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/common/hash.h>
 #include <dali/integration-api/debug.h>
+#include <cstdlib>
 
 namespace Dali
 {
@@ -33,13 +35,21 @@ namespace Internal
 {
 namespace
 {
-constexpr auto INVALID_CACHE_INDEX = int32_t{-1}; ///< Invalid Cache index
-constexpr auto UNINITIALIZED_ID    = int32_t{0};  ///< uninitialised id, use to initialize ids
+constexpr auto BYTES_PER_PIXEL         = std::size_t{4u}; ///< The N patches are loaded as RGBA8888, unless they've no alpha.
+constexpr auto UNUSED_CACHE_BUDGET_ENV = "DALI_NPATCH_UNUSED_CACHE_BUDGET";
+
+std::size_t GetDefaultUnusedCacheBudget()
+{
+  using Dali::EnvironmentVariable::GetEnvironmentVariable;
+  auto budgetString = GetEnvironmentVariable(UNUSED_CACHE_BUDGET_ENV);
+  return budgetString ? std::strtoul(budgetString, nullptr, 10) : 0u;
+}
 
 } // Anonymous namespace
 
 NPatchLoader::NPatchLoader()
-: mCurrentNPatchDataId(0)
+: mCurrentNPatchDataId(0),
+  mUnusedCacheBudget(GetDefaultUnusedCacheBudget())
 {
 }
 
@@ -100,27 +110,12 @@ std::size_t NPatchLoader::Load(TextureManager& textureManager, TextureUploadObse
   return data->GetId();
 }
 
-int32_t NPatchLoader::GetCacheIndexFromId(const NPatchData::NPatchDataId id)
-{
-  const unsigned int size = mCache.size();
-
-  for(unsigned int i = 0; i < size; ++i)
-  {
-    if(mCache[i].mData->GetId() == id)
-    {
-      return i;
-    }
-  }
-
-  return INVALID_CACHE_INDEX;
-}
-
 bool NPatchLoader::GetNPatchData(const NPatchData::NPatchDataId id, const NPatchData*& data)
 {
-  int32_t cacheIndex = GetCacheIndexFromId(id);
-  if(cacheIndex != INVALID_CACHE_INDEX)
+  auto iter = mCache.find(id);
+  if(iter != mCache.end())
   {
-    data = mCache[cacheIndex].mData;
+    data = iter->second.mData;
     return true;
   }
   data = nullptr;
@@ -129,65 +124,88 @@ bool NPatchLoader::GetNPatchData(const NPatchData::NPatchDataId id, const NPatch
 
 void NPatchLoader::Remove(std::size_t id, TextureUploadObserver* textureObserver)
 {
-  int32_t cacheIndex = GetCacheIndexFromId(id);
-  if(cacheIndex == INVALID_CACHE_INDEX)
+  auto iter = mCache.find(id);
+  if(iter == mCache.end())
   {
     return;
   }
 
-  NPatchInfo& info(mCache[cacheIndex]);
+  NPatchInfo& info(iter->second);
 
   info.mData->RemoveObserver(textureObserver);
 
-  if(--info.mReferenceCount <= 0)
+  if(info.mReferenceCount > 0 && --info.mReferenceCount == 0)
   {
-    mCache.erase(mCache.begin() + cacheIndex);
+    const std::size_t memorySize = GetMemorySize(*info.mData);
+    if(info.mData->GetLoadingState() == NPatchData::LoadingState::LOAD_COMPLETE && memorySize > 0u && memorySize <= mUnusedCacheBudget)
+    {
+      // Keep the data as the most recently used one. It will be removed when the cache is over the budget.
+      mUnusedList.push_front(info.mData->GetId());
+      mUnusedIterators[info.mData->GetId()] = mUnusedList.begin();
+      mUnusedMemorySize += memorySize;
+
+      EvictUnusedNPatchData();
+    }
+    else
+    {
+      RemoveNPatchData(info.mData->GetId());
+    }
   }
 }
 
+void NPatchLoader::SetUnusedCacheBudget(std::size_t budget)
+{
+  mUnusedCacheBudget = budget;
+  EvictUnusedNPatchData();
+}
+
+std::size_t NPatchLoader::GetUnusedCacheBudget() const
+{
+  return mUnusedCacheBudget;
+}
+
 NPatchData* NPatchLoader::GetNPatchData(const VisualUrl& url, const Rect<int>& border, bool& preMultiplyOnLoad)
 {
-  std::size_t                              hash  = CalculateHash(url.GetUrl());
-  std::vector<NPatchInfo>::size_type       index = UNINITIALIZED_ID;
-  const std::vector<NPatchInfo>::size_type count = mCache.size();
+  std::size_t hash  = CalculateHash(url.GetUrl());
+  auto        range = mHashContainer.equal_range(hash);
 
   NPatchInfo* infoPtr = nullptr;
 
-  for(; index < count; ++index)
+  for(auto iter = range.first; iter != range.second; ++iter)
   {
-    if(mCache[index].mData->GetHash() == hash)
+    NPatchInfo& info = mCache.at(iter->second);
+
+    // hash match, check url as well in case of hash collision
+    if(info.mData->GetUrl().GetUrl() == url.GetUrl())
     {
-      // hash match, check url as well in case of hash collision
-      if(mCache[index].mData->GetUrl().GetUrl() == url.GetUrl())
+      // Use cached data. Need to fast-out return.
+      if(info.mData->GetBorder() == border)
       {
-        // Use cached data. Need to fast-out return.
-        if(mCache[index].mData->GetBorder() == border)
+        ReviveUnusedNPatchData(iter->second);
+        info.mReferenceCount++;
+        return info.mData;
+      }
+      else
+      {
+        if(info.mData->GetLoadingState() == NPatchData::LoadingState::LOAD_COMPLETE)
         {
-          mCache[index].mReferenceCount++;
-          return mCache[index].mData;
+          // If we only found LOAD_FAILED case, replace current data. We can reuse texture
+          if(infoPtr == nullptr || infoPtr->mData->GetLoadingState() != NPatchData::LoadingState::LOAD_COMPLETE)
+          {
+            infoPtr = &info;
+          }
         }
+        // Still loading pixel buffer. We cannot reuse cached texture yet. Skip checking
+        else if(info.mData->GetLoadingState() == NPatchData::LoadingState::LOADING)
+        {
+          continue;
+        }
+        // if LOAD_FAILED, reuse this cached NPatchData, and try to load again.
         else
         {
-          if(mCache[index].mData->GetLoadingState() == NPatchData::LoadingState::LOAD_COMPLETE)
-          {
-            // If we only found LOAD_FAILED case, replace current data. We can reuse texture
-            if(infoPtr == nullptr || infoPtr->mData->GetLoadingState() != NPatchData::LoadingState::LOAD_COMPLETE)
-            {
-              infoPtr = &mCache[index];
-            }
-          }
-          // Still loading pixel buffer. We cannot reuse cached texture yet. Skip checking
-          else if(mCache[index].mData->GetLoadingState() == NPatchData::LoadingState::LOADING)
-          {
-            continue;
-          }
-          // if LOAD_FAILED, reuse this cached NPatchData, and try to load again.
-          else
+          if(infoPtr == nullptr)
           {
-            if(infoPtr == nullptr)
-            {
-              infoPtr = &mCache[index];
-            }
+            infoPtr = &info;
           }
         }
       }
@@ -197,45 +215,43 @@ NPatchData* NPatchLoader::GetNPatchData(const VisualUrl& url, const Rect<int>& b
   // If this is new image loading, make new cache data
   if(infoPtr == nullptr)
   {
-    NPatchInfo info(new NPatchData());
-    info.mData->SetId(GenerateUniqueNPatchDataId());
-    info.mData->SetHash(hash);
-    info.mData->SetUrl(url);
-    info.mData->SetBorder(border);
-    info.mData->SetPreMultiplyOnLoad(preMultiplyOnLoad);
-
-    mCache.emplace_back(std::move(info));
-    infoPtr = &mCache.back();
+    NPatchData* data = new NPatchData();
+    data->SetId(GenerateUniqueNPatchDataId());
+    data->SetHash(hash);
+    data->SetUrl(url);
+    data->SetBorder(border);
+    data->SetPreMultiplyOnLoad(preMultiplyOnLoad);
+
+    infoPtr = &AddNPatchData(data);
   }
   // Else if LOAD_COMPLETE, Same url but border is different - use the existing texture
   else if(infoPtr->mData->GetLoadingState() == NPatchData::LoadingState::LOAD_COMPLETE)
   {
-    NPatchInfo info(new NPatchData());
+    NPatchData* data = new NPatchData();
 
-    info.mData->SetId(GenerateUniqueNPatchDataId());
-    info.mData->SetHash(hash);
-    info.mData->SetUrl(url);
-    info.mData->SetCroppedWidth(infoPtr->mData->GetCroppedWidth());
-    info.mData->SetCroppedHeight(infoPtr->mData->GetCroppedHeight());
+    data->SetId(GenerateUniqueNPatchDataId());
+    data->SetHash(hash);
+    data->SetUrl(url);
+    data->SetCroppedWidth(infoPtr->mData->GetCroppedWidth());
+    data->SetCroppedHeight(infoPtr->mData->GetCroppedHeight());
 
-    info.mData->SetTextures(infoPtr->mData->GetTextures());
+    data->SetTextures(infoPtr->mData->GetTextures());
 
     NPatchUtility::StretchRanges stretchRangesX;
-    stretchRangesX.PushBack(Uint16Pair(border.left, ((info.mData->GetCroppedWidth() >= static_cast<unsigned int>(border.right)) ? info.mData->GetCroppedHeight() - border.right : 0)));
+    stretchRangesX.PushBack(Uint16Pair(border.left, ((data->GetCroppedWidth() >= static_cast<unsigned int>(border.right)) ? data->GetCroppedHeight() - border.right : 0)));
 
     NPatchUtility::StretchRanges stretchRangesY;
-    stretchRangesY.PushBack(Uint16Pair(border.top, ((info.mData->GetCroppedWidth() >= static_cast<unsigned int>(border.bottom)) ? info.mData->GetCroppedHeight() - border.bottom : 0)));
+    stretchRangesY.PushBack(Uint16Pair(border.top, ((data->GetCroppedWidth() >= static_cast<unsigned int>(border.bottom)) ? data->GetCroppedHeight() - border.bottom : 0)));
 
-    info.mData->SetStretchPixelsX(stretchRangesX);
-    info.mData->SetStretchPixelsY(stretchRangesY);
-    info.mData->SetBorder(border);
+    data->SetStretchPixelsX(stretchRangesX);
+    data->SetStretchPixelsY(stretchRangesY);
+    data->SetBorder(border);
 
-    info.mData->SetPreMultiplyOnLoad(infoPtr->mData->IsPreMultiplied());
+    data->SetPreMultiplyOnLoad(infoPtr->mData->IsPreMultiplied());
 
-    info.mData->SetLoadingState(NPatchData::LoadingState::LOAD_COMPLETE);
+    data->SetLoadingState(NPatchData::LoadingState::LOAD_COMPLETE);
 
-    mCache.emplace_back(std::move(info));
-    infoPtr = &mCache.back();
+    infoPtr = &AddNPatchData(data);
   }
   // Else, LOAD_FAILED. just increase reference so we can reuse it.
   else
@@ -248,6 +264,64 @@ NPatchData* NPatchLoader::GetNPatchData(const VisualUrl& url, const Rect<int>& b
   return infoPtr->mData;
 }
 
+NPatchLoader::NPatchInfo& NPatchLoader::AddNPatchData(NPatchData* data)
+{
+  const NPatchData::NPatchDataId id = data->GetId();
+  mHashContainer.emplace(data->GetHash(), id);
+  return mCache.emplace(id, NPatchInfo(data)).first->second;
+}
+
+void NPatchLoader::ReviveUnusedNPatchData(const NPatchData::NPatchDataId id)
+{
+  auto iter = mUnusedIterators.find(id);
+  if(iter != mUnusedIterators.end())
+  {
+    mUnusedMemorySize -= GetMemorySize(*mCache.at(id).mData);
+    mUnusedList.erase(iter->second);
+    mUnusedIterators.erase(iter);
+  }
+}
+
+void NPatchLoader::EvictUnusedNPatchData()
+{
+  while(mUnusedMemorySize > mUnusedCacheBudget && !mUnusedList.empty())
+  {
+    // The back of list is the least recently used data.
+    const NPatchData::NPatchDataId id = mUnusedList.back();
+    mUnusedList.pop_back();
+    mUnusedIterators.erase(id);
+
+    mUnusedMemorySize -= GetMemorySize(*mCache.at(id).mData);
+    RemoveNPatchData(id);
+  }
+}
+
+void NPatchLoader::RemoveNPatchData(const NPatchData::NPatchDataId id)
+{
+  auto iter = mCache.find(id);
+  if(iter == mCache.end())
+  {
+    return;
+  }
+
+  auto range = mHashContainer.equal_range(iter->second.mData->GetHash());
+  for(auto hashIter = range.first; hashIter != range.second; ++hashIter)
+  {
+    if(hashIter->second == id)
+    {
+      mHashContainer.erase(hashIter);
+      break;
+    }
+  }
+  mCache.erase(iter);
+}
+
+std::size_t NPatchLoader::GetMemorySize(const NPatchData& data)
+{
+  // The texture shared by the data of other borders is counted for each of them.
+  return static_cast<std::size_t>(data.GetCroppedWidth()) * data.GetCroppedHeight() * BYTES_PER_PIXEL;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
@@ -20,7 +20,9 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/public-api/rendering/texture-set.h>
+#include <list>
 #include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/utility/npatch-utilities.h>
@@ -39,9 +41,11 @@ namespace Internal
  * It caches them internally for better performance; i.e. to avoid loading and
  * parsing the files over and over.
  *
- * Cache is not cleaned during app lifecycle as N patches take considerably
- * small space and there's not usually a lot of them. Usually N patches are specified in
- * toolkit default style and there is 1-2 per control that are shared across the whole application.
+ * The cached data are found by id, and by the hash of their url, without scanning the cache.
+ * A data is removed when it's no longer referenced, unless an unused cache budget is set:
+ * then the loaded data without reference are kept, in least recently used order, while their
+ * memory size fits the budget, so that the N patches of a theme aren't loaded again whenever
+ * their controls are created again.
  */
 class NPatchLoader
 {
@@ -98,11 +102,23 @@ public:
    */
   void Remove(std::size_t id, TextureUploadObserver* textureObserver);
 
+  /**
+   * @brief Set the maximum memory size of the loaded data which are kept without reference.
+   * If the unused data already exceed the new budget, the least recently used ones are removed.
+   *
+   * @param [in] budget The budget in bytes. 0 means that the data are removed as soon as they're not referenced.
+   */
+  void SetUnusedCacheBudget(std::size_t budget);
+
+  /**
+   * @brief Get the maximum memory size of the loaded data which are kept without reference.
+   * @return The budget in bytes.
+   */
+  std::size_t GetUnusedCacheBudget() const;
+
 private:
   NPatchData::NPatchDataId GenerateUniqueNPatchDataId();
 
-  int32_t GetCacheIndexFromId(const NPatchData::NPatchDataId id);
-
 private:
   /**
    * @brief Information of NPatchData
@@ -157,6 +173,33 @@ private:
    */
   NPatchData* GetNPatchData(const VisualUrl& url, const Rect<int>& border, bool& preMultiplyOnLoad);
 
+  /**
+   * @brief Add new data to the cache, with a reference.
+   * @return The cached info of the data.
+   */
+  NPatchInfo& AddNPatchData(NPatchData* data);
+
+  /**
+   * @brief Take the data out of the unused data, if it's there, when it's referenced again.
+   */
+  void ReviveUnusedNPatchData(const NPatchData::NPatchDataId id);
+
+  /**
+   * @brief Remove the least recently used data until the unused data fit the budget.
+   */
+  void EvictUnusedNPatchData();
+
+  /**
+   * @brief Permanently remove the data from the cache.
+   * @note The reference of the NPatchInfo is invalidated after this call.
+   */
+  void RemoveNPatchData(const NPatchData::NPatchDataId id);
+
+  /**
+   * @return The memory size of the texture of the data, in bytes.
+   */
+  static std::size_t GetMemorySize(const NPatchData& data);
+
 protected:
   /**
    * Undefined copy constructor.
@@ -169,8 +212,19 @@ protected:
   NPatchLoader& operator=(const NPatchLoader& rhs);
 
 private:
+  typedef std::unordered_map<NPatchData::NPatchDataId, NPatchInfo>               NPatchInfoContainerType; ///< The container type used to own the cached data, by id.
+  typedef std::unordered_multimap<std::size_t, NPatchData::NPatchDataId>         NPatchHashContainerType; ///< The container type used to find the ids of the cached data by url hash.
+  typedef std::list<NPatchData::NPatchDataId>                                    UnusedListType;          ///< The container type used to keep unused data in least recently used order. The front is the most recently used.
+  typedef std::unordered_map<NPatchData::NPatchDataId, UnusedListType::iterator> UnusedIteratorMapType;   ///< The container type used to fast-find the position of unused data in UnusedListType.
+
   NPatchData::NPatchDataId mCurrentNPatchDataId;
-  std::vector<NPatchInfo>  mCache;
+  NPatchInfoContainerType  mCache;
+  NPatchHashContainerType  mHashContainer;
+
+  UnusedListType        mUnusedList{};          ///< Loaded data without reference, kept in least recently used order
+  UnusedIteratorMapType mUnusedIterators{};     ///< Position of each unused data in mUnusedList
+  std::size_t           mUnusedMemorySize{0u};  ///< The memory size of the data in mUnusedList
+  std::size_t           mUnusedCacheBudget{0u}; ///< The maximum value of mUnusedMemorySize
 };
 
 } // namespace Internal
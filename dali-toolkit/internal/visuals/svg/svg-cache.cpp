@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "svg-cache.h"
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel.h>
+#include <algorithm>
+#include <iterator>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/svg/svg-visual.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+const std::size_t MAX_UNUSED_DOCUMENT_COUNT = 16u;               ///< The number of documents kept when no visual uses them.
+const std::size_t MAX_RASTERIZED_DATA_SIZE  = 8u * 1024u * 1024u; ///< The size of the rasterized images kept by the cache, in bytes.
+
+std::string GetDocumentKey(const VisualUrl& url, float dpi, bool synchronousLoading)
+{
+  return url.GetUrl() + ":" + std::to_string(dpi) + (synchronousLoading ? ":sync" : ":async");
+}
+
+std::string GetRasterizationKey(const std::string& documentKey, uint32_t width, uint32_t height)
+{
+  return documentKey + ":" + std::to_string(width) + "x" + std::to_string(height);
+}
+
+std::size_t GetDataSize(const PixelData& pixelData)
+{
+  return pixelData ? static_cast<std::size_t>(pixelData.GetWidth()) * pixelData.GetHeight() * Pixel::GetBytesPerPixel(pixelData.GetPixelFormat()) : 0u;
+}
+
+} // namespace
+
+SvgCache::SvgCache()
+: mDocuments(),
+  mRasterizations(),
+  mDocumentMap(),
+  mRasterizationMap(),
+  mVisualDocuments(),
+  mVisualRasterizations(),
+  mNotifyingObservers(nullptr),
+  mRasterizeThread(nullptr),
+  mRasterizedDataSize(0u)
+{
+}
+
+SvgCache::~SvgCache()
+{
+  SvgRasterizeThread::TerminateThread(mRasterizeThread);
+}
+
+SvgCache::LoadState SvgCache::Load(SvgVisual* visual, const VisualUrl& url, float dpi, bool synchronousLoading, VectorImageRenderer& vectorRenderer)
+{
+  // Release the document previously used by the visual, if any.
+  Remove(visual);
+
+  const std::string key = GetDocumentKey(url, dpi, synchronousLoading);
+
+  DocumentIterator document;
+
+  auto iter = mDocumentMap.find(key);
+  if(iter != mDocumentMap.end())
+  {
+    document = iter->second;
+
+    // Move the document to the front of the least recently used list.
+    mDocuments.splice(mDocuments.begin(), mDocuments, document);
+  }
+  else
+  {
+    mDocuments.push_front(DocumentInfo{key, VectorImageRenderer::New(), SvgTaskPtr(), ObserverList(), LoadState::LOADING, 0u, synchronousLoading});
+    document          = mDocuments.begin();
+    mDocumentMap[key] = document;
+
+    document->task = new SvgLoadingTask(document->vectorRenderer, url, dpi);
+
+    if(synchronousLoading)
+    {
+      document->task->Process();
+      document->loadState = document->task->HasSucceeded() ? LoadState::LOADED : LoadState::FAILED;
+      document->task.Reset();
+    }
+    else
+    {
+      GetRasterizeThread()->AddTask(document->task);
+    }
+  }
+
+  ++document->referenceCount;
+  mVisualDocuments[visual] = document;
+
+  if(document->loadState == LoadState::LOADING)
+  {
+    document->observers.push_back(visual);
+  }
+
+  vectorRenderer = document->vectorRenderer;
+  return document->loadState;
+}
+
+SvgCache::LoadState SvgCache::Rasterize(SvgVisual* visual, uint32_t width, uint32_t height, PixelData& pixelData)
+{
+  // Cancel the rasterization previously requested by the visual, if any.
+  RemoveRasterizationObserver(visual);
+
+  auto documentIter = mVisualDocuments.find(visual);
+  if(documentIter == mVisualDocuments.end())
+  {
+    DALI_LOG_ERROR("The svg document is not requested!\n");
+    return LoadState::FAILED;
+  }
+
+  DocumentIterator document = documentIter->second;
+  if(document->loadState == LoadState::FAILED)
+  {
+    return LoadState::FAILED;
+  }
+
+  const std::string key = GetRasterizationKey(document->key, width, height);
+
+  RasterizationIterator rasterization;
+
+  auto iter = mRasterizationMap.find(key);
+  if(iter != mRasterizationMap.end())
+  {
+    rasterization = iter->second;
+
+    // Move the image to the front of the least recently used list.
+    mRasterizations.splice(mRasterizations.begin(), mRasterizations, rasterization);
+  }
+  else
+  {
+    mRasterizations.push_front(RasterizationInfo{key, document, SvgTaskPtr(), ObserverList(), PixelData(), Texture(), LoadState::LOADING, 0u, width, height});
+    rasterization          = mRasterizations.begin();
+    mRasterizationMap[key] = rasterization;
+
+    if(document->synchronous)
+    {
+      SvgTaskPtr task = new SvgRasterizingTask(document->vectorRenderer, width, height);
+      task->Process();
+      StoreRasterizedImage(*rasterization, task->GetPixelData(), task->HasSucceeded());
+    }
+    else if(document->loadState == LoadState::LOADED)
+    {
+      AddRasterizingTask(*rasterization);
+    }
+    // Otherwise the task is added when the document is loaded.
+  }
+
+  ++rasterization->referenceCount;
+  mVisualRasterizations[visual] = rasterization;
+
+  if(rasterization->loadState == LoadState::LOADING)
+  {
+    rasterization->observers.push_back(visual);
+  }
+
+  pixelData = rasterization->pixelData;
+  return rasterization->loadState;
+}
+
+Texture SvgCache::GetTexture(SvgVisual* visual, PixelData pixelData)
+{
+  auto iter = mVisualRasterizations.find(visual);
+  if(iter != mVisualRasterizations.end() && iter->second->pixelData == pixelData)
+  {
+    RasterizationInfo& rasterization = *iter->second;
+    if(!rasterization.texture)
+    {
+      rasterization.texture = Texture::New(Dali::TextureType::TEXTURE_2D, pixelData.GetPixelFormat(), pixelData.GetWidth(), pixelData.GetHeight());
+      rasterization.texture.Upload(pixelData);
+    }
+    return rasterization.texture;
+  }
+
+  // Not a cached image, the texture is not shared.
+  Texture texture = Texture::New(Dali::TextureType::TEXTURE_2D, pixelData.GetPixelFormat(), pixelData.GetWidth(), pixelData.GetHeight());
+  texture.Upload(pixelData);
+  return texture;
+}
+
+void SvgCache::CancelRasterization(SvgVisual* visual)
+{
+  RemoveRasterizationObserver(visual);
+  Evict();
+}
+
+void SvgCache::Remove(SvgVisual* visual)
+{
+  RemoveRasterizationObserver(visual);
+
+  auto iter = mVisualDocuments.find(visual);
+  if(iter != mVisualDocuments.end())
+  {
+    DocumentIterator document = iter->second;
+    mVisualDocuments.erase(iter);
+
+    document->observers.erase(std::remove(document->observers.begin(), document->observers.end(), visual), document->observers.end());
+    --document->referenceCount;
+  }
+
+  if(mNotifyingObservers)
+  {
+    // Don't notify the visual anymore
+    std::replace(mNotifyingObservers->begin(), mNotifyingObservers->end(), visual, static_cast<SvgVisual*>(nullptr));
+  }
+
+  Evict();
+}
+
+void SvgCache::ApplyCompletedTask(SvgTaskPtr task)
+{
+  auto document = std::find_if(mDocuments.begin(), mDocuments.end(), [&task](const DocumentInfo& info) { return info.task == task; });
+  if(document != mDocuments.end())
+  {
+    ApplyLoadedDocument(document, task->HasSucceeded());
+    return;
+  }
+
+  auto rasterization = std::find_if(mRasterizations.begin(), mRasterizations.end(), [&task](const RasterizationInfo& info) { return info.task == task; });
+  if(rasterization != mRasterizations.end())
+  {
+    ApplyRasterizedImage(rasterization, task->GetPixelData(), task->HasSucceeded());
+  }
+
+  // Otherwise the result is not needed anymore.
+}
+
+SvgRasterizeThread* SvgCache::GetRasterizeThread()
+{
+  if(!mRasterizeThread)
+  {
+    mRasterizeThread = new SvgRasterizeThread(*this);
+    mRasterizeThread->Start();
+  }
+  return mRasterizeThread;
+}
+
+void SvgCache::AddRasterizingTask(RasterizationInfo& rasterization)
+{
+  rasterization.task = new SvgRasterizingTask(rasterization.document->vectorRenderer, rasterization.width, rasterization.height);
+  GetRasterizeThread()->AddTask(rasterization.task);
+}
+
+void SvgCache::StoreRasterizedImage(RasterizationInfo& rasterization, PixelData pixelData, bool success)
+{
+  rasterization.task.Reset();
+  rasterization.loadState = success ? LoadState::LOADED : LoadState::FAILED;
+  if(success)
+  {
+    rasterization.pixelData = pixelData;
+    mRasterizedDataSize += GetDataSize(pixelData);
+  }
+}
+
+void SvgCache::ApplyLoadedDocument(DocumentIterator document, bool success)
+{
+  document->task.Reset();
+  document->loadState = success ? LoadState::LOADED : LoadState::FAILED;
+
+  // Rasterize the images requested while the document was loading.
+  // If the loading failed, the waiting visuals are notified of the failure by the document.
+  for(auto iter = mRasterizations.begin(); iter != mRasterizations.end();)
+  {
+    auto current = iter++;
+    if(current->document == document && current->loadState == LoadState::LOADING && !current->task)
+    {
+      if(success)
+      {
+        AddRasterizingTask(*current);
+      }
+      else
+      {
+        RemoveRasterization(current);
+      }
+    }
+  }
+
+  ObserverList observers;
+  observers.swap(document->observers);
+
+  // Notify with an empty pixel data so that the visuals only update their default size.
+  NotifyObservers(observers, PixelData(), success);
+
+  Evict();
+}
+
+void SvgCache::ApplyRasterizedImage(RasterizationIterator rasterization, PixelData pixelData, bool success)
+{
+  StoreRasterizedImage(*rasterization, pixelData, success);
+
+  ObserverList observers;
+  observers.swap(rasterization->observers);
+
+  NotifyObservers(observers, pixelData, success);
+
+  Evict();
+}
+
+void SvgCache::NotifyObservers(ObserverList& observers, PixelData pixelData, bool success)
+{
+  // The visuals can be removed by the notification of the previous visuals.
+  ObserverList* previousObservers = mNotifyingObservers;
+  mNotifyingObservers                     = &observers;
+
+  for(std::size_t index = 0u; index < observers.size(); ++index)
+  {
+    if(observers[index])
+    {
+      observers[index]->ApplyRasterizedImage(pixelData, success);
+    }
+  }
+
+  mNotifyingObservers = previousObservers;
+}
+
+void SvgCache::RemoveRasterizationObserver(const SvgVisual* visual)
+{
+  auto iter = mVisualRasterizations.find(visual);
+  if(iter != mVisualRasterizations.end())
+  {
+    RasterizationIterator rasterization = iter->second;
+    mVisualRasterizations.erase(iter);
+
+    rasterization->observers.erase(std::remove(rasterization->observers.begin(), rasterization->observers.end(), visual), rasterization->observers.end());
+    --rasterization->referenceCount;
+
+    if(rasterization->referenceCount == 0u && rasterization->loadState == LoadState::LOADING)
+    {
+      // Nobody waits for the image anymore.
+      RemoveRasterization(rasterization);
+    }
+  }
+}
+
+void SvgCache::RemoveRasterization(RasterizationIterator rasterization)
+{
+  if(rasterization->task && mRasterizeThread)
+  {
+    mRasterizeThread->RemoveTask(rasterization->task);
+  }
+
+  for(const auto& visual : rasterization->observers)
+  {
+    mVisualRasterizations.erase(visual);
+  }
+
+  mRasterizedDataSize -= GetDataSize(rasterization->pixelData);
+  mRasterizationMap.erase(rasterization->key);
+  mRasterizations.erase(rasterization);
+}
+
+void SvgCache::RemoveDocument(DocumentIterator document)
+{
+  for(auto iter = mRasterizations.begin(); iter != mRasterizations.end();)
+  {
+    auto current = iter++;
+    if(current->document == document)
+    {
+      RemoveRasterization(current);
+    }
+  }
+
+  mDocumentMap.erase(document->key);
+  mDocuments.erase(document);
+}
+
+void SvgCache::Evict()
+{
+  // Don't remove the entries while the visuals are notified of them.
+  if(mNotifyingObservers)
+  {
+    return;
+  }
+
+  // Remove the least recently used rasterized images which are not used by any visual.
+  for(auto iter = mRasterizations.end(); iter != mRasterizations.begin();)
+  {
+    auto current = --iter;
+    if(current->referenceCount == 0u &&
+       (current->loadState == LoadState::FAILED || (current->loadState == LoadState::LOADED && mRasterizedDataSize > MAX_RASTERIZED_DATA_SIZE)))
+    {
+      iter = std::next(current);
+      RemoveRasterization(current);
+    }
+  }
+
+  // Remove the least recently used documents which are not used by any visual.
+  std::size_t unusedDocumentCount = 0u;
+  for(auto iter = mDocuments.begin(); iter != mDocuments.end();)
+  {
+    auto current = iter++;
+    if(current->referenceCount == 0u && current->loadState != LoadState::LOADING)
+    {
+      if(current->loadState == LoadState::FAILED || ++unusedDocumentCount > MAX_UNUSED_DOCUMENT_COUNT)
+      {
+        RemoveDocument(current);
+      }
+    }
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
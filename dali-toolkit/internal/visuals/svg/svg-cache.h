@@ -0,0 +1,258 @@
+#ifndef DALI_TOOLKIT_SVG_CACHE_H
+#define DALI_TOOLKIT_SVG_CACHE_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/vector-image-renderer.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/rendering/texture.h>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+#include <dali-toolkit/internal/visuals/visual-url.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+class SvgVisual;
+
+/**
+ * The cache of the svg documents and of their rasterized images, shared by all the SvgVisuals.
+ *
+ * A document is identified by its url and the DPI, a rasterized image by its document and its size.
+ * Identical requests share the same loading or rasterizing task, and each requesting visual is
+ * notified by SvgVisual::ApplyRasterizedImage() when the task is completed.
+ *
+ * The documents not used by any visual and the rasterized images are kept in least recently used order,
+ * and the oldest ones are removed when the cache exceeds its limits.
+ *
+ * The documents loaded synchronously are never shared with the documents loaded in the worker threads,
+ * so that a document is never processed by two threads at the same time.
+ */
+class SvgCache
+{
+public:
+  /**
+   * The state of a document or of a rasterized image.
+   */
+  enum class LoadState
+  {
+    LOADING, ///< The task is waiting or being processed. The visual will be notified.
+    LOADED,  ///< The document is loaded or the image is rasterized.
+    FAILED   ///< The task failed.
+  };
+
+  /**
+   * Constructor
+   */
+  SvgCache();
+
+  /**
+   * Destructor, non-virtual as not a base class. Terminates the worker threads.
+   */
+  ~SvgCache();
+
+  /**
+   * @brief Requests the svg document of the given url for the visual.
+   *
+   * @param[in] visual The visual which uses the document.
+   * @param[in] url The URL to svg resource to use.
+   * @param[in] dpi The DPI of the screen.
+   * @param[in] synchronousLoading True if the document should be loaded in the calling thread.
+   * @param[out] vectorRenderer The vector rasterizer holding the document.
+   * @return The state of the document.
+   */
+  LoadState Load(SvgVisual* visual, const VisualUrl& url, float dpi, bool synchronousLoading, VectorImageRenderer& vectorRenderer);
+
+  /**
+   * @brief Requests the rasterization of the document used by the visual.
+   *
+   * The previous rasterization requested by the visual is cancelled.
+   *
+   * @param[in] visual The visual which uses the rasterized image.
+   * @param[in] width The rasterization width.
+   * @param[in] height The rasterization height.
+   * @param[out] pixelData The rasterized image if it is already available.
+   * @return The state of the rasterized image.
+   */
+  LoadState Rasterize(SvgVisual* visual, uint32_t width, uint32_t height, PixelData& pixelData);
+
+  /**
+   * @brief Retrieves the texture of the rasterized image, shared by all the visuals displaying it.
+   *
+   * @param[in] visual The visual which uses the rasterized image.
+   * @param[in] pixelData The rasterized image.
+   * @return The texture with the pixel data uploaded.
+   */
+  Texture GetTexture(SvgVisual* visual, PixelData pixelData);
+
+  /**
+   * @brief Cancels the rasterization requested by the visual.
+   *
+   * Typically called when the actor is put off stage, so the rasterized image is not needed anymore.
+   *
+   * @param[in] visual The visual pointer.
+   */
+  void CancelRasterization(SvgVisual* visual);
+
+  /**
+   * @brief Removes all the requests of the visual, and releases its document.
+   *
+   * @param[in] visual The visual pointer.
+   */
+  void Remove(SvgVisual* visual);
+
+  /**
+   * @brief Applies the result of a completed task to the cache, and notifies the visuals waiting for it.
+   *
+   * Called by the worker threads in the main thread.
+   *
+   * @param[in] task The completed task.
+   */
+  void ApplyCompletedTask(SvgTaskPtr task);
+
+private:
+  struct DocumentInfo;
+  struct RasterizationInfo;
+
+  using DocumentList           = std::list<DocumentInfo>;
+  using DocumentIterator       = DocumentList::iterator;
+  using RasterizationList      = std::list<RasterizationInfo>;
+  using RasterizationIterator  = RasterizationList::iterator;
+  using ObserverList           = std::vector<SvgVisual*>;
+  using DocumentMap            = std::unordered_map<std::string, DocumentIterator>;
+  using RasterizationMap       = std::unordered_map<std::string, RasterizationIterator>;
+  using DocumentVisualMap      = std::unordered_map<const SvgVisual*, DocumentIterator>;
+  using RasterizationVisualMap = std::unordered_map<const SvgVisual*, RasterizationIterator>;
+
+  /**
+   * The svg document shared by the visuals.
+   */
+  struct DocumentInfo
+  {
+    std::string          key;            ///< The url, DPI and loading mode of the document.
+    VectorImageRenderer  vectorRenderer; ///< The vector rasterizer holding the document.
+    SvgTaskPtr           task;           ///< The loading task, while the document is loading.
+    ObserverList         observers;      ///< The visuals waiting for the document.
+    LoadState            loadState;      ///< The state of the document.
+    uint32_t             referenceCount; ///< The number of visuals using the document.
+    bool                 synchronous;    ///< Whether the document is loaded and rasterized in the main thread.
+  };
+
+  /**
+   * The rasterized image shared by the visuals.
+   */
+  struct RasterizationInfo
+  {
+    std::string          key;            ///< The document key and the size of the image.
+    DocumentIterator     document;       ///< The document to rasterize.
+    SvgTaskPtr           task;           ///< The rasterizing task, while the image is rasterizing.
+    ObserverList         observers;      ///< The visuals waiting for the image.
+    PixelData            pixelData;      ///< The rasterized image.
+    Texture              texture;        ///< The texture of the rasterized image, created when first needed.
+    LoadState            loadState;      ///< The state of the image.
+    uint32_t             referenceCount; ///< The number of visuals using the image.
+    uint32_t             width;          ///< The rasterization width.
+    uint32_t             height;         ///< The rasterization height.
+  };
+
+  /**
+   * @brief Gets the worker threads, and starts them if not started yet.
+   */
+  SvgRasterizeThread* GetRasterizeThread();
+
+  /**
+   * @brief Adds the rasterizing task of the image into the queue of the worker threads.
+   */
+  void AddRasterizingTask(RasterizationInfo& rasterization);
+
+  /**
+   * @brief Stores the result of a rasterization into the cache.
+   */
+  void StoreRasterizedImage(RasterizationInfo& rasterization, PixelData pixelData, bool success);
+
+  /**
+   * @brief Applies the result of a completed loading task.
+   */
+  void ApplyLoadedDocument(DocumentIterator document, bool success);
+
+  /**
+   * @brief Applies the result of a completed rasterizing task.
+   */
+  void ApplyRasterizedImage(RasterizationIterator rasterization, PixelData pixelData, bool success);
+
+  /**
+   * @brief Notifies the visuals with the result of a task.
+   *
+   * The visuals removed from the cache during the notification are not notified.
+   */
+  void NotifyObservers(ObserverList& observers, PixelData pixelData, bool success);
+
+  /**
+   * @brief Releases the rasterized image used by the visual, and removes it if it's still rasterizing for nobody.
+   */
+  void RemoveRasterizationObserver(const SvgVisual* visual);
+
+  /**
+   * @brief Removes the rasterized image, and its task if it's still waiting for the worker threads.
+   */
+  void RemoveRasterization(RasterizationIterator rasterization);
+
+  /**
+   * @brief Removes the document and all its rasterized images.
+   */
+  void RemoveDocument(DocumentIterator document);
+
+  /**
+   * @brief Removes the least recently used documents and rasterized images while the cache exceeds its limits.
+   */
+  void Evict();
+
+  // Undefined
+  SvgCache(const SvgCache& cache) = delete;
+
+  // Undefined
+  SvgCache& operator=(const SvgCache& cache) = delete;
+
+private:
+  DocumentList           mDocuments;            ///< The documents, the most recently used first.
+  RasterizationList      mRasterizations;       ///< The rasterized images, the most recently used first.
+  DocumentMap            mDocumentMap;          ///< The documents by key.
+  RasterizationMap       mRasterizationMap;     ///< The rasterized images by key.
+  DocumentVisualMap      mVisualDocuments;      ///< The document used by each visual.
+  RasterizationVisualMap mVisualRasterizations; ///< The rasterized image used by each visual.
+  ObserverList*          mNotifyingObservers;   ///< The visuals being notified, if any.
+  SvgRasterizeThread*    mRasterizeThread;      ///< The worker threads.
+  std::size_t            mRasterizedDataSize;   ///< The size of the pixel data kept by the cache.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_SVG_CACHE_H
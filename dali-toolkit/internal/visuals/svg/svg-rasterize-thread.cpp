@@ -19,13 +19,17 @@
 #include "svg-rasterize-thread.h"
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/devel-api/adaptor-framework/thread-settings.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
 
 // INTERNAL INCLUDES
-#include <dali-toolkit/internal/visuals/svg/svg-visual.h>
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
 
 namespace Dali
 {
@@ -33,16 +37,39 @@ namespace Toolkit
 {
 namespace Internal
 {
-SvgTask::SvgTask(SvgVisual* svgVisual, VectorImageRenderer vectorRenderer)
-: mSvgVisual(svgVisual),
-  mVectorRenderer(vectorRenderer),
+namespace
+{
+constexpr auto MAX_DEFAULT_NUMBER_OF_RASTERIZE_THREADS = size_t{4u};
+constexpr auto NUMBER_OF_RASTERIZE_THREADS_ENV         = "DALI_SVG_RASTERIZE_THREADS";
+
+size_t GetNumberOfThreads(const char* environmentVariable, size_t defaultValue)
+{
+  using Dali::EnvironmentVariable::GetEnvironmentVariable;
+  auto           numberString          = GetEnvironmentVariable(environmentVariable);
+  auto           numberOfThreads       = numberString ? std::strtoul(numberString, nullptr, 10) : 0;
+  constexpr auto MAX_NUMBER_OF_THREADS = 100u;
+  DALI_ASSERT_DEBUG(numberOfThreads < MAX_NUMBER_OF_THREADS);
+  return (numberOfThreads > 0 && numberOfThreads < MAX_NUMBER_OF_THREADS) ? numberOfThreads : defaultValue;
+}
+
+size_t GetDefaultNumberOfRasterizeThreads()
+{
+  // Rasterization is CPU bound. Use the cores, but not more than the other pools of workers do.
+  const size_t numberOfCores = std::thread::hardware_concurrency();
+  return std::max(size_t{1u}, std::min(numberOfCores, MAX_DEFAULT_NUMBER_OF_RASTERIZE_THREADS));
+}
+
+} // unnamed namespace
+
+SvgTask::SvgTask(VectorImageRenderer vectorRenderer)
+: mVectorRenderer(vectorRenderer),
   mHasSucceeded(false)
 {
 }
 
-SvgVisual* SvgTask::GetSvgVisual() const
+VectorImageRenderer SvgTask::GetVectorRenderer() const
 {
-  return mSvgVisual.Get();
+  return mVectorRenderer;
 }
 
 PixelData SvgTask::GetPixelData() const
@@ -55,8 +82,8 @@ bool SvgTask::HasSucceeded() const
   return mHasSucceeded;
 }
 
-SvgLoadingTask::SvgLoadingTask(SvgVisual* svgVisual, VectorImageRenderer vectorRenderer, const VisualUrl& url, float dpi)
-: SvgTask(svgVisual, vectorRenderer),
+SvgLoadingTask::SvgLoadingTask(VectorImageRenderer vectorRenderer, const VisualUrl& url, float dpi)
+: SvgTask(vectorRenderer),
   mUrl(url),
   mDpi(dpi)
 {
@@ -105,8 +132,8 @@ void SvgLoadingTask::Process()
   mHasSucceeded = true;
 }
 
-SvgRasterizingTask::SvgRasterizingTask(SvgVisual* svgVisual, VectorImageRenderer vectorRenderer, unsigned int width, unsigned int height)
-: SvgTask(svgVisual, vectorRenderer),
+SvgRasterizingTask::SvgRasterizingTask(VectorImageRenderer vectorRenderer, unsigned int width, unsigned int height)
+: SvgTask(vectorRenderer),
   mWidth(width),
   mHeight(height)
 {
@@ -140,12 +167,22 @@ PixelData SvgRasterizingTask::GetPixelData() const
   return mPixelData;
 }
 
-SvgRasterizeThread::SvgRasterizeThread()
-: mTrigger(new EventThreadCallback(MakeCallback(this, &SvgRasterizeThread::ApplyRasterizedSVGToSampler))),
+SvgRasterizeThread::SvgRasterizeThread(SvgCache& svgCache)
+: mRasterizeTasks(),
+  mCompletedTasks(),
+  mProcessingRenderers(),
+  mWorkers(),
+  mSvgCache(svgCache),
+  mTrigger(new EventThreadCallback(MakeCallback(this, &SvgRasterizeThread::ApplyRasterizedSVGToSampler))),
   mLogFactory(Dali::Adaptor::Get().GetLogFactory()),
-  mIsThreadWaiting(false),
+  mIsTerminating(false),
   mProcessorRegistered(false)
 {
+  const size_t numberOfThreads = GetNumberOfThreads(NUMBER_OF_RASTERIZE_THREADS_ENV, GetDefaultNumberOfRasterizeThreads());
+  for(size_t index = 0u; index < numberOfThreads; ++index)
+  {
+    mWorkers.push_back(std::unique_ptr<RasterizeWorker>(new RasterizeWorker(*this)));
+  }
 }
 
 SvgRasterizeThread::~SvgRasterizeThread()
@@ -160,43 +197,36 @@ void SvgRasterizeThread::TerminateThread(SvgRasterizeThread*& thread)
 {
   if(thread)
   {
-    // add an empty task would stop the thread from conditional wait.
-    thread->AddTask(SvgTaskPtr());
-    // stop the thread
-    thread->Join();
+    {
+      // stop the threads from conditional wait.
+      ConditionalWait::ScopedLock lock(thread->mConditionalWait);
+      thread->mIsTerminating = true;
+      thread->mConditionalWait.Notify(lock);
+    }
+    // stop the threads
+    for(auto&& worker : thread->mWorkers)
+    {
+      worker->Join();
+    }
     // delete the thread
     delete thread;
     thread = NULL;
   }
 }
 
-void SvgRasterizeThread::AddTask(SvgTaskPtr task)
+void SvgRasterizeThread::Start()
 {
-  bool wasEmpty = false;
+  for(auto&& worker : mWorkers)
+  {
+    worker->Start();
+  }
+}
 
+void SvgRasterizeThread::AddTask(SvgTaskPtr task)
+{
   {
     // Lock while adding task to the queue
     ConditionalWait::ScopedLock lock(mConditionalWait);
-    wasEmpty = mRasterizeTasks.empty();
-    if(!wasEmpty && task)
-    {
-      // Remove the tasks with the same renderer.
-      // Older task which waiting to rasterize and apply the svg to the same renderer is expired.
-      // Rasterizing task only, loading task is not duplicated.
-      for(std::vector<SvgTaskPtr>::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it)
-      {
-        if((*it) && (*it)->GetSvgVisual() == task->GetSvgVisual())
-        {
-          SvgRasterizingTask* oldTask = dynamic_cast<SvgRasterizingTask*>(it->Get());
-          SvgRasterizingTask* newTask = dynamic_cast<SvgRasterizingTask*>(task.Get());
-          if(oldTask && newTask)
-          {
-            mRasterizeTasks.erase(it);
-            break;
-          }
-        }
-      }
-    }
     mRasterizeTasks.push_back(task);
 
     if(!mProcessorRegistered)
@@ -206,11 +236,8 @@ void SvgRasterizeThread::AddTask(SvgTaskPtr task)
     }
   }
 
-  if(wasEmpty)
-  {
-    // wake up the image loading thread
-    mConditionalWait.Notify();
-  }
+  // wake up the workers
+  mConditionalWait.Notify();
 }
 
 SvgTaskPtr SvgRasterizeThread::NextCompletedTask()
@@ -230,19 +257,13 @@ SvgTaskPtr SvgRasterizeThread::NextCompletedTask()
   return nextTask;
 }
 
-void SvgRasterizeThread::RemoveTask(SvgVisual* visual)
+void SvgRasterizeThread::RemoveTask(SvgTaskPtr task)
 {
   // Lock while remove task from the queue
   ConditionalWait::ScopedLock lock(mConditionalWait);
   if(!mRasterizeTasks.empty())
   {
-    for(std::vector<SvgTaskPtr>::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it)
-    {
-      if((*it) && (*it)->GetSvgVisual() == visual)
-      {
-        mRasterizeTasks.erase(it);
-      }
-    }
+    mRasterizeTasks.erase(std::remove(mRasterizeTasks.begin(), mRasterizeTasks.end(), task), mRasterizeTasks.end());
   }
 
   UnregisterProcessor();
@@ -253,24 +274,45 @@ SvgTaskPtr SvgRasterizeThread::NextTaskToProcess()
   // Lock while popping task out from the queue
   ConditionalWait::ScopedLock lock(mConditionalWait);
 
-  // conditional wait
-  while(mRasterizeTasks.empty())
+  while(!mIsTerminating)
   {
-    mIsThreadWaiting = true;
+    // pop out the first task whose vector rasterizer is not used by another worker
+    for(std::vector<SvgTaskPtr>::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it)
+    {
+      VectorImageRenderer renderer = (*it)->GetVectorRenderer();
+      if(std::find(mProcessingRenderers.begin(), mProcessingRenderers.end(), renderer) == mProcessingRenderers.end())
+      {
+        SvgTaskPtr nextTask = *it;
+        mRasterizeTasks.erase(it);
+        mProcessingRenderers.push_back(renderer);
+        return nextTask;
+      }
+    }
+
+    // conditional wait
     mConditionalWait.Wait(lock);
   }
-  mIsThreadWaiting = false;
 
-  // pop out the next task from the queue
-  std::vector<SvgTaskPtr>::iterator next     = mRasterizeTasks.begin();
-  SvgTaskPtr                        nextTask = *next;
-  mRasterizeTasks.erase(next);
-
-  return nextTask;
+  return SvgTaskPtr();
 }
 
 void SvgRasterizeThread::AddCompletedTask(SvgTaskPtr task)
 {
+  {
+    // Release the vector rasterizer, the tasks waiting for it can be processed now.
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    auto                        renderer = std::find(mProcessingRenderers.begin(), mProcessingRenderers.end(), task->GetVectorRenderer());
+    if(renderer != mProcessingRenderers.end())
+    {
+      mProcessingRenderers.erase(renderer);
+    }
+
+    if(!mRasterizeTasks.empty())
+    {
+      mConditionalWait.Notify(lock);
+    }
+  }
+
   // Lock while adding task to the queue
   Mutex::ScopedLock lock(mMutex);
   mCompletedTasks.push_back(task);
@@ -279,23 +321,11 @@ void SvgRasterizeThread::AddCompletedTask(SvgTaskPtr task)
   mTrigger->Trigger();
 }
 
-void SvgRasterizeThread::Run()
-{
-  SetThreadName("SVGThread");
-  mLogFactory.InstallLogFunction();
-
-  while(SvgTaskPtr task = NextTaskToProcess())
-  {
-    task->Process();
-    AddCompletedTask(task);
-  }
-}
-
 void SvgRasterizeThread::ApplyRasterizedSVGToSampler()
 {
   while(SvgTaskPtr task = NextCompletedTask())
   {
-    task->GetSvgVisual()->ApplyRasterizedImage(task->GetPixelData(), task->HasSucceeded());
+    mSvgCache.ApplyCompletedTask(task);
   }
 
   UnregisterProcessor();
@@ -318,6 +348,23 @@ void SvgRasterizeThread::UnregisterProcessor()
   }
 }
 
+SvgRasterizeThread::RasterizeWorker::RasterizeWorker(SvgRasterizeThread& rasterizeThread)
+: mRasterizeThread(rasterizeThread)
+{
+}
+
+void SvgRasterizeThread::RasterizeWorker::Run()
+{
+  SetThreadName("SVGThread");
+  mRasterizeThread.mLogFactory.InstallLogFunction();
+
+  while(SvgTaskPtr task = mRasterizeThread.NextTaskToProcess())
+  {
+    task->Process();
+    mRasterizeThread.AddCompletedTask(task);
+  }
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
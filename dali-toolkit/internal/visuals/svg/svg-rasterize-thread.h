@@ -40,8 +40,7 @@ namespace Toolkit
 {
 namespace Internal
 {
-class SvgVisual;
-typedef IntrusivePtr<SvgVisual> SvgVisualPtr;
+class SvgCache;
 class SvgTask;
 typedef IntrusivePtr<SvgTask> SvgTaskPtr;
 
@@ -49,20 +48,20 @@ typedef IntrusivePtr<SvgTask> SvgTaskPtr;
  * The svg rasterizing tasks to be processed in the worker thread.
  *
  * Life cycle of a rasterizing task is as follows:
- * 1. Created by SvgVisual in the main thread
+ * 1. Created by SvgCache in the main thread
  * 2. Queued in the worked thread waiting to be processed.
- * 3. If this task gets its turn to do the rasterization, it triggers main thread to apply the rasterized image to material then been deleted in main thread call back
- *    Or if this task is been removed ( new image/size set to the visual or actor off stage) before its turn to be processed, it then been deleted in the worker thread.
+ * 3. If this task gets its turn to do the rasterization, it triggers main thread to apply the result to the cache, which notifies the visuals waiting for it,
+ *    then been deleted in main thread call back
+ *    Or if this task is been removed ( no visual waits for the result anymore ) before its turn to be processed, it then been deleted in the worker thread.
  */
 class SvgTask : public RefObject
 {
 public:
   /**
    * Constructor
-   * @param[in] svgVisual The visual which the rasterized image to be applied.
    * @param[in] vectorRenderer The vector rasterizer.
    */
-  SvgTask(SvgVisual* svgVisual, VectorImageRenderer vectorRenderer);
+  SvgTask(VectorImageRenderer vectorRenderer);
 
   /**
    * Destructor.
@@ -75,15 +74,16 @@ public:
   virtual void Process() = 0;
 
   /**
-   * Whether the task has succeeded.
-   * @return True if the task has succeeded.
+   * Get the vector rasterizer used by the task.
+   * @return The vector rasterizer.
    */
-  bool HasSucceeded() const;
+  VectorImageRenderer GetVectorRenderer() const;
 
   /**
-   * Get the svg visual
+   * Whether the task has succeeded.
+   * @return True if the task has succeeded.
    */
-  SvgVisual* GetSvgVisual() const;
+  bool HasSucceeded() const;
 
   /**
    * Get the rasterization result.
@@ -99,7 +99,6 @@ private:
   SvgTask& operator=(const SvgTask& task) = delete;
 
 protected:
-  SvgVisualPtr        mSvgVisual;
   VectorImageRenderer mVectorRenderer;
   bool                mHasSucceeded;
 };
@@ -109,12 +108,11 @@ class SvgLoadingTask : public SvgTask
 public:
   /**
    * Constructor
-   * @param[in] svgVisual The visual which the rasterized image to be applied.
    * @param[in] vectorRenderer The vector rasterizer.
    * @param[in] url The URL to svg resource to use.
    * @param[in] dpi The DPI of the screen.
    */
-  SvgLoadingTask(SvgVisual* svgVisual, VectorImageRenderer vectorRenderer, const VisualUrl& url, float dpi);
+  SvgLoadingTask(VectorImageRenderer vectorRenderer, const VisualUrl& url, float dpi);
 
   /**
    * Destructor.
@@ -143,12 +141,11 @@ class SvgRasterizingTask : public SvgTask
 public:
   /**
    * Constructor
-   * @param[in] svgVisual The visual which the rasterized image to be applied.
    * @param[in] vectorRenderer The vector rasterizer.
    * @param[in] width The rasterization width.
    * @param[in] height The rasterization height.
    */
-  SvgRasterizingTask(SvgVisual* svgVisual, VectorImageRenderer vectorRenderer, unsigned int width, unsigned int height);
+  SvgRasterizingTask(VectorImageRenderer vectorRenderer, unsigned int width, unsigned int height);
 
   /**
    * Destructor.
@@ -180,23 +177,31 @@ private:
 };
 
 /**
- * The worker thread for SVG rasterization.
+ * The worker threads for SVG rasterization.
+ *
+ * The tasks are processed concurrently by a pool of worker threads, except the tasks of the same document,
+ * which are processed by one worker at a time as the vector rasterizer can't be used by two threads at once.
  */
-class SvgRasterizeThread : public Thread, Integration::Processor
+class SvgRasterizeThread : public Integration::Processor
 {
 public:
   /**
    * Constructor.
    *
-   * @param[in] trigger The trigger to wake up the main thread.
+   * @param[in] svgCache The cache which the completed tasks are applied to.
    */
-  SvgRasterizeThread();
+  SvgRasterizeThread(SvgCache& svgCache);
 
   /**
-   * Terminate the svg rasterize thread, join and delete.
+   * Terminate the svg rasterize threads, join and delete.
    */
   static void TerminateThread(SvgRasterizeThread*& thread);
 
+  /**
+   * Start the worker threads.
+   */
+  void Start();
+
   /**
    * Add a rasterization task into the waiting queue, called by main thread.
    *
@@ -212,13 +217,13 @@ public:
   SvgTaskPtr NextCompletedTask();
 
   /**
-   * Remove the task with the given visual from the waiting queue, called by main thread.
+   * Remove the task from the waiting queue, called by main thread.
    *
-   * Typically called when the actor is put off stage, so the renderer is not needed anymore.
+   * Typically called when no visual waits for the result of the task anymore.
    *
-   * @param[in] visual The visual pointer.
+   * @param[in] task The task to remove.
    */
-  void RemoveTask(SvgVisual* visual);
+  void RemoveTask(SvgTaskPtr task);
 
   /**
    * @copydoc Dali::Integration::Processor::Process()
@@ -227,21 +232,47 @@ public:
 
 private:
   /**
-   * Pop the next task out from the queue.
+   * The worker thread which processes the tasks of the queue.
+   */
+  class RasterizeWorker : public Thread
+  {
+  public:
+    /**
+     * Constructor.
+     *
+     * @param[in] rasterizeThread The owner of the task queue.
+     */
+    RasterizeWorker(SvgRasterizeThread& rasterizeThread);
+
+  protected:
+    /**
+     * The entry function of the worker thread.
+     * It fetches task from the Queue, processes it and moves it to the completed queue.
+     */
+    void Run() override;
+
+  private:
+    SvgRasterizeThread& mRasterizeThread;
+  };
+
+  /**
+   * Pop the next task out from the queue, called by the worker threads.
    *
-   * @return The next task to be processed.
+   * The tasks using the vector rasterizer of a task being processed are skipped.
+   *
+   * @return The next task to be processed, or an empty task if the threads are terminating.
    */
   SvgTaskPtr NextTaskToProcess();
 
   /**
-   * Add a task in to the queue
+   * Add a task in to the completed queue, called by the worker threads.
    *
    * @param[in] task The task added to the queue.
    */
   void AddCompletedTask(SvgTaskPtr task);
 
   /**
-   * Applies the rasterized image to material
+   * Applies the completed tasks to the cache
    */
   void ApplyRasterizedSVGToSampler();
 
@@ -257,12 +288,6 @@ protected:
    */
   ~SvgRasterizeThread() override;
 
-  /**
-   * The entry function of the worker thread.
-   * It fetches task from the Queue, rasterizes the image and apply to the renderer.
-   */
-  void Run() override;
-
 private:
   // Undefined
   SvgRasterizeThread(const SvgRasterizeThread& thread);
@@ -271,15 +296,18 @@ private:
   SvgRasterizeThread& operator=(const SvgRasterizeThread& thread);
 
 private:
-  std::vector<SvgTaskPtr> mRasterizeTasks; //The queue of the tasks waiting to rasterize the SVG image
-  std::vector<SvgTaskPtr> mCompletedTasks; //The queue of the tasks with the SVG rasterization completed
-
-  ConditionalWait                      mConditionalWait;
-  Dali::Mutex                          mMutex;
-  std::unique_ptr<EventThreadCallback> mTrigger;
-  const Dali::LogFactoryInterface&     mLogFactory;
-  bool                                 mIsThreadWaiting;
-  bool                                 mProcessorRegistered;
+  std::vector<SvgTaskPtr>          mRasterizeTasks;      //The queue of the tasks waiting to rasterize the SVG image
+  std::vector<SvgTaskPtr>          mCompletedTasks;      //The queue of the tasks with the SVG rasterization completed
+  std::vector<VectorImageRenderer> mProcessingRenderers; //The vector rasterizers used by the tasks being processed
+
+  std::vector<std::unique_ptr<RasterizeWorker>> mWorkers;
+  SvgCache&                                     mSvgCache;
+  ConditionalWait                               mConditionalWait;
+  Dali::Mutex                                   mMutex;
+  std::unique_ptr<EventThreadCallback>          mTrigger;
+  const Dali::LogFactoryInterface&              mLogFactory;
+  bool                                          mIsTerminating;
+  bool                                          mProcessorRegistered;
 };
 
 } // namespace Internal
@@ -21,7 +21,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/image-atlas-manager.h>
 #include <dali-toolkit/internal/visuals/image-visual-shader-factory.h>
-#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/public-api/visuals/image-visual-properties.h>
@@ -66,7 +66,7 @@ SvgVisual::SvgVisual(VisualFactoryCache& factoryCache, ImageVisualShaderFactory&
   mImageVisualShaderFactory(shaderFactory),
   mAtlasRect(FULL_TEXTURE_RECT),
   mImageUrl(imageUrl),
-  mVectorRenderer(VectorImageRenderer::New()),
+  mVectorRenderer(),
   mDefaultWidth(0),
   mDefaultHeight(0),
   mPlacementActor(),
@@ -80,6 +80,10 @@ SvgVisual::SvgVisual(VisualFactoryCache& factoryCache, ImageVisualShaderFactory&
 
 SvgVisual::~SvgVisual()
 {
+  if(Stage::IsInstalled())
+  {
+    mFactoryCache.GetSvgCache().Remove(this);
+  }
 }
 
 void SvgVisual::OnInitialize()
@@ -92,15 +96,18 @@ void SvgVisual::OnInitialize()
   Vector2 dpi     = Stage::GetCurrent().GetDpi();
   float   meanDpi = (dpi.height + dpi.width) * 0.5f;
 
-  SvgTaskPtr newTask = new SvgLoadingTask(this, mVectorRenderer, mImageUrl, meanDpi);
+  const bool synchronousLoading = IsSynchronousLoadingRequired() && mImageUrl.IsLocalResource();
 
-  if(IsSynchronousLoadingRequired() && mImageUrl.IsLocalResource())
+  // The document is shared with the other visuals using the same url.
+  SvgCache::LoadState loadState = mFactoryCache.GetSvgCache().Load(this, mImageUrl, meanDpi, synchronousLoading, mVectorRenderer);
+  if(loadState == SvgCache::LoadState::LOADED)
   {
-    newTask->Process();
+    mVectorRenderer.GetDefaultSize(mDefaultWidth, mDefaultHeight);
   }
-  else
+  else if(loadState == SvgCache::LoadState::FAILED && !synchronousLoading)
   {
-    mFactoryCache.GetSVGRasterizationThread()->AddTask(newTask);
+    // Already failed to load. The synchronous loading failure is applied by the rasterization.
+    ApplyRasterizedImage(PixelData(), false);
   }
 }
 
@@ -191,7 +198,7 @@ void SvgVisual::DoSetOnScene(Actor& actor)
 
 void SvgVisual::DoSetOffScene(Actor& actor)
 {
-  mFactoryCache.GetSVGRasterizationThread()->RemoveTask(this);
+  mFactoryCache.GetSvgCache().CancelRasterization(this);
 
   actor.RemoveRenderer(mImpl->mRenderer);
   mPlacementActor.Reset();
@@ -257,16 +264,12 @@ void SvgVisual::AddRasterizationTask(const Vector2& size)
     unsigned int width  = static_cast<unsigned int>(size.width);
     unsigned int height = static_cast<unsigned int>(size.height);
 
-    SvgTaskPtr newTask = new SvgRasterizingTask(this, mVectorRenderer, width, height);
-
-    if(IsSynchronousLoadingRequired() && mImageUrl.IsLocalResource())
-    {
-      newTask->Process();
-      ApplyRasterizedImage(newTask->GetPixelData(), newTask->HasSucceeded());
-    }
-    else
+    // The rasterized image is shared with the other visuals using the same document and size.
+    PixelData           pixelData;
+    SvgCache::LoadState loadState = mFactoryCache.GetSvgCache().Rasterize(this, width, height, pixelData);
+    if(loadState != SvgCache::LoadState::LOADING)
     {
-      mFactoryCache.GetSVGRasterizationThread()->AddTask(newTask);
+      ApplyRasterizedImage(pixelData, loadState == SvgCache::LoadState::LOADED);
     }
   }
 }
@@ -312,8 +315,7 @@ void SvgVisual::ApplyRasterizedImage(PixelData rasterizedPixelData, bool success
 
       if(!textureSet) // no atlasing - mAttemptAtlasing is false or adding to atlas is failed
       {
-        Texture texture = Texture::New(Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888, rasterizedPixelData.GetWidth(), rasterizedPixelData.GetHeight());
-        texture.Upload(rasterizedPixelData);
+        Texture texture = mFactoryCache.GetSvgCache().GetTexture(this, rasterizedPixelData);
         mImpl->mFlags &= ~Impl::IS_ATLASING_APPLIED;
 
         if(mAtlasRect == FULL_TEXTURE_RECT)
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "text-rasterize-thread.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/thread-settings.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/text/text-visual.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+TextRasterizingTask::TextRasterizingTask(TextVisual* textVisual, const Text::ModelInterface& model, const Vector2& size, Toolkit::DevelText::TextDirection::Type textDirection, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled)
+: mTextVisual(textVisual),
+  mModelSnapshot(new Text::ModelSnapshot(model)),
+  mTypesetter(Text::Typesetter::New(mModelSnapshot.get())),
+  mSize(size),
+  mTextDirection(textDirection),
+  mHasMultipleTextColors(hasMultipleTextColors),
+  mContainsColorGlyph(containsColorGlyph),
+  mStyleEnabled(styleEnabled)
+{
+  // The font client can be used only in the main thread.
+  mTypesetter->PrepareGlyphs();
+}
+
+TextRasterizingTask::~TextRasterizingTask()
+{
+}
+
+void TextRasterizingTask::Process()
+{
+  // Create RGBA texture if the text contains emojis or multiple text colors, otherwise L8 texture
+  const Pixel::Format textPixelFormat = (mContainsColorGlyph || mHasMultipleTextColors) ? Pixel::RGBA8888 : Pixel::L8;
+
+  // The text without any styles
+  mTextPixelData = mTypesetter->Render(mSize, mTextDirection, Text::Typesetter::RENDER_NO_STYLES, false, textPixelFormat);
+
+  if(mStyleEnabled)
+  {
+    // All the text styles that render in the background (without the text itself)
+    mStylePixelData = mTypesetter->Render(mSize, mTextDirection, Text::Typesetter::RENDER_NO_TEXT, false, Pixel::RGBA8888);
+
+    // Overlay styles such as underline and strikethrough (without the text itself)
+    mOverlayStylePixelData = mTypesetter->Render(mSize, mTextDirection, Text::Typesetter::RENDER_OVERLAY_STYLE, false, Pixel::RGBA8888);
+  }
+
+  if(mContainsColorGlyph && !mHasMultipleTextColors)
+  {
+    // A mask to avoid color glyphs (e.g. emojis) to be affected by text color animation
+    mMaskPixelData = mTypesetter->Render(mSize, mTextDirection, Text::Typesetter::RENDER_MASK, false, Pixel::L8);
+  }
+}
+
+TextVisual* TextRasterizingTask::GetTextVisual() const
+{
+  return mTextVisual.Get();
+}
+
+PixelData TextRasterizingTask::GetTextPixelData() const
+{
+  return mTextPixelData;
+}
+
+PixelData TextRasterizingTask::GetStylePixelData() const
+{
+  return mStylePixelData;
+}
+
+PixelData TextRasterizingTask::GetOverlayStylePixelData() const
+{
+  return mOverlayStylePixelData;
+}
+
+PixelData TextRasterizingTask::GetMaskPixelData() const
+{
+  return mMaskPixelData;
+}
+
+bool TextRasterizingTask::HasMultipleTextColors() const
+{
+  return mHasMultipleTextColors;
+}
+
+bool TextRasterizingTask::ContainsColorGlyph() const
+{
+  return mContainsColorGlyph;
+}
+
+bool TextRasterizingTask::IsStyleEnabled() const
+{
+  return mStyleEnabled;
+}
+
+TextRasterizeThread::TextRasterizeThread()
+: mTrigger(new EventThreadCallback(MakeCallback(this, &TextRasterizeThread::ApplyRasterizedText))),
+  mLogFactory(Dali::Adaptor::Get().GetLogFactory()),
+  mIsThreadWaiting(false),
+  mProcessorRegistered(false)
+{
+}
+
+TextRasterizeThread::~TextRasterizeThread()
+{
+  if(mProcessorRegistered)
+  {
+    Adaptor::Get().UnregisterProcessor(*this);
+  }
+}
+
+void TextRasterizeThread::TerminateThread(TextRasterizeThread*& thread)
+{
+  if(thread)
+  {
+    // add an empty task would stop the thread from conditional wait.
+    thread->AddTask(TextRasterizingTaskPtr());
+    // stop the thread
+    thread->Join();
+    // delete the thread
+    delete thread;
+    thread = NULL;
+  }
+}
+
+void TextRasterizeThread::AddTask(TextRasterizingTaskPtr task)
+{
+  bool threadWaiting = false;
+
+  {
+    // Lock while adding task to the queue
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    if(!mRasterizeTasks.empty() && task)
+    {
+      // Older task which waiting to rasterize the text of the same visual is expired.
+      for(std::vector<TextRasterizingTaskPtr>::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it)
+      {
+        if((*it) && (*it)->GetTextVisual() == task->GetTextVisual())
+        {
+          mRasterizeTasks.erase(it);
+          break;
+        }
+      }
+    }
+    mRasterizeTasks.push_back(task);
+
+    // Only a waiting thread needs to be woken up, once.
+    threadWaiting    = mIsThreadWaiting;
+    mIsThreadWaiting = false;
+
+    if(!mProcessorRegistered)
+    {
+      Adaptor::Get().RegisterProcessor(*this);
+      mProcessorRegistered = true;
+    }
+  }
+
+  if(threadWaiting)
+  {
+    // wake up the text rasterizing thread
+    mConditionalWait.Notify();
+  }
+}
+
+TextRasterizingTaskPtr TextRasterizeThread::NextCompletedTask()
+{
+  // Lock while popping task out from the queue
+  Mutex::ScopedLock lock(mMutex);
+
+  if(mCompletedTasks.empty())
+  {
+    return TextRasterizingTaskPtr();
+  }
+
+  std::vector<TextRasterizingTaskPtr>::iterator next     = mCompletedTasks.begin();
+  TextRasterizingTaskPtr                        nextTask = *next;
+  mCompletedTasks.erase(next);
+
+  return nextTask;
+}
+
+void TextRasterizeThread::RemoveTask(TextVisual* visual)
+{
+  {
+    // Lock while remove task from the queue
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    mRasterizeTasks.erase(std::remove_if(mRasterizeTasks.begin(), mRasterizeTasks.end(), [visual](const TextRasterizingTaskPtr& task) { return task && task->GetTextVisual() == visual; }),
+                          mRasterizeTasks.end());
+  }
+
+  UnregisterProcessor();
+}
+
+TextRasterizingTaskPtr TextRasterizeThread::NextTaskToProcess()
+{
+  // Lock while popping task out from the queue
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+
+  // conditional wait
+  while(mRasterizeTasks.empty())
+  {
+    mIsThreadWaiting = true;
+    mConditionalWait.Wait(lock);
+  }
+  mIsThreadWaiting = false;
+
+  // pop out the next task from the queue
+  std::vector<TextRasterizingTaskPtr>::iterator next     = mRasterizeTasks.begin();
+  TextRasterizingTaskPtr                        nextTask = *next;
+  mRasterizeTasks.erase(next);
+
+  return nextTask;
+}
+
+void TextRasterizeThread::AddCompletedTask(TextRasterizingTaskPtr& task)
+{
+  // Lock while adding task to the queue
+  Mutex::ScopedLock lock(mMutex);
+  mCompletedTasks.push_back(task);
+
+  // Release the worker's reference before the main thread can pop the task,
+  // so the task and its visual are always deleted in the main thread.
+  task.Reset();
+
+  // wake up the main thread
+  mTrigger->Trigger();
+}
+
+void TextRasterizeThread::Run()
+{
+  SetThreadName("TextThread");
+  mLogFactory.InstallLogFunction();
+
+  while(TextRasterizingTaskPtr task = NextTaskToProcess())
+  {
+    task->Process();
+    AddCompletedTask(task);
+  }
+}
+
+void TextRasterizeThread::ApplyRasterizedText()
+{
+  while(TextRasterizingTaskPtr task = NextCompletedTask())
+  {
+    task->GetTextVisual()->ApplyRasterizedText(task);
+  }
+
+  UnregisterProcessor();
+}
+
+void TextRasterizeThread::Process(bool postProcessor)
+{
+  ApplyRasterizedText();
+}
+
+void TextRasterizeThread::UnregisterProcessor()
+{
+  if(mProcessorRegistered)
+  {
+    if(mRasterizeTasks.empty() && mCompletedTasks.empty())
+    {
+      Adaptor::Get().UnregisterProcessor(*this);
+      mProcessorRegistered = false;
+    }
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,258 @@
+#ifndef DALI_TOOLKIT_TEXT_RASTERIZE_THREAD_H
+#define DALI_TOOLKIT_TEXT_RASTERIZE_THREAD_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/devel-api/threading/mutex.h>
+#include <dali/devel-api/threading/thread.h>
+#include <dali/integration-api/adaptor-framework/log-factory-interface.h>
+#include <dali/integration-api/processor-interface.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/object/ref-object.h>
+#include <memory>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
+#include <dali-toolkit/internal/text/rendering/model-snapshot.h>
+#include <dali-toolkit/internal/text/rendering/text-typesetter.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+class TextVisual;
+typedef IntrusivePtr<TextVisual> TextVisualPtr;
+class TextRasterizingTask;
+typedef IntrusivePtr<TextRasterizingTask> TextRasterizingTaskPtr;
+
+/**
+ * The text rasterizing task to be processed in the worker thread.
+ *
+ * Life cycle of a rasterizing task is as follows:
+ * 1. Created by TextVisual in the main thread. It takes a snapshot of the text's model and prepares the glyphs' bitmaps.
+ * 2. Queued in the worker thread waiting to be processed.
+ * 3. If this task gets its turn to do the rasterization, it triggers main thread to apply the rasterized text to the renderer then been deleted in main thread call back
+ *    Or if this task is been removed ( new text/size set to the visual or actor off stage) before its turn to be processed, it then been deleted.
+ */
+class TextRasterizingTask : public RefObject
+{
+public:
+  /**
+   * Constructor
+   * @param[in] textVisual The visual which the rasterized text to be applied.
+   * @param[in] model The text's model to take the snapshot from. The glyphs must be already elided.
+   * @param[in] size The size of the text to be rasterized.
+   * @param[in] textDirection The direction of the text.
+   * @param[in] hasMultipleTextColors Whether the text contains multiple colors.
+   * @param[in] containsColorGlyph Whether the text contains color glyph.
+   * @param[in] styleEnabled Whether the text contains any styles (e.g. shadow, underline, etc.).
+   */
+  TextRasterizingTask(TextVisual* textVisual, const Text::ModelInterface& model, const Vector2& size, Toolkit::DevelText::TextDirection::Type textDirection, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled);
+
+  /**
+   * Destructor.
+   */
+  ~TextRasterizingTask() override;
+
+  /**
+   * Rasterize the text for every texture the text visual needs.
+   */
+  void Process();
+
+  /**
+   * Get the text visual
+   */
+  TextVisual* GetTextVisual() const;
+
+  /**
+   * Get the rasterized text without any styles.
+   * @return The pixel data with the rasterized pixels.
+   */
+  PixelData GetTextPixelData() const;
+
+  /**
+   * Get the rasterized styles which are rendered under the text, or an empty handle if the text has no styles.
+   * @return The pixel data with the rasterized pixels.
+   */
+  PixelData GetStylePixelData() const;
+
+  /**
+   * Get the rasterized styles which are rendered over the text, or an empty handle if the text has no styles.
+   * @return The pixel data with the rasterized pixels.
+   */
+  PixelData GetOverlayStylePixelData() const;
+
+  /**
+   * Get the rasterized mask of the color glyphs, or an empty handle if it's not needed.
+   * @return The pixel data with the rasterized pixels.
+   */
+  PixelData GetMaskPixelData() const;
+
+  /**
+   * Whether the text contains multiple colors.
+   */
+  bool HasMultipleTextColors() const;
+
+  /**
+   * Whether the text contains color glyph.
+   */
+  bool ContainsColorGlyph() const;
+
+  /**
+   * Whether the text contains any styles.
+   */
+  bool IsStyleEnabled() const;
+
+private:
+  // Undefined
+  TextRasterizingTask(const TextRasterizingTask& task) = delete;
+
+  // Undefined
+  TextRasterizingTask& operator=(const TextRasterizingTask& task) = delete;
+
+private:
+  TextVisualPtr                           mTextVisual;
+  std::unique_ptr<Text::ModelSnapshot>    mModelSnapshot; ///< Must outlive the typesetter which reads it.
+  Text::TypesetterPtr                     mTypesetter;
+  Vector2                                 mSize;
+  Toolkit::DevelText::TextDirection::Type mTextDirection;
+  PixelData                               mTextPixelData;
+  PixelData                               mStylePixelData;
+  PixelData                               mOverlayStylePixelData;
+  PixelData                               mMaskPixelData;
+  bool                                    mHasMultipleTextColors;
+  bool                                    mContainsColorGlyph;
+  bool                                    mStyleEnabled;
+};
+
+/**
+ * The worker thread for text rasterization.
+ */
+class TextRasterizeThread : public Thread, Integration::Processor
+{
+public:
+  /**
+   * Constructor.
+   */
+  TextRasterizeThread();
+
+  /**
+   * Terminate the text rasterize thread, join and delete.
+   */
+  static void TerminateThread(TextRasterizeThread*& thread);
+
+  /**
+   * Add a rasterization task into the waiting queue, called by main thread.
+   *
+   * A task of the same visual still waiting in the queue is replaced.
+   *
+   * @param[in] task The task added to the queue.
+   */
+  void AddTask(TextRasterizingTaskPtr task);
+
+  /**
+   * Pop the next task out from the completed queue, called by main thread.
+   *
+   * @return The next task in the completed queue.
+   */
+  TextRasterizingTaskPtr NextCompletedTask();
+
+  /**
+   * Remove the task with the given visual from the waiting queue, called by main thread.
+   *
+   * Typically called when the actor is put off stage, so the renderer is not needed anymore.
+   *
+   * @param[in] visual The visual pointer.
+   */
+  void RemoveTask(TextVisual* visual);
+
+  /**
+   * @copydoc Dali::Integration::Processor::Process()
+   */
+  void Process(bool postProcessor) override;
+
+private:
+  /**
+   * Pop the next task out from the queue.
+   *
+   * @return The next task to be processed.
+   */
+  TextRasterizingTaskPtr NextTaskToProcess();
+
+  /**
+   * Add a task in to the completed queue
+   *
+   * @param[in,out] task The task added to the queue. It's reset to release the worker thread's reference.
+   */
+  void AddCompletedTask(TextRasterizingTaskPtr& task);
+
+  /**
+   * Applies the rasterized text to the visuals
+   */
+  void ApplyRasterizedText();
+
+  /**
+   * @brief Unregister a previously registered processor
+   */
+  void UnregisterProcessor();
+
+protected:
+  /**
+   * Destructor.
+   */
+  ~TextRasterizeThread() override;
+
+  /**
+   * The entry function of the worker thread.
+   * It fetches task from the Queue and rasterizes the text.
+   */
+  void Run() override;
+
+private:
+  // Undefined
+  TextRasterizeThread(const TextRasterizeThread& thread);
+
+  // Undefined
+  TextRasterizeThread& operator=(const TextRasterizeThread& thread);
+
+private:
+  std::vector<TextRasterizingTaskPtr> mRasterizeTasks; //The queue of the tasks waiting to rasterize the text
+  std::vector<TextRasterizingTaskPtr> mCompletedTasks; //The queue of the tasks with the text rasterization completed
+
+  ConditionalWait                      mConditionalWait;
+  Dali::Mutex                          mMutex;
+  std::unique_ptr<EventThreadCallback> mTrigger;
+  const Dali::LogFactoryInterface&     mLogFactory;
+  bool                                 mIsThreadWaiting; ///< Whether the thread waits for a task, so AddTask() needs to wake it up
+  bool                                 mProcessorRegistered;
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_RASTERIZE_THREAD_H
@@ -20,10 +20,10 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/image-loading.h>
-#include <dali/devel-api/images/pixel-data-devel.h>
 #include <dali/devel-api/rendering/renderer-devel.h>
 #include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
 #include <dali/integration-api/debug.h>
+#include <algorithm>
 #include <string.h>
 
 // INTERNAL HEADER
@@ -31,6 +31,7 @@
 #include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
 #include <dali-toolkit/devel-api/visuals/text-visual-properties-devel.h>
 #include <dali-toolkit/internal/graphics/builtin-shader-extern-gen.h>
+#include <dali-toolkit/internal/text/rendering/view-model.h>
 #include <dali-toolkit/internal/text/script-run.h>
 #include <dali-toolkit/internal/text/text-effects-style.h>
 #include <dali-toolkit/internal/text/text-enumerations-impl.h>
@@ -255,7 +256,14 @@ TextVisual::TextVisual(VisualFactoryCache& factoryCache)
   mTypesetter(Text::Typesetter::New(mController->GetTextModel())),
   mAnimatableTextColorPropertyIndex(Property::INVALID_INDEX),
   mTextColorAnimatableIndex(Property::INVALID_INDEX),
-  mRendererUpdateNeeded(false)
+  mRendererUpdateNeeded(false),
+  mAsyncRendering(false),
+  mVisibleAreaChanged(false),
+  mRasterizingTask(),
+  mVisibleArea(Vector4::ZERO),
+  mTilingInfo(),
+  mPendingTiles(),
+  mRenderedTiles()
 {
   // Enable the pre-multiplied alpha to improve the text quality
   mImpl->mFlags |= Impl::IS_PREMULTIPLIED_ALPHA;
@@ -358,6 +366,11 @@ void TextVisual::RemoveRenderer(Actor& actor)
   }
   // Clear the renderer list
   mRendererList.clear();
+
+  // The tiles belong to the removed text.
+  mPendingTiles.clear();
+  mRenderedTiles.clear();
+  mTilingInfo.reset();
 }
 
 void TextVisual::DoSetOffScene(Actor& actor)
@@ -373,6 +386,9 @@ void TextVisual::DoSetOffScene(Actor& actor)
 
   RemoveRenderer(actor);
 
+  // The text rasterized in the worker thread is not needed anymore.
+  CancelRasterizingTask();
+
   // Resets the control handle.
   mControl.Reset();
 }
@@ -508,6 +524,7 @@ void TextVisual::UpdateRenderer()
   {
     // Remove the texture set and any renderer previously set.
     RemoveRenderer(control);
+    CancelRasterizingTask();
 
     // Nothing else to do if the relayout size is zero.
     ResourceReady(Toolkit::Visual::ResourceStatus::READY);
@@ -516,14 +533,26 @@ void TextVisual::UpdateRenderer()
 
   Dali::LayoutDirection::Type layoutDirection = mController->GetLayoutDirection(control);
 
+  // A new text is cut into tiles for the current visible area.
+  const bool visibleAreaChanged = mVisibleAreaChanged;
+  mVisibleAreaChanged           = false;
+
   const Text::Controller::UpdateTextType updateTextType = mController->Relayout(relayoutSize, layoutDirection);
 
   if(Text::Controller::NONE_UPDATED != (Text::Controller::MODEL_UPDATED & updateTextType) || mRendererUpdateNeeded)
   {
     mRendererUpdateNeeded = false;
 
-    // Remove the texture set and any renderer previously set.
-    RemoveRenderer(control);
+    // A text higher than the maximum texture size is tiled, which is done synchronously.
+    const bool asyncRendering = mAsyncRendering && (relayoutSize.height < Dali::GetMaxTextureSize());
+
+    if(!asyncRendering)
+    {
+      // Remove the texture set and any renderer previously set.
+      // When rasterizing asynchronously, they are kept until the new textures are ready.
+      RemoveRenderer(control);
+      CancelRasterizingTask();
+    }
 
     if((relayoutSize.width > Math::MACHINE_EPSILON_1000) &&
        (relayoutSize.height > Math::MACHINE_EPSILON_1000))
@@ -569,12 +598,25 @@ void TextVisual::UpdateRenderer()
       const bool styleEnabled   = (shadowEnabled || underlineEnabled || outlineEnabled || backgroundEnabled || markupProcessorEnabled || strikethroughEnabled);
       const bool isOverlayStyle = underlineEnabled || strikethroughEnabled;
 
-      AddRenderer(control, relayoutSize, hasMultipleTextColors, containsColorGlyph, styleEnabled, isOverlayStyle);
+      if(asyncRendering)
+      {
+        // The resource is ready when the rasterized text is applied.
+        RasterizeTextAsync(relayoutSize, hasMultipleTextColors, containsColorGlyph, styleEnabled);
+      }
+      else
+      {
+        AddRenderer(control, relayoutSize, hasMultipleTextColors, containsColorGlyph, styleEnabled, isOverlayStyle);
 
-      // Text rendered and ready to display
-      ResourceReady(Toolkit::Visual::ResourceStatus::READY);
+        // Text rendered and ready to display
+        ResourceReady(Toolkit::Visual::ResourceStatus::READY);
+      }
     }
   }
+  else if(visibleAreaChanged && mTilingInfo)
+  {
+    // The text is the same, only the tiles which became visible or invisible are updated.
+    UpdateVisibleTiles(control);
+  }
 }
 
 void TextVisual::AddTexture(TextureSet& textureSet, PixelData& data, Sampler& sampler, unsigned int textureSetIndex)
@@ -589,52 +631,36 @@ void TextVisual::AddTexture(TextureSet& textureSet, PixelData& data, Sampler& sa
   textureSet.SetSampler(textureSetIndex, sampler);
 }
 
-PixelData TextVisual::ConvertToPixelData(unsigned char* buffer, int width, int height, int offsetPosition, const Pixel::Format textPixelFormat)
-{
-  int            bpp        = Pixel::GetBytesPerPixel(textPixelFormat);
-  unsigned int   bufferSize = width * height * bpp;
-  unsigned char* dstBuffer  = static_cast<unsigned char*>(malloc(bufferSize));
-  memcpy(dstBuffer, buffer + offsetPosition * bpp, bufferSize);
-  PixelData pixelData = Dali::PixelData::New(dstBuffer,
-                                             bufferSize,
-                                             width,
-                                             height,
-                                             textPixelFormat,
-                                             Dali::PixelData::FREE);
-  return pixelData;
-}
-
-void TextVisual::CreateTextureSet(TilingInfo& info, VisualRenderer& renderer, Sampler& sampler, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled, bool isOverlayStyle)
+void TextVisual::CreateTextureSet(const TilingInfo& info, uint32_t offsetPosition, VisualRenderer& renderer)
 {
   TextureSet   textureSet      = TextureSet::New();
   unsigned int textureSetIndex = 0u;
+  Sampler      sampler         = info.sampler;
 
-  // Convert the buffer to pixel data to make it a texture.
+  const uint32_t height = std::min(info.tileHeight, static_cast<uint32_t>(info.size.height) - offsetPosition);
 
-  if(info.textBuffer)
-  {
-    PixelData data = ConvertToPixelData(info.textBuffer, info.width, info.height, info.offsetPosition, info.textPixelFormat);
-    AddTexture(textureSet, data, sampler, textureSetIndex);
-    ++textureSetIndex;
-  }
+  // Render only the rows of the tile, so the whole text is never allocated at once.
+  PixelData data = mTypesetter->RenderBand(info.size, info.textDirection, Text::Typesetter::RENDER_NO_STYLES, false, info.textPixelFormat, offsetPosition, height);
+  AddTexture(textureSet, data, sampler, textureSetIndex);
+  ++textureSetIndex;
 
-  if(styleEnabled && info.styleBuffer && info.overlayStyleBuffer)
+  if(info.styleEnabled)
   {
-    PixelData styleData = ConvertToPixelData(info.styleBuffer, info.width, info.height, info.offsetPosition, Pixel::RGBA8888);
+    PixelData styleData = mTypesetter->RenderBand(info.size, info.textDirection, Text::Typesetter::RENDER_NO_TEXT, false, Pixel::RGBA8888, offsetPosition, height);
     AddTexture(textureSet, styleData, sampler, textureSetIndex);
     ++textureSetIndex;
 
     // TODO : We need to seperate whether use overlayStyle or not.
     // Current text visual shader required both of them.
 
-    PixelData overlayStyleData = ConvertToPixelData(info.overlayStyleBuffer, info.width, info.height, info.offsetPosition, Pixel::RGBA8888);
+    PixelData overlayStyleData = mTypesetter->RenderBand(info.size, info.textDirection, Text::Typesetter::RENDER_OVERLAY_STYLE, false, Pixel::RGBA8888, offsetPosition, height);
     AddTexture(textureSet, overlayStyleData, sampler, textureSetIndex);
     ++textureSetIndex;
   }
 
-  if(containsColorGlyph && !hasMultipleTextColors && info.maskBuffer)
+  if(info.containsColorGlyph && !info.hasMultipleTextColors)
   {
-    PixelData maskData = ConvertToPixelData(info.maskBuffer, info.width, info.height, info.offsetPosition, Pixel::L8);
+    PixelData maskData = mTypesetter->RenderBand(info.size, info.textDirection, Text::Typesetter::RENDER_MASK, false, Pixel::L8, offsetPosition, height);
     AddTexture(textureSet, maskData, sampler, textureSetIndex);
   }
 
@@ -648,14 +674,86 @@ void TextVisual::CreateTextureSet(TilingInfo& info, VisualRenderer& renderer, Sa
   renderer.RegisterProperty(PREMULTIPLIED_ALPHA, 1.0f);
 
   // Set size and offset for the tiling.
-  renderer.SetProperty(VisualRenderer::Property::TRANSFORM_SIZE, Vector2(info.width, info.height));
-  renderer.SetProperty(VisualRenderer::Property::TRANSFORM_OFFSET, Vector2(info.offSet.x, info.offSet.y));
+  renderer.SetProperty(VisualRenderer::Property::TRANSFORM_SIZE, Vector2(info.size.width, static_cast<float>(height)));
+  renderer.SetProperty(VisualRenderer::Property::TRANSFORM_OFFSET, Vector2(info.offSet.x, info.offSet.y + static_cast<float>(offsetPosition)));
   renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
-  renderer.RegisterProperty("uHasMultipleTextColors", static_cast<float>(hasMultipleTextColors));
+  renderer.RegisterProperty("uHasMultipleTextColors", static_cast<float>(info.hasMultipleTextColors));
 
   mRendererList.push_back(renderer);
 }
 
+bool TextVisual::IsTileVisible(uint32_t offsetPosition, float margin) const
+{
+  if(mVisibleArea.z < Math::MACHINE_EPSILON_1000 || mVisibleArea.w < Math::MACHINE_EPSILON_1000)
+  {
+    // The whole control is visible.
+    return true;
+  }
+
+  const uint32_t height     = std::min(mTilingInfo->tileHeight, static_cast<uint32_t>(mTilingInfo->size.height) - offsetPosition);
+  const float    tileTop    = mTilingInfo->offSet.y + static_cast<float>(offsetPosition);
+  const float    tileBottom = tileTop + static_cast<float>(height);
+
+  return (tileTop < mVisibleArea.y + mVisibleArea.w + margin) && (tileBottom > mVisibleArea.y - margin);
+}
+
+void TextVisual::UpdateVisibleTiles(Actor& actor)
+{
+  // Release the tiles scrolled away by more than the height of the visible area, with their textures.
+  // The tiles just out of the visible area are kept, so scrolling back and forth doesn't render them again.
+  for(std::vector<Tile>::iterator iter = mRenderedTiles.begin(); iter != mRenderedTiles.end();)
+  {
+    if(IsTileVisible(iter->offsetPosition, mVisibleArea.w))
+    {
+      ++iter;
+      continue;
+    }
+
+    actor.RemoveRenderer(iter->renderer);
+    mRendererList.erase(std::find(mRendererList.begin(), mRendererList.end(), iter->renderer));
+
+    if(iter->renderer == mImpl->mRenderer)
+    {
+      // The default renderer is kept for the next tile rendered, only its textures are released.
+      mImpl->mRenderer.SetTextures(TextureSet::New());
+    }
+
+    mPendingTiles.push_back(iter->offsetPosition);
+    iter = mRenderedTiles.erase(iter);
+  }
+
+  Geometry geometry = mFactoryCache.GetGeometry(VisualFactoryCache::QUAD_GEOMETRY);
+
+  for(std::vector<uint32_t>::iterator iter = mPendingTiles.begin(); iter != mPendingTiles.end();)
+  {
+    if(!IsTileVisible(*iter, 0.f))
+    {
+      ++iter;
+      continue;
+    }
+
+    // The default renderer is used by a tile, unless another one uses it already.
+    VisualRenderer renderer = mImpl->mRenderer;
+    if(std::find(mRendererList.begin(), mRendererList.end(), mImpl->mRenderer) != mRendererList.end())
+    {
+      renderer = VisualRenderer::New(geometry, mTilingInfo->shader);
+      renderer.SetProperty(Dali::Renderer::Property::DEPTH_INDEX, Toolkit::DepthIndex::CONTENT);
+    }
+
+    CreateTextureSet(*mTilingInfo, *iter, renderer);
+    AddTextRenderer(actor, renderer);
+    mRenderedTiles.push_back(Tile{*iter, renderer});
+
+    iter = mPendingTiles.erase(iter);
+  }
+}
+
+void TextVisual::SetVisibleArea(const Vector4& visibleArea)
+{
+  mVisibleArea        = visibleArea;
+  mVisibleAreaChanged = true;
+}
+
 void TextVisual::AddRenderer(Actor& actor, const Vector2& size, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled, bool isOverlayStyle)
 {
   Shader shader = GetTextShader(mFactoryCache, hasMultipleTextColors, containsColorGlyph, styleEnabled);
@@ -669,13 +767,7 @@ void TextVisual::AddRenderer(Actor& actor, const Vector2& size, bool hasMultiple
   {
     TextureSet textureSet = GetTextTexture(size, hasMultipleTextColors, containsColorGlyph, styleEnabled, isOverlayStyle);
 
-    mImpl->mRenderer.SetTextures(textureSet);
-    //Register transform properties
-    mImpl->mTransform.SetUniforms(mImpl->mRenderer, Direction::LEFT_TO_RIGHT);
-    mImpl->mRenderer.RegisterProperty("uHasMultipleTextColors", static_cast<float>(hasMultipleTextColors));
-    mImpl->mRenderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
-
-    mRendererList.push_back(mImpl->mRenderer);
+    SetDefaultRendererTextures(textureSet, hasMultipleTextColors);
   }
   // If the pixel data exceeds the maximum size, tiling is required.
   else
@@ -690,42 +782,14 @@ void TextVisual::AddRenderer(Actor& actor, const Vector2& size, bool hasMultiple
     // Check the text direction
     Toolkit::DevelText::TextDirection::Type textDirection = mController->GetTextDirection();
 
-    // Create a texture for the text without any styles
-    PixelData data = mTypesetter->Render(size, textDirection, Text::Typesetter::RENDER_NO_STYLES, false, textPixelFormat);
-
-    int verifiedWidth  = data.GetWidth();
-    int verifiedHeight = data.GetHeight();
-
     // Set information for creating textures.
-    TilingInfo info(verifiedWidth, maxTextureSize, textPixelFormat);
-
-    // Get the buffer of text.
-    Dali::DevelPixelData::PixelDataBuffer textPixelData = Dali::DevelPixelData::ReleasePixelDataBuffer(data);
-    info.textBuffer                                     = textPixelData.buffer;
-
-    if(styleEnabled)
-    {
-      // Create RGBA texture for all the text styles (without the text itself)
-      PixelData                             styleData      = mTypesetter->Render(size, textDirection, Text::Typesetter::RENDER_NO_TEXT, false, Pixel::RGBA8888);
-      Dali::DevelPixelData::PixelDataBuffer stylePixelData = Dali::DevelPixelData::ReleasePixelDataBuffer(styleData);
-      info.styleBuffer                                     = stylePixelData.buffer;
-
-      // TODO : We need to seperate whether use overlayStyle or not.
-      // Current text visual shader required both of them.
-
-      // Create RGBA texture for all the overlay styles
-      PixelData                             overlayStyleData      = mTypesetter->Render(size, textDirection, Text::Typesetter::RENDER_OVERLAY_STYLE, false, Pixel::RGBA8888);
-      Dali::DevelPixelData::PixelDataBuffer overlayStylePixelData = Dali::DevelPixelData::ReleasePixelDataBuffer(overlayStyleData);
-      info.overlayStyleBuffer                                     = overlayStylePixelData.buffer;
-    }
-
-    if(containsColorGlyph && !hasMultipleTextColors)
-    {
-      // Create a L8 texture as a mask to avoid color glyphs (e.g. emojis) to be affected by text color animation
-      PixelData                             maskData      = mTypesetter->Render(size, textDirection, Text::Typesetter::RENDER_MASK, false, Pixel::L8);
-      Dali::DevelPixelData::PixelDataBuffer maskPixelData = Dali::DevelPixelData::ReleasePixelDataBuffer(maskData);
-      info.maskBuffer                                     = maskPixelData.buffer;
-    }
+    mTilingInfo.reset(new TilingInfo(size, textDirection, textPixelFormat, static_cast<uint32_t>(maxTextureSize)));
+    mTilingInfo->shader                = shader;
+    mTilingInfo->sampler               = sampler;
+    mTilingInfo->hasMultipleTextColors = hasMultipleTextColors;
+    mTilingInfo->containsColorGlyph    = containsColorGlyph;
+    mTilingInfo->styleEnabled          = styleEnabled;
+    mTilingInfo->isOverlayStyle        = isOverlayStyle;
 
     // Get the current offset for recalculate the offset when tiling.
     Property::Map retMap;
@@ -733,73 +797,153 @@ void TextVisual::AddRenderer(Actor& actor, const Vector2& size, bool hasMultiple
     Property::Value* offsetValue = retMap.Find(Dali::Toolkit::Visual::Transform::Property::OFFSET);
     if(offsetValue)
     {
-      offsetValue->Get(info.offSet);
+      offsetValue->Get(mTilingInfo->offSet);
     }
 
-    // Create a textureset in the default renderer.
-    CreateTextureSet(info, mImpl->mRenderer, sampler, hasMultipleTextColors, containsColorGlyph, styleEnabled, isOverlayStyle);
+    // Elide the text and measure its lines once for all the tiles.
+    mTypesetter->PrepareBands();
 
-    verifiedHeight -= maxTextureSize;
-
-    Geometry geometry = mFactoryCache.GetGeometry(VisualFactoryCache::QUAD_GEOMETRY);
-
-    int offsetPosition = verifiedWidth * maxTextureSize;
-    // Create a renderer by cutting maxTextureSize.
-    while(verifiedHeight > 0)
+    // Cut the text into tiles of maxTextureSize rows.
+    // They are rendered once they are within the visible area, see UpdateVisibleTiles().
+    const uint32_t textHeight = static_cast<uint32_t>(size.height);
+    for(uint32_t offsetPosition = 0u; offsetPosition < textHeight; offsetPosition += mTilingInfo->tileHeight)
     {
-      VisualRenderer tilingRenderer = VisualRenderer::New(geometry, shader);
-      tilingRenderer.SetProperty(Dali::Renderer::Property::DEPTH_INDEX, Toolkit::DepthIndex::CONTENT);
-      // New offset position of buffer for tiling.
-      info.offsetPosition += offsetPosition;
-      // New height for tiling.
-      info.height = (verifiedHeight - maxTextureSize) > 0 ? maxTextureSize : verifiedHeight;
-      // New offset for tiling.
-      info.offSet.y += maxTextureSize;
-      // Create a textureset int the new tiling renderer.
-      CreateTextureSet(info, tilingRenderer, sampler, hasMultipleTextColors, containsColorGlyph, styleEnabled, isOverlayStyle);
-
-      verifiedHeight -= maxTextureSize;
+      mPendingTiles.push_back(offsetPosition);
     }
   }
 
   mImpl->mFlags &= ~Impl::IS_ATLASING_APPLIED;
 
-  const Vector4& defaultColor = mController->GetTextModel()->GetDefaultColor();
-
   for(RendererContainer::iterator iter = mRendererList.begin(); iter != mRendererList.end(); ++iter)
   {
     Renderer renderer = (*iter);
     if(renderer)
     {
-      actor.AddRenderer(renderer);
+      AddTextRenderer(actor, renderer);
+    }
+  }
+
+  // Render the tiles within the visible area, if the text is tiled.
+  UpdateVisibleTiles(actor);
+}
 
-      if(renderer != mImpl->mRenderer)
+void TextVisual::AddTextRenderer(Actor& actor, Renderer& renderer)
+{
+  actor.AddRenderer(renderer);
+
+  if(renderer != mImpl->mRenderer)
+  {
+    // Set constraint for text label's color for non-default renderers.
+    if(mAnimatableTextColorPropertyIndex != Property::INVALID_INDEX)
+    {
+      const Vector4& defaultColor = mController->GetTextModel()->GetDefaultColor();
+
+      // Register unique property, or get property for default renderer.
+      Property::Index index = renderer.RegisterUniqueProperty("uTextColorAnimatable", defaultColor);
+
+      // Create constraint for the animatable text's color Property with uTextColorAnimatable in the renderer.
+      if(index != Property::INVALID_INDEX)
       {
-        // Set constraint for text label's color for non-default renderers.
-        if(mAnimatableTextColorPropertyIndex != Property::INVALID_INDEX)
-        {
-          // Register unique property, or get property for default renderer.
-          Property::Index index = renderer.RegisterUniqueProperty("uTextColorAnimatable", defaultColor);
-
-          // Create constraint for the animatable text's color Property with uTextColorAnimatable in the renderer.
-          if(index != Property::INVALID_INDEX)
-          {
-            Constraint colorConstraint = Constraint::New<Vector4>(renderer, index, TextColorConstraint);
-            colorConstraint.AddSource(Source(actor, mAnimatableTextColorPropertyIndex));
-            colorConstraint.Apply();
-          }
-
-          // Make zero if the alpha value of text color is zero to skip rendering text
-          // VisualRenderer::Property::OPACITY uses same animatable property internally.
-          Constraint opacityConstraint = Constraint::New<float>(renderer, Dali::DevelRenderer::Property::OPACITY, OpacityConstraint);
-          opacityConstraint.AddSource(Source(actor, mAnimatableTextColorPropertyIndex));
-          opacityConstraint.Apply();
-        }
+        Constraint colorConstraint = Constraint::New<Vector4>(renderer, index, TextColorConstraint);
+        colorConstraint.AddSource(Source(actor, mAnimatableTextColorPropertyIndex));
+        colorConstraint.Apply();
       }
+
+      // Make zero if the alpha value of text color is zero to skip rendering text
+      // VisualRenderer::Property::OPACITY uses same animatable property internally.
+      Constraint opacityConstraint = Constraint::New<float>(renderer, Dali::DevelRenderer::Property::OPACITY, OpacityConstraint);
+      opacityConstraint.AddSource(Source(actor, mAnimatableTextColorPropertyIndex));
+      opacityConstraint.Apply();
     }
   }
 }
 
+void TextVisual::SetDefaultRendererTextures(TextureSet& textureSet, bool hasMultipleTextColors)
+{
+  mImpl->mRenderer.SetTextures(textureSet);
+  //Register transform properties
+  mImpl->mTransform.SetUniforms(mImpl->mRenderer, Direction::LEFT_TO_RIGHT);
+  mImpl->mRenderer.RegisterProperty("uHasMultipleTextColors", static_cast<float>(hasMultipleTextColors));
+  mImpl->mRenderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
+
+  mRendererList.push_back(mImpl->mRenderer);
+}
+
+void TextVisual::RasterizeTextAsync(const Vector2& size, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled)
+{
+  // The tiles of a previous text, still displayed until the new one is rasterized, aren't updated anymore.
+  mPendingTiles.clear();
+  mRenderedTiles.clear();
+  mTilingInfo.reset();
+
+  // Elide the text in the main thread. The snapshot taken by the task keeps the elided glyphs.
+  Text::ViewModel* viewModel = mTypesetter->GetViewModel();
+  viewModel->ElideGlyphs();
+
+  // A task still waiting for the same visual is replaced by the new one.
+  mRasterizingTask = new TextRasterizingTask(this, *viewModel, size, mController->GetTextDirection(), hasMultipleTextColors, containsColorGlyph, styleEnabled);
+  mFactoryCache.GetTextRasterizationThread()->AddTask(mRasterizingTask);
+}
+
+void TextVisual::CancelRasterizingTask()
+{
+  if(mRasterizingTask)
+  {
+    mFactoryCache.GetTextRasterizationThread()->RemoveTask(this);
+    mRasterizingTask.Reset();
+  }
+}
+
+void TextVisual::ApplyRasterizedText(TextRasterizingTaskPtr task)
+{
+  if(task != mRasterizingTask)
+  {
+    // The text has been changed or the visual put off stage since the task was added.
+    return;
+  }
+  mRasterizingTask.Reset();
+
+  Actor control = mControl.GetHandle();
+  if(!control)
+  {
+    return;
+  }
+
+  // Swap the previous textures with the rasterized ones.
+  RemoveRenderer(control);
+
+  const bool hasMultipleTextColors = task->HasMultipleTextColors();
+
+  Shader shader = GetTextShader(mFactoryCache, hasMultipleTextColors, task->ContainsColorGlyph(), task->IsStyleEnabled());
+  mImpl->mRenderer.SetShader(shader);
+
+  // Filter mode needs to be set to linear to produce better quality while scaling.
+  Sampler sampler = Sampler::New();
+  sampler.SetFilterMode(FilterMode::LINEAR, FilterMode::LINEAR);
+
+  TextureSet   textureSet      = TextureSet::New();
+  unsigned int textureSetIndex = 0u;
+
+  PixelData pixelData[] = {task->GetTextPixelData(), task->GetStylePixelData(), task->GetOverlayStylePixelData(), task->GetMaskPixelData()};
+  for(PixelData& data : pixelData)
+  {
+    if(data)
+    {
+      AddTexture(textureSet, data, sampler, textureSetIndex);
+      ++textureSetIndex;
+    }
+  }
+
+  SetDefaultRendererTextures(textureSet, hasMultipleTextColors);
+
+  mImpl->mFlags &= ~Impl::IS_ATLASING_APPLIED;
+
+  control.AddRenderer(mImpl->mRenderer);
+
+  // Text rendered and ready to display
+  ResourceReady(Toolkit::Visual::ResourceStatus::READY);
+}
+
 TextureSet TextVisual::GetTextTexture(const Vector2& size, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled, bool isOverlayStyle)
 {
   // Filter mode needs to be set to linear to produce better quality while scaling.
@@ -814,11 +958,14 @@ TextureSet TextVisual::GetTextTexture(const Vector2& size, bool hasMultipleTextC
   // Check the text direction
   Toolkit::DevelText::TextDirection::Type textDirection = mController->GetTextDirection();
 
+  // Elide the text and measure its lines once for all the textures.
+  mTypesetter->PrepareBands();
+
+  const uint32_t textHeight = static_cast<uint32_t>(size.height);
+
   // Create a texture for the text without any styles
-  PixelData data = mTypesetter->Render(size, textDirection, Text::Typesetter::RENDER_NO_STYLES, false, textPixelFormat);
+  PixelData data = mTypesetter->RenderBand(size, textDirection, Text::Typesetter::RENDER_NO_STYLES, false, textPixelFormat, 0u, textHeight);
 
-  // It may happen the image atlas can't handle a pixel data it exceeds the maximum size.
-  // In that case, create a texture. TODO: should tile the text.
   unsigned int textureSetIndex = 0u;
   AddTexture(textureSet, data, sampler, textureSetIndex);
   ++textureSetIndex;
@@ -826,7 +973,7 @@ TextureSet TextVisual::GetTextTexture(const Vector2& size, bool hasMultipleTextC
   if(styleEnabled)
   {
     // Create RGBA texture for all the text styles that render in the background (without the text itself)
-    PixelData styleData = mTypesetter->Render(size, textDirection, Text::Typesetter::RENDER_NO_TEXT, false, Pixel::RGBA8888);
+    PixelData styleData = mTypesetter->RenderBand(size, textDirection, Text::Typesetter::RENDER_NO_TEXT, false, Pixel::RGBA8888, 0u, textHeight);
     AddTexture(textureSet, styleData, sampler, textureSetIndex);
     ++textureSetIndex;
 
@@ -834,7 +981,7 @@ TextureSet TextVisual::GetTextTexture(const Vector2& size, bool hasMultipleTextC
     // Current text visual shader required both of them.
 
     // Create RGBA texture for overlay styles such as underline and strikethrough (without the text itself)
-    PixelData overlayStyleData = mTypesetter->Render(size, textDirection, Text::Typesetter::RENDER_OVERLAY_STYLE, false, Pixel::RGBA8888);
+    PixelData overlayStyleData = mTypesetter->RenderBand(size, textDirection, Text::Typesetter::RENDER_OVERLAY_STYLE, false, Pixel::RGBA8888, 0u, textHeight);
     AddTexture(textureSet, overlayStyleData, sampler, textureSetIndex);
     ++textureSetIndex;
   }
@@ -842,7 +989,7 @@ TextureSet TextVisual::GetTextTexture(const Vector2& size, bool hasMultipleTextC
   if(containsColorGlyph && !hasMultipleTextColors)
   {
     // Create a L8 texture as a mask to avoid color glyphs (e.g. emojis) to be affected by text color animation
-    PixelData maskData = mTypesetter->Render(size, textDirection, Text::Typesetter::RENDER_MASK, false, Pixel::L8);
+    PixelData maskData = mTypesetter->RenderBand(size, textDirection, Text::Typesetter::RENDER_MASK, false, Pixel::L8, 0u, textHeight);
 
     AddTexture(textureSet, maskData, sampler, textureSetIndex);
   }
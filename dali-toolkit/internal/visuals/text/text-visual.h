@@ -23,10 +23,12 @@
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/object/weak-handle.h>
 #include <dali/public-api/rendering/visual-renderer.h>
+#include <memory>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/rendering/text-typesetter.h>
 #include <dali-toolkit/internal/text/text-controller.h>
+#include <dali-toolkit/internal/visuals/text/text-rasterize-thread.h>
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
 
 namespace Dali
@@ -122,6 +124,74 @@ public:
     GetVisualObject(visual).UpdateRenderer();
   };
 
+  /**
+   * @brief Set whether the text is rasterized in a worker thread.
+   *
+   * When enabled, the previous textures are shown until the new ones are rasterized.
+   * When disabled (the default), the text is rasterized synchronously when the renderer is updated.
+   *
+   * @param[in] visual The text visual.
+   * @param[in] asyncRendering Whether to rasterize the text in a worker thread.
+   */
+  static void SetAsyncRendering(Toolkit::Visual::Base visual, bool asyncRendering)
+  {
+    GetVisualObject(visual).mAsyncRendering = asyncRendering;
+  };
+
+  /**
+   * @brief Whether the text is rasterized in a worker thread.
+   * @param[in] visual The text visual.
+   * @return True if the text is rasterized in a worker thread.
+   */
+  static bool IsAsyncRendering(Toolkit::Visual::Base visual)
+  {
+    return GetVisualObject(visual).mAsyncRendering;
+  };
+
+  /**
+   * @brief Set the area of the control where the text is visible.
+   *
+   * The tiles of a text higher than the maximum texture size are rendered once they are within the visible area,
+   * and released once they are out of it by more than its height. The tiles are updated by the next UpdateRenderer().
+   *
+   * @param[in] visual The text visual.
+   * @param[in] visibleArea The visible area (x, y, width, height) in the local coordinates of the control, from its top left corner.
+   *                        The whole control is visible if its width or height is zero.
+   */
+  static void SetVisibleArea(Toolkit::Visual::Base visual, const Vector4& visibleArea)
+  {
+    GetVisualObject(visual).SetVisibleArea(visibleArea);
+  };
+
+  /**
+   * @brief Whether the visible area has been changed since the renderer was last updated.
+   * @param[in] visual The text visual.
+   * @return True if the tiles of the text need to be updated.
+   */
+  static bool IsVisibleAreaChanged(Toolkit::Visual::Base visual)
+  {
+    return GetVisualObject(visual).mVisibleAreaChanged;
+  };
+
+  /**
+   * @brief Get the area of the control where the text is visible.
+   * @param[in] visual The text visual.
+   * @return The visible area (x, y, width, height), zero if the whole control is visible.
+   */
+  static const Vector4& GetVisibleArea(Toolkit::Visual::Base visual)
+  {
+    return GetVisualObject(visual).mVisibleArea;
+  };
+
+  /**
+   * @brief Apply the text rasterized in the worker thread to the renderer.
+   *
+   * Called by the TextRasterizeThread. The result is ignored if a newer task has been added since.
+   *
+   * @param[in] task The completed rasterizing task.
+   */
+  void ApplyRasterizedText(TextRasterizingTaskPtr task);
+
 public: // from Visual::Base
   /**
    * @copydoc Visual::Base::GetHeightForWidth()
@@ -191,48 +261,41 @@ protected:
 private:
   struct TilingInfo
   {
-    unsigned char* textBuffer;
-    unsigned char* styleBuffer;
-    unsigned char* overlayStyleBuffer;
-    unsigned char* maskBuffer;
-    int            width;
-    int            height;
-    Pixel::Format  textPixelFormat;
-    int            offsetPosition;
-    Vector2        offSet;
-
-    TilingInfo(int width, int height, Pixel::Format textPixelFormat)
-    : textBuffer(NULL),
-      styleBuffer(NULL),
-      overlayStyleBuffer(NULL),
-      maskBuffer(NULL),
-      width(width),
-      height(height),
+    Vector2                                 size;                  ///< The size of the whole text
+    Toolkit::DevelText::TextDirection::Type textDirection;         ///< The direction of the text
+    Pixel::Format                           textPixelFormat;       ///< The pixel format of the text without styles
+    uint32_t                                tileHeight;            ///< The height of the tiles, the last one may be lower
+    Vector2                                 offSet;                ///< The transform offset of the whole text
+    Shader                                  shader;                ///< The shader of the tiles
+    Sampler                                 sampler;               ///< The sampler of the textures of the tiles
+    bool                                    hasMultipleTextColors; ///< Whether the text contains multiple colors
+    bool                                    containsColorGlyph;    ///< Whether the text contains color glyph
+    bool                                    styleEnabled;          ///< Whether the text contains any styles
+    bool                                    isOverlayStyle;        ///< Whether the style needs to overlay on the text
+
+    TilingInfo(const Vector2& size, Toolkit::DevelText::TextDirection::Type textDirection, Pixel::Format textPixelFormat, uint32_t tileHeight)
+    : size(size),
+      textDirection(textDirection),
       textPixelFormat(textPixelFormat),
-      offsetPosition(0),
-      offSet(0.f, 0.f)
+      tileHeight(tileHeight),
+      offSet(0.f, 0.f),
+      shader(),
+      sampler(),
+      hasMultipleTextColors(false),
+      containsColorGlyph(false),
+      styleEnabled(false),
+      isOverlayStyle(false)
     {
     }
+  };
 
-    ~TilingInfo()
-    {
-      if(textBuffer)
-      {
-        free(textBuffer);
-      }
-      if(styleBuffer)
-      {
-        free(styleBuffer);
-      }
-      if(overlayStyleBuffer)
-      {
-        free(overlayStyleBuffer);
-      }
-      if(maskBuffer)
-      {
-        free(maskBuffer);
-      }
-    }
+  /**
+   * @brief A tile of the text which is rendered.
+   */
+  struct Tile
+  {
+    uint32_t offsetPosition; ///< The vertical position of the tile within the text
+    Renderer renderer;       ///< The renderer of the tile, which holds its textures
   };
 
   /**
@@ -264,26 +327,39 @@ private:
   void AddTexture(TextureSet& textureSet, PixelData& data, Sampler& sampler, unsigned int textureSetIndex);
 
   /**
-   * @brief Convert the buffer to pixelData.
-   * @param[in] buffer The Buffer to be converted to pixelData.
-   * @param[in] width The width of pixel data.
-   * @param[in] height The height of pixel data.
-   * @param[in] offsetPosition The The buffer's start position.
-   * @param[in] textPixelFormat The PixelForma of text.
+   * @brief Render a tile of the text and create its textures.
+   * @param[in] info This is the information you need to create a Tiling.
+   * @param[in] offsetPosition The vertical position of the tile within the text.
+   * @param[in] renderer The renderer to which the TextureSet will be added.
    */
-  PixelData ConvertToPixelData(unsigned char* buffer, int width, int height, int offsetPosition, const Pixel::Format textPixelFormat);
+  void CreateTextureSet(const TilingInfo& info, uint32_t offsetPosition, VisualRenderer& renderer);
 
   /**
-   * @brief Create the text's texture.
-   * @param[in] info This is the information you need to create a Tiling.
-   * @param[in] renderer The renderer to which the TextureSet will be added.
-   * @param[in] sampler The sampler.
-   * @param[in] hasMultipleTextColors Whether the text contains multiple colors.
-   * @param[in] containsColorGlyph Whether the text contains color glyph.
-   * @param[in] styleEnabled Whether the text contains any styles (e.g. shadow, underline, etc.).
-   * @param[in] isOverlayStyle Whether the style needs to overlay on the text (e.g. strikethrough, underline, etc.).
+   * @brief Whether a tile of the text intersects the visible area.
+   * @param[in] offsetPosition The vertical position of the tile within the text.
+   * @param[in] margin The margin added above and below the visible area.
+   * @return True if the tile is visible.
+   */
+  bool IsTileVisible(uint32_t offsetPosition, float margin) const;
+
+  /**
+   * @brief Release the rendered tiles out of the visible area and its margin, then render the pending tiles within the visible area.
+   * @param[in] actor The actor.
    */
-  void CreateTextureSet(TilingInfo& info, VisualRenderer& renderer, Sampler& sampler, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled, bool isOverlayStyle);
+  void UpdateVisibleTiles(Actor& actor);
+
+  /**
+   * @brief Add a renderer of the text to the control.
+   * @param[in] actor The actor.
+   * @param[in] renderer The renderer, either the default one or the one of a tile.
+   */
+  void AddTextRenderer(Actor& actor, Renderer& renderer);
+
+  /**
+   * @brief Set the area of the control where the text is visible. The tiles are updated by the next UpdateRenderer().
+   * @param[in] visibleArea The visible area (x, y, width, height).
+   */
+  void SetVisibleArea(const Vector4& visibleArea);
 
   /**
    * Create renderer of the text for rendering.
@@ -296,6 +372,27 @@ private:
    */
   void AddRenderer(Actor& actor, const Vector2& size, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled, bool isOverlayStyle);
 
+  /**
+   * @brief Add a task to rasterize the text in the worker thread.
+   * @param[in] size The texture size.
+   * @param[in] hasMultipleTextColors Whether the text contains multiple colors.
+   * @param[in] containsColorGlyph Whether the text contains color glyph.
+   * @param[in] styleEnabled Whether the text contains any styles (e.g. shadow, underline, etc.).
+   */
+  void RasterizeTextAsync(const Vector2& size, bool hasMultipleTextColors, bool containsColorGlyph, bool styleEnabled);
+
+  /**
+   * @brief Remove the task rasterizing the text in the worker thread, if any.
+   */
+  void CancelRasterizingTask();
+
+  /**
+   * @brief Set the textures of the text in the default renderer and add it to the renderer list.
+   * @param[in] textureSet The textures of the text.
+   * @param[in] hasMultipleTextColors Whether the text contains multiple colors.
+   */
+  void SetDefaultRendererTextures(TextureSet& textureSet, bool hasMultipleTextColors);
+
   /**
    * Get the texture of the text for rendering.
    * @param[in] size The texture size.
@@ -345,15 +442,23 @@ private:
   };
 
 private:
-  Text::ControllerPtr mController;                       ///< The text's controller.
-  Text::TypesetterPtr mTypesetter;                       ///< The text's typesetter.
-  WeakHandle<Actor>   mControl;                          ///< The control where the renderer is added.
-  Constraint          mColorConstraint{};                ///< Color constraint
-  Constraint          mOpacityConstraint{};              ///< Opacity constraint
-  Property::Index     mAnimatableTextColorPropertyIndex; ///< The index of animatable text color property registered by the control.
-  Property::Index     mTextColorAnimatableIndex;         ///< The index of uTextColorAnimatable property.
-  bool                mRendererUpdateNeeded : 1;         ///< The flag to indicate whether the renderer needs to be updated.
-  RendererContainer   mRendererList;
+  Text::ControllerPtr    mController;                       ///< The text's controller.
+  Text::TypesetterPtr    mTypesetter;                       ///< The text's typesetter.
+  WeakHandle<Actor>      mControl;                          ///< The control where the renderer is added.
+  Constraint             mColorConstraint{};                ///< Color constraint
+  Constraint             mOpacityConstraint{};              ///< Opacity constraint
+  Property::Index        mAnimatableTextColorPropertyIndex; ///< The index of animatable text color property registered by the control.
+  Property::Index        mTextColorAnimatableIndex;         ///< The index of uTextColorAnimatable property.
+  bool                   mRendererUpdateNeeded : 1;         ///< The flag to indicate whether the renderer needs to be updated.
+  bool                   mAsyncRendering : 1;               ///< Whether the text is rasterized in a worker thread.
+  bool                   mVisibleAreaChanged : 1;           ///< Whether the tiles need to be updated for a new visible area.
+  RendererContainer      mRendererList;
+  TextRasterizingTaskPtr mRasterizingTask;                  ///< The task rasterizing the text in the worker thread.
+  Vector4                mVisibleArea;                      ///< The area of the control where the text is visible, zero if the whole control is.
+
+  std::unique_ptr<TilingInfo> mTilingInfo;   ///< The information to render the tiles of a text higher than the maximum texture size.
+  std::vector<uint32_t>       mPendingTiles;  ///< The vertical positions of the tiles not rendered, as they are out of the visible area.
+  std::vector<Tile>           mRenderedTiles; ///< The tiles rendered, within the visible area or its margin.
 };
 
 } // namespace Internal
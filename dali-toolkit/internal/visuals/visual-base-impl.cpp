@@ -173,54 +173,7 @@ void Visual::Base::SetProperties(const Property::Map& propertyMap)
     const Property::Key&   key   = pair.first;
     const Property::Value& value = pair.second;
 
-    Property::Key matchKey = key;
-    if(matchKey.type == Property::Key::STRING)
-    {
-      if(matchKey == CUSTOM_SHADER)
-      {
-        matchKey = Property::Key(Toolkit::Visual::Property::SHADER);
-      }
-      else if(matchKey == TRANSFORM)
-      {
-        matchKey = Property::Key(Toolkit::Visual::Property::TRANSFORM);
-      }
-      else if(matchKey == PREMULTIPLIED_ALPHA)
-      {
-        matchKey = Property::Key(Toolkit::Visual::Property::PREMULTIPLIED_ALPHA);
-      }
-      else if(matchKey == MIX_COLOR)
-      {
-        matchKey = Property::Key(Toolkit::Visual::Property::MIX_COLOR);
-      }
-      else if(matchKey == OPACITY)
-      {
-        matchKey = Property::Key(Toolkit::Visual::Property::OPACITY);
-      }
-      else if(matchKey == VISUAL_FITTING_MODE)
-      {
-        matchKey = Property::Key(Toolkit::DevelVisual::Property::VISUAL_FITTING_MODE);
-      }
-      else if(matchKey == BORDERLINE_WIDTH)
-      {
-        matchKey = Property::Key(Toolkit::DevelVisual::Property::BORDERLINE_WIDTH);
-      }
-      else if(matchKey == BORDERLINE_COLOR)
-      {
-        matchKey = Property::Key(Toolkit::DevelVisual::Property::BORDERLINE_COLOR);
-      }
-      else if(matchKey == BORDERLINE_OFFSET)
-      {
-        matchKey = Property::Key(Toolkit::DevelVisual::Property::BORDERLINE_OFFSET);
-      }
-      else if(matchKey == CORNER_RADIUS)
-      {
-        matchKey = Property::Key(Toolkit::DevelVisual::Property::CORNER_RADIUS);
-      }
-      else if(matchKey == CORNER_RADIUS_POLICY)
-      {
-        matchKey = Property::Key(Toolkit::DevelVisual::Property::CORNER_RADIUS_POLICY);
-      }
-    }
+    Property::Key matchKey = GetPropertyKey(key);
 
     switch(matchKey.indexKey)
     {
@@ -823,6 +776,58 @@ Renderer Visual::Base::GetRenderer()
   return mImpl->mRenderer;
 }
 
+Property::Key Visual::Base::GetPropertyKey(const Property::Key& key)
+{
+  if(key.type == Property::Key::STRING)
+  {
+    if(key.stringKey == CUSTOM_SHADER)
+    {
+      return Property::Key(Toolkit::Visual::Property::SHADER);
+    }
+    else if(key.stringKey == TRANSFORM)
+    {
+      return Property::Key(Toolkit::Visual::Property::TRANSFORM);
+    }
+    else if(key.stringKey == PREMULTIPLIED_ALPHA)
+    {
+      return Property::Key(Toolkit::Visual::Property::PREMULTIPLIED_ALPHA);
+    }
+    else if(key.stringKey == MIX_COLOR)
+    {
+      return Property::Key(Toolkit::Visual::Property::MIX_COLOR);
+    }
+    else if(key.stringKey == OPACITY)
+    {
+      return Property::Key(Toolkit::Visual::Property::OPACITY);
+    }
+    else if(key.stringKey == VISUAL_FITTING_MODE)
+    {
+      return Property::Key(Toolkit::DevelVisual::Property::VISUAL_FITTING_MODE);
+    }
+    else if(key.stringKey == BORDERLINE_WIDTH)
+    {
+      return Property::Key(Toolkit::DevelVisual::Property::BORDERLINE_WIDTH);
+    }
+    else if(key.stringKey == BORDERLINE_COLOR)
+    {
+      return Property::Key(Toolkit::DevelVisual::Property::BORDERLINE_COLOR);
+    }
+    else if(key.stringKey == BORDERLINE_OFFSET)
+    {
+      return Property::Key(Toolkit::DevelVisual::Property::BORDERLINE_OFFSET);
+    }
+    else if(key.stringKey == CORNER_RADIUS)
+    {
+      return Property::Key(Toolkit::DevelVisual::Property::CORNER_RADIUS);
+    }
+    else if(key.stringKey == CORNER_RADIUS_POLICY)
+    {
+      return Property::Key(Toolkit::DevelVisual::Property::CORNER_RADIUS_POLICY);
+    }
+  }
+  return key;
+}
+
 Property::Index Visual::Base::GetIntKey(Property::Key key)
 {
   if(key.type == Property::Key::INDEX)
@@ -192,6 +192,13 @@ public:
    */
   static Property::Index GetIntKey(Property::Key key);
 
+  /**
+   * Convert the string key of a property read by SetProperties() to its index key
+   * @param[in] key The key to convert
+   * @return the matching index key, or the key supplied if it is not a string key read by SetProperties()
+   */
+  static Property::Key GetPropertyKey(const Property::Key& key);
+
   /**
    * Sets the mix color ( including opacity )  of the visual.
    * @param[in] mixColor The new mix color
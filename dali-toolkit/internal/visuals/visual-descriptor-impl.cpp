@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/visuals/visual-descriptor-impl.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/scripting/scripting.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/visual-base-impl.h>
+#include <dali-toolkit/internal/visuals/visual-string-constants.h>
+#include <dali-toolkit/public-api/visuals/image-visual-properties.h>
+#include <dali-toolkit/public-api/visuals/visual-properties.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+namespace
+{
+/**
+ * @return true if the visual of the given type is created from an url.
+ */
+bool HasUrl(Toolkit::DevelVisual::Type visualType)
+{
+  switch(visualType)
+  {
+    case Toolkit::DevelVisual::IMAGE:
+    case Toolkit::DevelVisual::N_PATCH:
+    case Toolkit::DevelVisual::SVG:
+    case Toolkit::DevelVisual::ANIMATED_IMAGE:
+    case Toolkit::DevelVisual::ANIMATED_VECTOR_IMAGE:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+} // namespace
+
+VisualDescriptorPtr VisualDescriptor::New(const Property::Map& propertyMap)
+{
+  return new VisualDescriptor(propertyMap);
+}
+
+void VisualDescriptor::Parse(const Property::Map& propertyMap, Toolkit::DevelVisual::Type& visualType, VisualUrl& visualUrl, const Property::Array*& urlArray)
+{
+  Property::Value* typeValue = propertyMap.Find(Toolkit::Visual::Property::TYPE, VISUAL_TYPE);
+  visualType                 = Toolkit::DevelVisual::IMAGE; // Default to IMAGE type.
+  if(typeValue)
+  {
+    Scripting::GetEnumerationProperty(*typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, visualType);
+  }
+
+  visualUrl = VisualUrl();
+  urlArray  = nullptr;
+  if(HasUrl(visualType))
+  {
+    Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
+    if(imageURLValue)
+    {
+      std::string imageUrl;
+      if(imageURLValue->Get(imageUrl))
+      {
+        if(!imageUrl.empty())
+        {
+          visualUrl = VisualUrl(imageUrl);
+        }
+      }
+      else if(visualType == Toolkit::DevelVisual::IMAGE || visualType == Toolkit::DevelVisual::ANIMATED_IMAGE)
+      {
+        const Property::Array* array = imageURLValue->GetArray();
+        if(array && array->Count() > 0)
+        {
+          urlArray = array;
+        }
+      }
+    }
+  }
+}
+
+const Property::Map& VisualDescriptor::GetProperties() const
+{
+  return mProperties;
+}
+
+Toolkit::DevelVisual::Type VisualDescriptor::GetVisualType() const
+{
+  return mVisualType;
+}
+
+const VisualUrl& VisualDescriptor::GetUrl() const
+{
+  return mUrl;
+}
+
+const Property::Array* VisualDescriptor::GetUrlArray() const
+{
+  return mUrlArray;
+}
+
+VisualDescriptor::VisualDescriptor(const Property::Map& propertyMap)
+: mProperties(),
+  mVisualType(Toolkit::DevelVisual::IMAGE),
+  mUrl(),
+  mUrlArray(nullptr)
+{
+  Parse(propertyMap, mVisualType, mUrl, mUrlArray);
+
+  // Convert the string keys which every visual reads to index keys now, rather than matching them for each visual created.
+  const bool hasUrl = HasUrl(mVisualType);
+  for(Property::Map::SizeType i = 0; i < propertyMap.Count(); ++i)
+  {
+    const KeyValuePair& pair = propertyMap.GetKeyValue(i);
+
+    Property::Key key = Visual::Base::GetPropertyKey(pair.first);
+    if(key.type == Property::Key::STRING)
+    {
+      if(key.stringKey == VISUAL_TYPE)
+      {
+        key = Property::Key(Toolkit::Visual::Property::TYPE);
+      }
+      else if(hasUrl && key.stringKey == IMAGE_URL_NAME)
+      {
+        key = Property::Key(Toolkit::ImageVisual::Property::URL);
+      }
+    }
+
+    if(key.type == Property::Key::INDEX)
+    {
+      mProperties.Insert(key.indexKey, pair.second);
+    }
+    else
+    {
+      mProperties.Insert(key.stringKey, pair.second);
+    }
+  }
+
+  // Find the array of urls again, in our own map.
+  Parse(mProperties, mVisualType, mUrl, mUrlArray);
+  if(mUrl.IsValid())
+  {
+    // Calculate the hash now, so that the visuals copying the url don't calculate it again.
+    mUrl.GetUrlHash();
+  }
+}
+
+VisualDescriptor::~VisualDescriptor()
+{
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,127 @@
+#ifndef DALI_TOOLKIT_INTERNAL_VISUAL_DESCRIPTOR_H
+#define DALI_TOOLKIT_INTERNAL_VISUAL_DESCRIPTOR_H
+
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/object/property-array.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/visual-factory/visual-descriptor.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <dali-toolkit/internal/visuals/visual-url.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace Internal
+{
+class VisualDescriptor;
+typedef IntrusivePtr<VisualDescriptor> VisualDescriptorPtr;
+
+/**
+ * VisualDescriptor holds a visual property map with the properties the VisualFactory needs to
+ * choose the visual, i.e. the visual type and the url, already parsed, and with the string keys
+ * of the properties which every visual reads already converted to index keys.
+ */
+class VisualDescriptor : public BaseObject
+{
+public:
+  /**
+   * @copydoc Dali::Toolkit::VisualDescriptor::New()
+   */
+  static VisualDescriptorPtr New(const Property::Map& propertyMap);
+
+  /**
+   * @brief Find the properties which choose the visual in a property map.
+   *
+   * @param[in] propertyMap The properties of the visual
+   * @param[out] visualType The type of the visual, IMAGE if the map has no type
+   * @param[out] visualUrl The url of the visual, if the visual has an url; invalid otherwise
+   * @param[out] urlArray The urls of an animated image given as an array, or nullptr. It points into propertyMap.
+   */
+  static void Parse(const Property::Map& propertyMap, Toolkit::DevelVisual::Type& visualType, VisualUrl& visualUrl, const Property::Array*& urlArray);
+
+  /**
+   * @copydoc Dali::Toolkit::VisualDescriptor::GetProperties()
+   */
+  const Property::Map& GetProperties() const;
+
+  /**
+   * @brief Get the type of the visual.
+   * @return The visual type
+   */
+  Toolkit::DevelVisual::Type GetVisualType() const;
+
+  /**
+   * @brief Get the url of the visual, with its location and type resolved.
+   * @return The url, invalid if the visual has no url
+   */
+  const VisualUrl& GetUrl() const;
+
+  /**
+   * @brief Get the urls of an animated image, if they're given as an array.
+   * @return The array of urls, or nullptr
+   */
+  const Property::Array* GetUrlArray() const;
+
+private: // Implementation
+  /**
+   * Ref counted object - Only allow construction via New().
+   */
+  VisualDescriptor(const Property::Map& propertyMap);
+
+protected:
+  /**
+   *  A ref counted object may only be deleted by calling Unreference
+   */
+  ~VisualDescriptor() override;
+
+private: // Unimplemented methods
+  VisualDescriptor(const VisualDescriptor&);
+  VisualDescriptor& operator=(const VisualDescriptor&);
+
+private:                                  // Data members
+  Property::Map              mProperties; ///< The properties of the visual, with the common keys as index keys; never changed, as mUrlArray points into it
+  Toolkit::DevelVisual::Type mVisualType; ///< The type of the visual
+  VisualUrl                  mUrl;        ///< The resolved url of the visual
+  const Property::Array*     mUrlArray;   ///< The urls of an animated image, in mProperties
+};
+
+} // namespace Internal
+
+// Helpers for public-api forwarding methods
+inline Internal::VisualDescriptor& GetImplementation(Dali::Toolkit::VisualDescriptor& handle)
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualDescriptor handle is empty");
+  BaseObject& object = handle.GetBaseObject();
+  return static_cast<Internal::VisualDescriptor&>(object);
+}
+
+inline const Internal::VisualDescriptor& GetImplementation(const Dali::Toolkit::VisualDescriptor& handle)
+{
+  DALI_ASSERT_ALWAYS(handle && "VisualDescriptor handle is empty");
+  const BaseObject& object = handle.GetBaseObject();
+  return static_cast<const Internal::VisualDescriptor&>(object);
+}
+
+} // namespace Toolkit
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_VISUAL_DESCRIPTOR_H
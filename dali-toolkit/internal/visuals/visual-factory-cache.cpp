@@ -28,6 +28,7 @@
 #include <dali-toolkit/internal/visuals/color/color-visual.h>
 #include <dali-toolkit/internal/visuals/image-atlas-manager.h>
 #include <dali-toolkit/internal/visuals/svg/svg-visual.h>
+#include <dali-toolkit/internal/visuals/text/text-rasterize-thread.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali/integration-api/debug.h>
 
@@ -43,7 +44,8 @@ const Vector4 FULL_TEXTURE_RECT(0.f, 0.f, 1.f, 1.f);
 }
 
 VisualFactoryCache::VisualFactoryCache(bool preMultiplyOnLoad)
-: mSvgRasterizeThread(NULL),
+: mSvgCache(),
+  mTextRasterizeThread(NULL),
   mVectorAnimationManager(),
   mPreMultiplyOnLoad(preMultiplyOnLoad),
   mBrokenImageInfoContainer(),
@@ -54,7 +56,7 @@ VisualFactoryCache::VisualFactoryCache(bool preMultiplyOnLoad)
 
 VisualFactoryCache::~VisualFactoryCache()
 {
-  SvgRasterizeThread::TerminateThread(mSvgRasterizeThread);
+  TextRasterizeThread::TerminateThread(mTextRasterizeThread);
 }
 
 Geometry VisualFactoryCache::GetGeometry(GeometryType type)
@@ -131,14 +133,19 @@ NPatchLoader& VisualFactoryCache::GetNPatchLoader()
   return mNPatchLoader;
 }
 
-SvgRasterizeThread* VisualFactoryCache::GetSVGRasterizationThread()
+SvgCache& VisualFactoryCache::GetSvgCache()
 {
-  if(!mSvgRasterizeThread)
+  return mSvgCache;
+}
+
+TextRasterizeThread* VisualFactoryCache::GetTextRasterizationThread()
+{
+  if(!mTextRasterizeThread)
   {
-    mSvgRasterizeThread = new SvgRasterizeThread();
-    mSvgRasterizeThread->Start();
+    mTextRasterizeThread = new TextRasterizeThread();
+    mTextRasterizeThread->Start();
   }
-  return mSvgRasterizeThread;
+  return mTextRasterizeThread;
 }
 
 VectorAnimationManager& VisualFactoryCache::GetVectorAnimationManager()
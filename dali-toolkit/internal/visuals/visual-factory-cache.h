@@ -27,7 +27,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/texture-manager/texture-manager-impl.h>
 #include <dali-toolkit/internal/visuals/npatch-loader.h>
-#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
 #include <dali/devel-api/rendering/renderer-devel.h>
 
 namespace Dali
@@ -40,6 +40,7 @@ namespace Internal
 {
 class ImageAtlasManager;
 class NPatchLoader;
+class TextRasterizeThread;
 class TextureManager;
 class VectorAnimationManager;
 
@@ -235,10 +236,16 @@ public:
   NPatchLoader& GetNPatchLoader();
 
   /**
-   * Get the SVG rasterization thread.
-   * @return A raw pointer pointing to the SVG rasterization thread.
+   * Get the SVG cache.
+   * @return A reference to the SVG cache
    */
-  SvgRasterizeThread* GetSVGRasterizationThread();
+  SvgCache& GetSvgCache();
+
+  /**
+   * Get the text rasterization thread.
+   * @return A raw pointer pointing to the text rasterization thread.
+   */
+  TextRasterizeThread* GetTextRasterizationThread();
 
   /**
    * Get the vector animation manager.
@@ -337,8 +344,9 @@ private:
   ImageAtlasManagerPtr mAtlasManager;
   TextureManager       mTextureManager;
   NPatchLoader         mNPatchLoader;
+  SvgCache             mSvgCache;
 
-  SvgRasterizeThread*                     mSvgRasterizeThread;
+  TextRasterizeThread*                    mTextRasterizeThread;
   std::unique_ptr<VectorAnimationManager> mVectorAnimationManager;
   bool                                    mPreMultiplyOnLoad;
   std::vector<BrokenImageInfo>            mBrokenImageInfoContainer;
@@ -41,6 +41,7 @@
 #include <dali-toolkit/internal/visuals/primitive/primitive-visual.h>
 #include <dali-toolkit/internal/visuals/svg/svg-visual.h>
 #include <dali-toolkit/internal/visuals/text/text-visual.h>
+#include <dali-toolkit/internal/visuals/visual-descriptor-impl.h>
 #include <dali-toolkit/internal/visuals/visual-factory-cache.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
@@ -102,14 +103,24 @@ void VisualFactory::OnBrokenImageChangedSignal(Toolkit::StyleManager styleManage
 
 Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyMap)
 {
-  Visual::BasePtr visualPtr;
+  Toolkit::DevelVisual::Type visualType;
+  VisualUrl                  visualUrl;
+  const Property::Array*     urlArray;
+  VisualDescriptor::Parse(propertyMap, visualType, visualUrl, urlArray);
 
-  Property::Value*           typeValue  = propertyMap.Find(Toolkit::Visual::Property::TYPE, VISUAL_TYPE);
-  Toolkit::DevelVisual::Type visualType = Toolkit::DevelVisual::IMAGE; // Default to IMAGE type.
-  if(typeValue)
-  {
-    Scripting::GetEnumerationProperty(*typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, visualType);
-  }
+  return CreateVisual(visualType, visualUrl, urlArray, propertyMap);
+}
+
+Toolkit::Visual::Base VisualFactory::CreateVisual(const Toolkit::VisualDescriptor& descriptor)
+{
+  const Internal::VisualDescriptor& descriptorImpl = Toolkit::GetImplementation(descriptor);
+
+  return CreateVisual(descriptorImpl.GetVisualType(), descriptorImpl.GetUrl(), descriptorImpl.GetUrlArray(), descriptorImpl.GetProperties());
+}
+
+Toolkit::Visual::Base VisualFactory::CreateVisual(Toolkit::DevelVisual::Type visualType, const VisualUrl& visualUrl, const Property::Array* urlArray, const Property::Map& propertyMap)
+{
+  Visual::BasePtr visualPtr;
 
   switch(visualType)
   {
@@ -133,57 +144,43 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
 
     case Toolkit::Visual::IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-      std::string      imageUrl;
-      if(imageURLValue)
+      if(visualUrl.IsValid())
       {
-        if(imageURLValue->Get(imageUrl))
+        switch(visualUrl.GetType())
         {
-          if(!imageUrl.empty())
+          case VisualUrl::N_PATCH:
           {
-            VisualUrl visualUrl(imageUrl);
-
-            switch(visualUrl.GetType())
-            {
-              case VisualUrl::N_PATCH:
-              {
-                visualPtr = NPatchVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
-                break;
-              }
-              case VisualUrl::TVG:
-              case VisualUrl::SVG:
-              {
-                visualPtr = SvgVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
-                break;
-              }
-              case VisualUrl::GIF:
-              case VisualUrl::WEBP:
-              {
-                visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
-                break;
-              }
-              case VisualUrl::JSON:
-              {
-                visualPtr = AnimatedVectorImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap);
-                break;
-              }
-              case VisualUrl::REGULAR_IMAGE:
-              {
-                visualPtr = ImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
-                break;
-              }
-            }
+            visualPtr = NPatchVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+            break;
           }
-        }
-        else
-        {
-          Property::Array* array = imageURLValue->GetArray();
-          if(array && array->Count() > 0)
+          case VisualUrl::TVG:
+          case VisualUrl::SVG:
+          {
+            visualPtr = SvgVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+            break;
+          }
+          case VisualUrl::GIF:
+          case VisualUrl::WEBP:
+          {
+            visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+            break;
+          }
+          case VisualUrl::JSON:
+          {
+            visualPtr = AnimatedVectorImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+            break;
+          }
+          case VisualUrl::REGULAR_IMAGE:
           {
-            visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), *array, propertyMap);
+            visualPtr = ImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+            break;
           }
         }
       }
+      else if(urlArray)
+      {
+        visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), *urlArray, propertyMap);
+      }
       break;
     }
 
@@ -213,53 +210,31 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
 
     case Toolkit::Visual::N_PATCH:
     {
-      Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-      std::string      imageUrl;
-      if(imageURLValue && imageURLValue->Get(imageUrl))
+      if(visualUrl.IsValid())
       {
-        if(!imageUrl.empty())
-        {
-          visualPtr = NPatchVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap);
-        }
+        visualPtr = NPatchVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
       }
       break;
     }
 
     case Toolkit::Visual::SVG:
     {
-      Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-      std::string      imageUrl;
-      if(imageURLValue && imageURLValue->Get(imageUrl))
+      if(visualUrl.IsValid())
       {
-        if(!imageUrl.empty())
-        {
-          visualPtr = SvgVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap);
-        }
+        visualPtr = SvgVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
       }
       break;
     }
 
     case Toolkit::Visual::ANIMATED_IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-      std::string      imageUrl;
-      if(imageURLValue)
+      if(visualUrl.IsValid())
       {
-        if(imageURLValue->Get(imageUrl))
-        {
-          if(!imageUrl.empty())
-          {
-            visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap);
-          }
-        }
-        else
-        {
-          Property::Array* array = imageURLValue->GetArray();
-          if(array && array->Count() > 0)
-          {
-            visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), *array, propertyMap);
-          }
-        }
+        visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
+      }
+      else if(urlArray)
+      {
+        visualPtr = AnimatedImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), *urlArray, propertyMap);
       }
       break;
     }
@@ -272,14 +247,9 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
 
     case Toolkit::DevelVisual::ANIMATED_VECTOR_IMAGE:
     {
-      Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-      std::string      imageUrl;
-      if(imageURLValue && imageURLValue->Get(imageUrl))
+      if(visualUrl.IsValid())
       {
-        if(!imageUrl.empty())
-        {
-          visualPtr = AnimatedVectorImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), imageUrl, propertyMap);
-        }
+        visualPtr = AnimatedVectorImageVisual::New(GetFactoryCache(), GetImageVisualShaderFactory(), visualUrl, propertyMap);
       }
       break;
     }
@@ -291,12 +261,7 @@ Toolkit::Visual::Base VisualFactory::CreateVisual(const Property::Map& propertyM
     }
   }
 
-  DALI_LOG_INFO(gLogFilter, Debug::Concise, "VisualFactory::CreateVisual( VisualType:%s %s%s)\n", Scripting::GetEnumerationName<Toolkit::DevelVisual::Type>(visualType, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT), (visualType == Toolkit::DevelVisual::IMAGE) ? "url:" : "", (visualType == Toolkit::DevelVisual::IMAGE) ? (([&]() {
-                  // Return URL if present in PropertyMap else return "not found message"
-                  Property::Value* imageURLValue = propertyMap.Find(Toolkit::ImageVisual::Property::URL, IMAGE_URL_NAME);
-                  return (imageURLValue) ? imageURLValue->Get<std::string>().c_str() : "url not found in PropertyMap";
-                })())
-                                                                                                                                                                                                                                                                                                                            : "");
+  DALI_LOG_INFO(gLogFilter, Debug::Concise, "VisualFactory::CreateVisual( VisualType:%s %s%s)\n", Scripting::GetEnumerationName<Toolkit::DevelVisual::Type>(visualType, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT), (visualType == Toolkit::DevelVisual::IMAGE) ? "url:" : "", (visualType == Toolkit::DevelVisual::IMAGE) ? (visualUrl.IsValid() ? visualUrl.GetUrl().c_str() : "url not found in PropertyMap") : "");
 
   if(!visualPtr)
   {
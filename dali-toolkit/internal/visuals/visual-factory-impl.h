@@ -24,6 +24,7 @@
 #include <dali-toolkit/devel-api/styling/style-manager-devel.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-base.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
 #include <dali-toolkit/public-api/styling/style-manager.h>
 
@@ -35,6 +36,7 @@ namespace Internal
 {
 class VisualFactoryCache;
 class ImageVisualShaderFactory;
+class VisualUrl;
 
 /**
  * @copydoc Toolkit::VisualFactory
@@ -69,6 +71,11 @@ public:
    */
   Toolkit::Visual::Base CreateVisual(const Property::Map& propertyMap);
 
+  /**
+   * @copydoc Toolkit::VisualFactory::CreateVisual( const VisualDescriptor& )
+   */
+  Toolkit::Visual::Base CreateVisual(const Toolkit::VisualDescriptor& descriptor);
+
   /**
    * @copydoc Toolkit::VisualFactory::CreateVisual( const std::string&, ImageDimensions )
    */
@@ -96,6 +103,17 @@ protected:
   ~VisualFactory() override;
 
 private:
+  /**
+   * @brief Create the visual from its parsed properties.
+   *
+   * @param[in] visualType The type of the visual
+   * @param[in] visualUrl The url of the visual, invalid if it has none
+   * @param[in] urlArray The urls of an animated image given as an array, or nullptr
+   * @param[in] propertyMap The properties of the visual
+   * @return The handle to the created visual
+   */
+  Toolkit::Visual::Base CreateVisual(Toolkit::DevelVisual::Type visualType, const VisualUrl& visualUrl, const Property::Array* urlArray, const Property::Map& propertyMap);
+
   /**
    * @brief Set the Broken Image url
    * @param[in] styleManager The instance of StyleManager
@@ -54,7 +54,7 @@ enum
    * @note The array form is used for generating animated image visuals.
    * @note The number of threads used for local and remote image loading can be controlled by the
    *       environment variables DALI_TEXTURE_LOCAL_THREADS and DALI_TEXTURE_REMOTE_THREADS respectively.
-   *       The default values are 4 threads for local image loading and 8 threads for remote image loading.
+   *       The default values are the number of CPU cores (at least 4) for local image loading and 8 threads for remote image loading.
    * @SINCE_1_1.45
    * @note Mandatory.
    */
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+namespace
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////
+string      PROGRAM_NAME; ///< We set the program name on this global early on for use in Usage.
+string_view VERSION = "1.0.0";
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Prints out the Usage to standard output.
+void Usage()
+{
+  cout << "Usage: " << PROGRAM_NAME << " [OPTIONS] [IN_FILE] [OUT_FILE]" << endl;
+  cout << "  IN_FILE:  The json theme file to compile." << endl;
+  cout << "  OUT_FILE: The file where the binary tree of the theme will be outputted to." << endl;
+  cout << "            The StyleManager loads it in place of the json theme file, without parsing." << endl;
+  cout << "            Any existing file of the same name will be overwritten." << endl;
+  cout << "  Options: " << endl;
+  cout << "     -v|--version  Prints out the version" << endl;
+  cout << "     -h|--help     Help" << endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// Parses the json theme file and writes its tree in the binary format of JsonParser::WriteBinary().
+/// @param[in]  inFile   The json theme file
+/// @param[in]  outFile  The binary file to write
+/// @return 0 if successful, 1 if failure
+int CompileTheme(const string& inFile, const string& outFile)
+{
+  ifstream input(inFile, ios::in | ios::binary);
+  if(!input.is_open())
+  {
+    cerr << "ERROR: Unable to open " << inFile << endl;
+    return 1;
+  }
+
+  stringstream source;
+  source << input.rdbuf();
+
+  Dali::Toolkit::JsonParser parser = Dali::Toolkit::JsonParser::New();
+  if(!parser.Parse(source.str()))
+  {
+    cerr << "ERROR: " << inFile << ":" << parser.GetErrorLineNumber() << ":" << parser.GetErrorColumn() << ": "
+         << parser.GetErrorDescription() << endl;
+    return 1;
+  }
+
+  ofstream output(outFile, ios::out | ios::binary | ios::trunc);
+  if(!output.is_open())
+  {
+    cerr << "ERROR: Unable to open " << outFile << endl;
+    return 1;
+  }
+
+  parser.WriteBinary(output);
+  output.close();
+  if(output.fail())
+  {
+    cerr << "ERROR: Unable to write " << outFile << endl;
+    return 1;
+  }
+  return 0;
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// MAIN.
+int main(int argc, char* argv[])
+{
+  PROGRAM_NAME = argv[0];
+
+  string inFile;
+  string outFile;
+
+  for(auto i = 1; i < argc; ++i)
+  {
+    string option(argv[i]);
+    if(option == "--help" || option == "-h")
+    {
+      cout << "DALi Theme Compiler v" << VERSION << endl
+           << endl;
+      Usage();
+      return 0;
+    }
+    else if(option == "--version" || option == "-v")
+    {
+      cout << VERSION << endl;
+      return 0;
+    }
+    else if(*option.begin() == '-')
+    {
+      cerr << "ERROR: " << option << " is not a supported option" << endl;
+      Usage();
+      return 1;
+    }
+    else if(inFile.empty())
+    {
+      inFile = option;
+    }
+    else if(outFile.empty())
+    {
+      outFile = option;
+    }
+    else
+    {
+      cerr << "ERROR: Too many options" << endl;
+      Usage();
+      return 1;
+    }
+  }
+
+  if(inFile.empty() || outFile.empty())
+  {
+    cerr << "ERROR: Both IN_FILE & OUT_FILE not provided" << endl;
+    Usage();
+    return 1;
+  }
+
+  return CompileTheme(inFile, outFile);
+}
@@ -430,6 +430,7 @@ esac
 %{dev_include_path}/dali-toolkit/*
 %{_libdir}/pkgconfig/dali2-toolkit.pc
 %{_bindir}/dali-shader-generator
+%{_bindir}/dali-theme-compiler
 
 %files resources_360x360
 %manifest dali-toolkit-resources.manifest